@@ -1,9 +1,14 @@
 // Author: Ken Huynh
 // Thie file contains the function that is used to configure and operate UART 
+// Transmit is buffered: callers copy into a software ring and the SCIB TX FIFO
+// interrupt moves up to 16 bytes per interrupt into the hardware FIFO.
 
 //in-house includes
 #include "28379D_uart.h"
 
+//TI includes
+#include <ti/sysbios/knl/Task.h>
+
 //C standard library includes
 #include <stddef.h>
 #include <stdio.h>
@@ -11,13 +16,26 @@
 #include <stdarg.h>
 #include <stdlib.h>
 
-void uart_init(uint32_t baudrate)
-{
-    uint32_t baud_val = ((LSP_CLK_FREQ / (baudrate * 8U)) - 1U);
+#define UART_TX_RING_MASK (UART_TX_RING_SIZE - 1U)
 
-    EALLOW; //allow writes to protected registers
-    CpuSysRegs.PCLKCR7.bit.SCI_B = 1; //enable SCIB module
+//single-producer/single-consumer ring: head is only written by the producer,
+//tail only by SCIB_TX_ISR, so neither side needs to disable interrupts
+static char uart_tx_ring[UART_TX_RING_SIZE];
+static volatile uint16_t uart_tx_head = 0;
+static volatile uint16_t uart_tx_tail = 0;
+volatile uint32_t uart_tx_dropped = 0;
+
+//frame ping-pong: a non-zero length hands the buffer to the ISR, the ISR zeroes it when sent
+static char uart_frame_buf[2][UART_FRAME_SIZE];
+static volatile uint16_t uart_frame_len[2] = {0, 0};
+static uint16_t uart_frame_fill = 0; //producer side buffer
+static uint16_t uart_frame_wire = 0; //ISR side buffer
+static uint16_t uart_frame_pos = 0;  //next byte of the wire buffer
 
+#ifdef CPU1
+void uart_pin_init(void)
+{
+    EALLOW;
     //GPIO19 , rx_pin setup
     GpioCtrlRegs.GPAGMUX2.bit.GPIO19 |= 0x0U;
     GpioCtrlRegs.GPAMUX2.bit.GPIO19 |= 0x2U;
@@ -29,6 +47,19 @@ void uart_init(uint32_t baudrate)
      GpioCtrlRegs.GPAMUX2.bit.GPIO18 |= 0x2U;
      GpioCtrlRegs.GPAPUD.bit.GPIO18 = 0;
      GpioCtrlRegs.GPAQSEL2.bit.GPIO18 |= 0x3U;
+    EDIS;
+}
+#endif
+
+void uart_init(uint32_t baudrate)
+{
+    uint32_t baud_val = ((LSP_CLK_FREQ / (baudrate * 8U)) - 1U);
+
+#ifdef CPU1
+    uart_pin_init(); //the GPIO mux belongs to CPU1
+#endif
+    EALLOW; //allow writes to protected registers
+    CpuSysRegs.PCLKCR7.bit.SCI_B = 1; //enable SCIB module
 
     ScibRegs.SCIFFRX.bit.RXFFOVRCLR = 1; //clear overflow flag
     //reset tx fifo
@@ -42,6 +73,8 @@ void uart_init(uint32_t baudrate)
     ScibRegs.SCIFFTX.bit.SCIRST = 1;
 
     ScibRegs.SCIFFTX.bit.SCIFFENA = 1; //enable FIFOs
+    ScibRegs.SCIFFTX.bit.TXFFIL = UART_TX_FIFO_LEVEL; //refill threshold for the TX FIFO interrupt
+    ScibRegs.SCIFFTX.bit.TXFFIENA = 0; //enabled by the producer when the ring has data
 
 
     //perform soft reset to clear flags
@@ -74,32 +107,145 @@ void uart_init(uint32_t baudrate)
 
 }
 
-void uart_tx_char(char tx_char)
+//start the TX FIFO interrupt, it fires straight away if the FIFO is below UART_TX_FIFO_LEVEL
+static void uart_tx_kick(void)
 {
-    while(ScibRegs.SCIFFTX.bit.TXFFST != 0)
-        {
-            ; //wait until tx buffer is empty
-        }
-        ScibRegs.SCITXBUF.bit.TXDT = tx_char;
+    ScibRegs.SCIFFTX.bit.TXFFIENA = 1;
+}
+
+static bool uart_tx_put(char tx_char)
+{
+    uint16_t head = uart_tx_head;
+    uint16_t next = (head + 1U) & UART_TX_RING_MASK;
+
+    if (next == uart_tx_tail)
+    {
+        uart_tx_dropped++; //ring full, drop rather than block the caller
+        return false;
+    }
+    uart_tx_ring[head] = tx_char & 0xFF;
+    uart_tx_head = next; //publish after the byte is stored
+    return true;
+}
+
+bool uart_tx_char(char tx_char)
+{
+    bool queued = uart_tx_put(tx_char);
+    uart_tx_kick();
+    return queued;
 }
 
 void uart_tx_str(const char *str)
 {
     int i = 0;
-    //while string hasn't reached end (NULL key) send characters
+    //while string hasn't reached end (NULL key) queue characters
     while (str[i] != '\0')
     {
-        uart_tx_char(str[i++]); //send current char
+        if (!uart_tx_put(str[i++])) //queue current char
+        {
+            break;
+        }
     }
+    uart_tx_kick();
 }
 
-void uart_tx_buff(char *tx_buff, uint16_t length)
+uint16_t uart_tx_buff(const char *tx_buff, uint16_t length)
 {
     uint16_t i = 0;
 
     for(i = 0; i < length; i++)
     {
-        uart_tx_char(tx_buff[i]);
+        if (!uart_tx_put(tx_buff[i]))
+        {
+            break;
+        }
+    }
+    uart_tx_kick();
+    return i;
+}
+
+char *uart_frame_acquire(void)
+{
+    if (uart_frame_len[uart_frame_fill] != 0U)
+    {
+        return NULL; //both buffers queued or on the wire
     }
+    return uart_frame_buf[uart_frame_fill];
 }
 
+bool uart_frame_submit(uint16_t length)
+{
+    if ((uart_frame_len[uart_frame_fill] != 0U) || (length == 0U))
+    {
+        return false;
+    }
+    if (length > UART_FRAME_SIZE)
+    {
+        length = UART_FRAME_SIZE;
+    }
+    uart_frame_len[uart_frame_fill] = length; //ownership passes to the ISR
+    uart_frame_fill ^= 1U;
+    uart_tx_kick();
+    return true;
+}
+
+int16_t uart_rx_char(void)
+{
+    if (ScibRegs.SCIFFRX.bit.RXFFOVF != 0U)
+    {
+        ScibRegs.SCIFFRX.bit.RXFFOVRCLR = 1; //bytes were lost, keep what is in the FIFO
+    }
+    if (ScibRegs.SCIFFRX.bit.RXFFST == 0U)
+    {
+        return -1;
+    }
+    return (int16_t)(ScibRegs.SCIRXBUF.all & 0xFFU);
+}
+
+uint16_t uart_tx_pending(void)
+{
+    return ((uart_tx_head - uart_tx_tail) & UART_TX_RING_MASK) + uart_frame_len[0] + uart_frame_len[1];
+}
+
+void uart_tx_flush(void)
+{
+    while ((uart_tx_pending() != 0U) || (ScibRegs.SCIFFTX.bit.TXFFST != 0U) || (ScibRegs.SCICTL2.bit.TXEMPTY == 0U))
+    {
+        Task_sleep(1); //let lower priority threads run while the line drains
+    }
+}
+
+/* ======== SCIB_TX_ISR ======== */
+//HWI configured ISR for the SCIB TX FIFO level, tops the FIFO up from the software ring
+//and then from the frame buffer on the wire
+Void SCIB_TX_ISR(UArg arg)
+{
+    uint16_t tail = uart_tx_tail;
+    uint16_t len;
+
+    while ((tail != uart_tx_head) && (ScibRegs.SCIFFTX.bit.TXFFST < SCI_FIFO_DEPTH))
+    {
+        ScibRegs.SCITXBUF.all = uart_tx_ring[tail];
+        tail = (tail + 1U) & UART_TX_RING_MASK;
+    }
+    uart_tx_tail = tail;
+
+    len = uart_frame_len[uart_frame_wire];
+    while ((len != 0U) && (ScibRegs.SCIFFTX.bit.TXFFST < SCI_FIFO_DEPTH))
+    {
+        ScibRegs.SCITXBUF.all = uart_frame_buf[uart_frame_wire][uart_frame_pos++] & 0xFF;
+        if (uart_frame_pos == len)
+        {
+            uart_frame_pos = 0;
+            uart_frame_len[uart_frame_wire] = 0; //buffer free for the producer again
+            uart_frame_wire ^= 1U;
+            len = uart_frame_len[uart_frame_wire];
+        }
+    }
+
+    if ((tail == uart_tx_head) && (len == 0U))
+    {
+        ScibRegs.SCIFFTX.bit.TXFFIENA = 0; //ring empty, producer re-enables on the next enqueue
+    }
+    ScibRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+}
@@ -4,16 +4,50 @@
 //C standard library includes
 #include <stdint.h>
 //TI Includes
+#include <xdc/std.h>
 #include <Headers/F2837xD_device.h>
 
 #define LSP_CLK_FREQ 50000000U
-//Initializes SCIA module at specified baud rate, 8 bit frame, 1 stop bit.
+#define SCI_FIFO_DEPTH 16U
+//Software transmit ring, must be a power of two.
+#define UART_TX_RING_SIZE 256U
+//TX FIFO interrupt fires once the hardware FIFO drains to this many words (0..15).
+#ifndef UART_TX_FIFO_LEVEL
+#define UART_TX_FIFO_LEVEL 4U
+#endif
+
+//Initializes SCIB module at specified baud rate, 8 bit frame, 1 stop bit.
+//On CPU1 this also muxes GPIO18/19 to SCIB.
 void uart_init(uint32_t baudrate);
-//Sends a byte out SCIA module A.
-void uart_tx_char(char tx_char);
-//Sends a null-terminated string
+#ifdef CPU1
+//Muxes GPIO18 (TX) and GPIO19 (RX) to SCIB, for when CPU2 owns the SCI.
+void uart_pin_init(void);
+#endif
+//Queues a byte for SCIB. Returns false (and counts a drop) if the ring is full.
+bool uart_tx_char(char tx_char);
+//Queues a null-terminated string
 void uart_tx_str(const char *str);
-// Sends a buffer of characters up to length characters over SCIA module.
-void uart_tx_buff(char *tx_buff, uint16_t length);
+//Queues up to length characters and returns how many fit in the ring. Does not wait for the line.
+//The ring is single-producer: only one thread may call the uart_tx_* functions.
+uint16_t uart_tx_buff(const char *tx_buff, uint16_t length);
+//Bytes queued and not yet in the hardware FIFO: what is left in the software ring plus the
+//full length of each frame buffer still in flight (uart_frame_submit).
+uint16_t uart_tx_pending(void);
+//Blocks (sleeping, not spinning) until the ring, the FIFO and the shift register are empty.
+void uart_tx_flush(void);
+//Double-buffered frames: build the next frame in one buffer while SCIB_TX_ISR streams the
+//other straight into the FIFO, without the extra copy into the ring. Do not interleave
+//uart_frame_* and uart_tx_* output from the same producer, the ISR sends the ring first.
+#define UART_FRAME_SIZE 64U
+//Returns the free frame buffer (UART_FRAME_SIZE chars) or NULL while both are in flight.
+char *uart_frame_acquire(void);
+//Hands the acquired buffer to the ISR. Returns false if no buffer was acquired.
+bool uart_frame_submit(uint16_t length);
+//Returns the next received byte, or -1 when the RX FIFO is empty. Polled, no RX interrupt.
+int16_t uart_rx_char(void);
+//Bytes discarded because the ring was full.
+extern volatile uint32_t uart_tx_dropped;
+//SCIB transmit FIFO interrupt, attached in app.cfg.
+Void SCIB_TX_ISR(UArg arg);
 
 #endif
@@ -15,6 +15,7 @@
 // Date:                19Oct2021
 
 #include <Headers/F2837xD_device.h>
+#include "adc_config.h"
 
 extern void DelayUs(Uint16);
 
@@ -31,9 +32,8 @@ EALLOW;
     GpioDataRegs.GPBCLEAR.bit.GPIO34 = 1;
 
     //Initialize GPIO for Ultrasonic Sensor
-    GpioCtrlRegs.GPBMUX2.bit.GPIO52 = 0; //Trig pin ultrasonic //DB
-    GpioCtrlRegs.GPBDIR.bit.GPIO52 = 1; // configure to output //DB
-    GpioDataRegs.GPBCLEAR.bit.GPIO52 = 1; //clear //DB
+    GpioCtrlRegs.GPAPUD.bit.GPIO2 = 1; //no pull-up on the trigger output
+    GpioCtrlRegs.GPAMUX1.bit.GPIO2 = 1; //Trig pin ultrasonic, driven by EPWM2A
 
     //Initialize GPIO for water pump
     GpioCtrlRegs.GPAMUX2.bit.GPIO22 = 0; //Trig pin ultrasonic //DB
@@ -55,11 +55,22 @@ EALLOW;
     //wait 1 ms after power-up before using the ADC:
     DelayUs(1000);
 
-    AdcaRegs.ADCSOC0CTL.bit.TRIGSEL = 2; //trigger source = CPU1 Timer 1 
-    AdcaRegs.ADCSOC0CTL.bit.CHSEL = 5; //set SOC0 to sample A5 //KH
-    AdcaRegs.ADCSOC0CTL.bit.ACQPS = 139; //set SOC0 window to 139 SYSCLK cycles
-    AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = 0; //connect interrupt ADCINT1 to EOC0 //KH
+    //SOC0..SOC(N-1) all sample A5 on the same Timer1 trigger, round-robin converts them in order
+    {
+        volatile Uint32 *socctl = &AdcaRegs.ADCSOC0CTL.all; //ADCSOCxCTL registers are contiguous
+        Uint16 soc;
+        for (soc = 0; soc < ADC_OVERSAMPLE; soc++)
+        {
+            socctl[soc] = ((Uint32)MOISTURE_ADC_TRIGSEL << 20)  //trigger source = CPU1 Timer 1
+                        | ((Uint32)MOISTURE_ADC_CHANNEL << 15)  //sample A5 //KH
+                        | MOISTURE_ADC_ACQPS;                   //139 SYSCLK cycle window
+        }
+    }
+    AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = ADC_OVERSAMPLE - 1; //connect interrupt ADCINT1 to the EOC of the last SOC in the burst //KH
     AdcaRegs.ADCINTSEL1N2.bit.INT1E = 1; //enable interrupt ADCINT1
+#if ADC_USE_DMA || MOISTURE_USE_CLA
+    AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1; //nobody clears the flag per trigger, keep pulsing for the DMA / CLA
+#endif
   
     //---------------------------------------------------------------
     // INITIALIZE eCAP //DB
@@ -84,10 +95,11 @@ EALLOW;
     ECap1Regs.ECCTL1.bit.PRESCALE = 0;
     ECap1Regs.ECCTL2.bit.CAP_APWM = 0;
     ECap1Regs.ECCTL2.bit.CONT_ONESHT = 0;
+    ECap1Regs.ECCTL2.bit.STOP_WRAP = 3; // 4-event continuous: CAP1/CAP2 and CAP3/CAP4 hold two echoes
     ECap1Regs.ECCTL2.bit.SYNCO_SEL = 2;
     ECap1Regs.ECCTL2.bit.SYNCI_EN = 0;
     ECap1Regs.ECCTL2.bit.TSCTRSTOP = 1; // Allow TSCTR to run
-    ECap1Regs.ECEINT.bit.CEVT2 = 1;
+    ECap1Regs.ECEINT.bit.CEVT4 = 1; // one interrupt per two echoes
 
 EDIS;
 }
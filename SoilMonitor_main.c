@@ -10,10 +10,11 @@
 
 //defines:
 #define xdc__strict //suppress typedef warnings
-#define VREFHI 3.0 //reference voltage for capacitive soil moisture sensor
 #define DHT20_ADDRESS 0x38 // address for I2C temperature and humidity sensor
 #define BUFFER_SIZE 64 // set circular buffer size 
-#define WATER_LEVEL 14.5 //set the lowest water level for tank in cm
+#define MOISTURE_WINDOW 32 // moisture samples in the statistics window
+#define DISTANCE_WINDOW 16 // water level samples in the statistics window
+#define SAMPLE_STALE_MS 30000 // telemetry flags a channel with no record for this long
 
 //includes:
 #include <xdc/std.h>
@@ -27,9 +28,26 @@
 #include <ti/sysbios/knl/Semaphore.h>
 #include <xdc/runtime/Timestamp.h>
 #include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/hal/Hwi.h>
 #include "i2c_driver.h"
 #include "ultrasonic.h"
 #include "28379D_uart.h"
+#include "telemetry.h"
+#include "sensor_math.h"
+#include "adc_config.h"
+#include "adc_dma.h"
+#include "moisture_cla.h"
+#include "cpu1_ipc.h"
+#include "water_level.h"
+#include "tank_model.h"
+#include "window_stats.h"
+#include "decimator.h"
+#include "snapshot.h"
+#include "sample_ring.h"
+#include "timebase.h"
+#include "profile.h"
+#include "trace_bios.h"
+#include "bench.h"
 #include <Headers/F2837xD_device.h>
 
 //Swi handle defined in .cfg file:
@@ -55,35 +73,232 @@ volatile Bool isrFlag1 = FALSE; //flag used by swi and tsk to stop if water leve
 volatile UInt16 tickCount = 0; //counter incremented by timer interrupt
 int once = 0;
 int init = 0;
-//sensor variables
-float moisture_voltage_reading; //for Hwi KH
-float water_content;
-float humidity;
-float temperature;
-//buffer variables
-float temperature_buffer [BUFFER_SIZE] = {0}; //Initialize buffer and set all elements to 0 //DB
-int counter_buffer= 0;
-float sum = 0;
-int num_samples = 0;
-float movingAverage;
+//sensor variables (sensor_t is float, or Q16.16 when built with SENSOR_MATH_FIXED=1)
+volatile uint16_t moisture_adc_code; //raw ADC code latched by Hwi
+const uint16_t *volatile moisture_adc_block; //finished DMA half, ADC_USE_DMA=1
+sensor_t moisture_voltage_reading; //for Hwi KH
+sensor_t water_content;
+sensor_t humidity;
+sensor_t temperature;
+//windowed statistics per channel, integer samples in 0.01 C, 0.01 %RH, 0.01 % and mm (window_stats.h),
+//sent on WINDOW_STATS_DUMP_COMMAND
+static int32_t temperature_window[WINDOW_STATS_WORDS(BUFFER_SIZE)];
+static int32_t humidity_window[WINDOW_STATS_WORDS(BUFFER_SIZE)];
+static int32_t moisture_window[WINDOW_STATS_WORDS(MOISTURE_WINDOW)];
+static int32_t distance_window[WINDOW_STATS_WORDS(DISTANCE_WINDOW)];
+window_stats_t temperature_stats;
+window_stats_t humidity_stats;
+window_stats_t moisture_stats;
+window_stats_t distance_stats;
+decim_channel_t moisture_decim; //moisture code at the lower rates (cic_out, fir_out, summary), sent with the stats dump
+//filter and pump hysteresis of the CPU path (Swi0), the same moisture_ctrl_step() CLA task 1 runs
+static moisture_ctrl_params_t moisture_params;
+static moisture_ctrl_state_t moisture_state;
+//coherent records for the readers in other threads (snapshot.h), one per writing thread
+typedef struct
+{
+    sensor_t humidity;
+    sensor_t temperature;
+    sensor_t temperature_avg;
+} env_record_t; //Tsk0
+typedef struct
+{
+    sensor_t distance;
+    uint32_t volume_ml;
+} level_record_t; //Tsk1
+typedef struct
+{
+    sensor_t water_content;
+    uint16_t code;
+} moisture_record_t; //Swi0 or MOISTURE_CLA_ISR
+static env_record_t env_copies[2];
+static level_record_t level_copies[2];
+static moisture_record_t moisture_copies[2];
+snapshot_t env_snapshot;
+snapshot_t level_snapshot;
+snapshot_t moisture_snapshot;
+//timestamped records from every producer, each consumer reads with its own cursor (sample_ring.h)
+sample_ring_t sample_ring;
+timebase_t timebase; //Timestamp_get32() extended to 64 bits (timebase.h)
+static sample_cursor_t uart_cursor; //Tsk2
+sensor_t movingAverage;
 //distance &ecap 
-float distance;
+sensor_t distance;
 unsigned long int  ECAP_data;
+volatile uint32_t ultrasonic_echo[2]; //CAP2 and CAP4 widths of the last eCAP cycle
+uint32_t ultrasonic_timeouts = 0; //ranging periods that ended without an echo
+water_level_t tank_level; //median window over the echoes
+uint32_t tank_volume; //mL left in the tank (tank_model.h)
+sensor_t tank_litres_left;
+uint32_t tank_pump_seconds_left; //pump run time before the reserve is reached
 int count;
-//elapsed time measurement for each thread
-uint32_t  elapsedTimei2c;
-uint32_t  elapsedTimeultra;
-uint32_t  elapsedTimeuart;
-uint32_t  elapsedTimeidle;
-uint32_t  elapsedTimeswi;
-uint32_t  elapsedTimehwi;
+//elapsed time of each thread goes to its probe in profile_probes (profile.h)
+volatile uint16_t profile_dump_request = 0; //set from the debugger or by PROFILE_DUMP_COMMAND on SCIB
+volatile uint16_t trace_dump_request = 0; //same for the event trace, TRACE_DUMP_COMMAND
+volatile uint16_t bench_request = 0; //runs the microbenchmarks (bench.h), BENCH_COMMAND
+volatile uint16_t stats_dump_request = 0; //sends the windowed statistics and moisture_decim, WINDOW_STATS_DUMP_COMMAND
+//telemetry frame sequence number
+uint16_t telemetry_seq = 0;
+/* ======== timebase_now ======== */
+//64-bit timestamp, callable from Hwi, Swi and Task context. The counter is read with Hwi
+//disabled so a preempting reader can never store a newer reading before ours is extended.
+uint64_t timebase_now(void)
+{
+    UInt key = Hwi_disable();
+    uint64_t now = timebase_extend(&timebase, Timestamp_get32());
+    Hwi_restore(key);
+    return now;
+}
+/* ======== sample_record ======== */
+//Appends one timestamped record to sample_ring, callable from Hwi, Swi and Task context
+static void sample_record(uint16_t channel, int32_t value, uint16_t quality)
+{
+    sample_record_t rec;
+    UInt key = Hwi_disable(); // producers run in every context, the append is a few stores
+    rec.time = timebase_now();
+    rec.value = value;
+    rec.channel = channel;
+    rec.quality = quality;
+    sample_ring_append(&sample_ring, &rec);
+    Hwi_restore(key);
+}
+#if !SOIL_DUAL_CORE
+/* ======== dump_frame ======== */
+//Waits for a free UART frame buffer, for the dumps from Tsk2
+static unsigned char *dump_frame(void)
+{
+    char *frame;
+    while ((frame = uart_frame_acquire()) == NULL)
+    {
+        Task_sleep(1); // a frame is on the wire for about 5 ms at 115200 baud
+    }
+    return (unsigned char *)frame;
+}
+/* ======== profile_dump ======== */
+//Sends every probe over SCIB as profile frames (profile.h), called from Tsk2
+static void profile_dump(void)
+{
+    uint16_t probe;
+    for (probe = 0; probe < PROFILE_PROBES; probe++)
+    {
+        profile_probe_t copy;
+        UInt key = Hwi_disable(); // the Hwi and Swi probes may be recorded meanwhile
+        copy = profile_probes[probe];
+        Hwi_restore(key);
+        uint16_t frames = profile_frames(&copy);
+        uint16_t part;
+        for (part = 0; part < frames; part++)
+        {
+            uart_frame_submit(profile_encode(dump_frame(), probe, &copy, part));
+        }
+    }
+}
+/* ======== trace_dump ======== */
+//Freezes the event trace and sends it over SCIB (trace.h), called from Tsk2. Recording
+//restarts afterwards, so each dump shows what led up to its request.
+static void trace_dump(void)
+{
+    Types_FreqHz freq;
+    Timestamp_getFreq(&freq);
+    uint16_t frames = trace_freeze(&trace_buffer);
+    uint16_t part;
+    for (part = 0; part < frames; part++)
+    {
+        uart_frame_submit(trace_encode(dump_frame(), &trace_buffer, freq.lo, part));
+    }
+    trace_resume(&trace_buffer);
+}
+/* ======== stats_dump ======== */
+//Sends the windowed statistics of every channel (window_stats.h) and the outputs of the moisture
+//pipeline (decimator.h) over SCIB, called from Tsk2.
+//Hwis are held off while a frame is encoded: the moisture writer is Swi0, or MOISTURE_CLA_ISR.
+//Tsk0 and Tsk1 never run in the middle of an encode, but one of them preempted by Tsk2 in the
+//middle of a push shows that half done push.
+static void stats_dump(void)
+{
+    static window_stats_t *const channels[] = { &temperature_stats, &humidity_stats, &moisture_stats, &distance_stats };
+    static const uint16_t ids[] = { SAMPLE_CH_TEMPERATURE, SAMPLE_CH_HUMIDITY, SAMPLE_CH_MOISTURE, SAMPLE_CH_DISTANCE };
+    uint16_t i;
+    for (i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+    {
+        unsigned char *frame = dump_frame();
+        UInt key = Hwi_disable();
+        uint16_t length = window_stats_encode(frame, ids[i], channels[i]);
+        Hwi_restore(key);
+        uart_frame_submit(length);
+    }
+    unsigned char *frame = dump_frame();
+    UInt key = Hwi_disable();
+    uint16_t length = decim_encode(frame, SAMPLE_CH_MOISTURE, &moisture_decim);
+    Hwi_restore(key);
+    uart_frame_submit(length);
+}
+/* ======== bench_dump ======== */
+//Runs the microbenchmark suite (bench.h) and sends a frame per case over SCIB, called from Tsk2.
+//Hwis and higher priority threads still preempt it, which only the max and mean of a case show.
+static uint32_t bench_counter(void)
+{
+    return Timestamp_get32();
+}
+static void bench_dump(void)
+{
+    Types_FreqHz freq;
+    Timestamp_getFreq(&freq);
+    uart_frame_submit(bench_encode_start(dump_frame(), freq.lo));
+    bench_init();
+    uint16_t c;
+    for (c = 0; c < BENCH_CASES; c++)
+    {
+        profile_probe_t probe;
+        profile_probe_init(&probe);
+        bench_run(c, BENCH_SAMPLES, bench_counter, &probe);
+        uart_frame_submit(bench_encode_result(dump_frame(), c, &probe));
+    }
+}
+#endif
 /* ======== main ======== */
 Int main()
 { 
     //initialization
     DeviceInit(); //initialize processor  
+    window_stats_init(&temperature_stats, temperature_window, BUFFER_SIZE);
+    window_stats_init(&humidity_stats, humidity_window, BUFFER_SIZE);
+    window_stats_init(&moisture_stats, moisture_window, MOISTURE_WINDOW);
+    window_stats_init(&distance_stats, distance_window, DISTANCE_WINDOW);
+    env_record_t env_initial = { SENSOR(0), SENSOR(20), SENSOR(20) }; // 20 C until the DHT20 has answered
+    level_record_t level_initial = { SENSOR(0), 0 };
+    moisture_record_t moisture_initial = { SENSOR(0), 0 };
+    Types_FreqHz freq;
+    Timestamp_getFreq(&freq);
+    timebase_init(&timebase, freq.lo, Timestamp_get32());
+    profile_init();
+    trace_init(&trace_buffer); // the hooks in app.cfg record from BIOS_start on
+    sample_ring_init(&sample_ring);
+    sample_cursor_init(&sample_ring, &uart_cursor, 0);
+    snapshot_init(&env_snapshot, &env_copies[0], &env_copies[1], sizeof(env_record_t), &env_initial);
+    snapshot_init(&level_snapshot, &level_copies[0], &level_copies[1], sizeof(level_record_t), &level_initial);
+    snapshot_init(&moisture_snapshot, &moisture_copies[0], &moisture_copies[1], sizeof(moisture_record_t), &moisture_initial);
+    decim_channel_init(&moisture_decim, MOISTURE_CIC_ORDER, MOISTURE_CIC_RATIO, MOISTURE_FIR_TAPS,
+                       MOISTURE_FIR_RATIO, MOISTURE_AGGREGATE);
+    water_level_init(&tank_level);
+    tank_model_init(); // volume table for the configured tank geometry
+    ultrasonic_init(); // ePWM2 triggers the ultrasonic sensor from here on
+#if ADC_USE_DMA
+    adc_dma_init(); // DMA CH1 collects the ADC bursts, ADC_DMA_ISR takes over from myHwi
+#elif MOISTURE_USE_CLA
+    moisture_cla_init(); // CLA task 1 filters the moisture and decides the pump, MOISTURE_CLA_ISR applies it
+#endif
+    moisture_ctrl_params_init(&moisture_params, MOISTURE_PUMP_ON, MOISTURE_PUMP_OFF, MOISTURE_FILTER_SHIFT);
+    moisture_ctrl_reset(&moisture_state);
+#if ADC_USE_DMA || MOISTURE_USE_CLA
+    Hwi_disableInterrupt(32); // ADCA1 only triggers the DMA / CLA now
+#endif
     start_i2c(); // initialize the I2C module //KH
+#if SOIL_DUAL_CORE
+    ipc_cpu1_init(); // SCIB and telemetry move to CPU2 (cpu2/)
+#else
     uart_init(115200UL); // initialize UART module //KH
+#endif
     //jump to RTOS (does not return):
     BIOS_start();
     return(0);
@@ -93,8 +308,16 @@ Int main()
 //Collects time data captured in the corresponding register and clears all the flags
 Void ECAP_ISR(UArg arg) //DB
 {
-ECAP_data = ECap1Regs.CAP2; // Set register values to a global variable 
+uint32_t startTime;
+uint32_t endTime;
+startTime = Timestamp_get32(); // worst case goes to the ecap probe (host/wcet_harness)
+ultrasonic_echo[0] = ECap1Regs.CAP2; // first echo of the 4-event cycle
+ultrasonic_echo[1] = ECap1Regs.CAP4; // second echo
+ECAP_data = ultrasonic_echo[1]; // Set register values to a global variable 
 ECap1Regs.ECCLR.all = 0xFF; // Clear all flags
+trace_sem_post(mySem1); // echo widths ready for Tsk1
+endTime = Timestamp_get32();
+profile_record(PROFILE_ECAP, endTime - startTime);
 }
 
 /* ======== myTickFxn ======== */
@@ -104,13 +327,13 @@ Void myTickFxn(UArg arg)
 {
     tickCount++; //increment the tick counter
     if(tickCount % 10000 == 0) { //changed to 100 times a second //DB
-        Semaphore_post(mySem);   // post I2C task //DB
+        timebase_now(); // every 100 ms keeps the timebase extension well inside one counter wrap (~21 s)
+        trace_sem_post(mySem);   // post I2C task //DB
         isrFlag = TRUE; //tell idle thread to blink LED 100 times a second
     }
-    if (init == 0) // to post task 1 and 2 once upon start up //DB
+    if (init == 0) // to post task 2 once upon start up //DB
     {
-        Semaphore_post(mySem2);
-        Semaphore_post(mySem1);
+        trace_sem_post(mySem2);
         init = 1;
     }
 }
@@ -127,7 +350,7 @@ Void myIdleFxn(Void)
        GpioDataRegs.GPATOGGLE.bit.GPIO31 = 1;  //toggle blue LED:
    }
    endTime = Timestamp_get32(); // get stop time stamp //DB
-   elapsedTimeidle = endTime - startTime; // measure elapsed time //DB
+   profile_record(PROFILE_IDLE, endTime - startTime); // measure elapsed time //DB
 }
 
 /* ========= myHwi ========== */
@@ -137,13 +360,61 @@ Void myHwi(Void) //KH
     uint32_t startTime;
     uint32_t endTime;
     startTime = Timestamp_get32(); // get start time stamp to measure HWI //DB
-    //read ADC value from temperature sensor:
-    moisture_voltage_reading = ((VREFHI/4095)*AdcaResultRegs.ADCRESULT0); //get reading and scale reference voltage //KH
+    //average the oversampled burst from the moisture sensor, conversion is left to the SWI:
+    const volatile Uint16 *result = &AdcaResultRegs.ADCRESULT0; //ADCRESULT0..15 are contiguous
+    uint32_t burst_sum = 0;
+    uint16_t i;
+    for (i = 0; i < ADC_OVERSAMPLE; i++)
+    {
+        burst_sum += result[i];
+    }
+    moisture_adc_code = (uint16_t)(burst_sum >> ADC_OVERSAMPLE_LOG2); //shift instead of divide
     AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; //clear interrupt flag //KH
     Swi_post(Swi0); // post SWI to process data //KH
     endTime = Timestamp_get32();
-    elapsedTimehwi = endTime - startTime; // get total time elapsed for HWI //DB
+    profile_record(PROFILE_HWI, endTime - startTime); // get total time elapsed for HWI //DB
 
+}
+/* ========= ADC_DMA_ISR ========== */
+//Hwi function called by DMA CH1 once per block of ADC_DMA_BLOCK moisture bursts
+Void ADC_DMA_ISR(UArg arg)
+{
+    uint32_t startTime;
+    uint32_t endTime;
+    startTime = Timestamp_get32();
+    moisture_adc_block = adc_dma_swap(); // DMA moves on to the other half, the SWI reduces this one
+    Swi_post(Swi0);
+    endTime = Timestamp_get32();
+    profile_record(PROFILE_HWI, endTime - startTime);
+}
+/* ========= MOISTURE_CLA_ISR ========== */
+//Hwi function called at the end of CLA task 1, applies the pump state the CLA decided
+Void MOISTURE_CLA_ISR(UArg arg)
+{
+#if MOISTURE_USE_CLA
+    uint32_t startTime;
+    uint32_t endTime;
+    startTime = Timestamp_get32();
+    uint16_t code = (uint16_t)moisture_cla_out.code; // filtered on the CLA
+    moisture_adc_code = code;
+    decim_channel_push(&moisture_decim, code);
+    moisture_voltage_reading = sensor_adc_to_volts(code);
+    water_content = sensor_water_content(code); // table lookup, kept here for the telemetry
+    window_stats_push(&moisture_stats, sensor_to_units(water_content, 100, -32768L, 32767L));
+    moisture_record_t moisture = { water_content, code };
+    snapshot_publish(&moisture_snapshot, &moisture);
+    sample_record(SAMPLE_CH_MOISTURE, sensor_to_units(water_content, 100, -32768L, 32767L), SAMPLE_Q_FILTERED);
+    if (moisture_cla_out.pump_on && (isrFlag1 == FALSE)) // tank lockout stays on the CPU
+    {
+        GpioDataRegs.GPASET.bit.GPIO22 = 1;
+    }
+    else
+    {
+        GpioDataRegs.GPACLEAR.bit.GPIO22 = 1;
+    }
+    endTime = Timestamp_get32();
+    profile_record(PROFILE_HWI, endTime - startTime);
+#endif
 }
 /* ========= mySwiFxn ========== */
 //SWI function that gets posted by Hwi to process capacitive soil moisture data
@@ -152,9 +423,27 @@ Void mySwiFxn(Void) //KH
       uint32_t startTime;
       uint32_t endTime;
       startTime = Timestamp_get32(); // get start time stamp to measure SWI //DB
-       //converting voltage reading of adc to water content in soil
-       water_content =(((1/moisture_voltage_reading)*2.48) - 0.72)*100; //KH
-       if ((water_content < 30) && (isrFlag1 == FALSE)) // logic to start or stop motor depnding on moisture level and tank level //DB
+       //converting voltage reading of adc to water content in soil (sensor_math.c)
+#if ADC_USE_DMA
+       moisture_adc_code = adc_block_mean(moisture_adc_block, ADC_OVERSAMPLE_LOG2 + ADC_DMA_BLOCK_LOG2); //one average per block
+       uint16_t burst;
+       for (burst = 0; burst < ADC_DMA_BLOCK; burst++) // the pipeline runs at the trigger rate
+       {
+           decim_channel_push(&moisture_decim, adc_block_mean(moisture_adc_block + burst * ADC_OVERSAMPLE, ADC_OVERSAMPLE_LOG2));
+       }
+#else
+       decim_channel_push(&moisture_decim, moisture_adc_code);
+#endif
+       moisture_ctrl_out_t ctrl;
+       moisture_ctrl_step(&moisture_state, &moisture_params, moisture_adc_code, &ctrl); // filter and 28 % / 32 % hysteresis
+       uint16_t code = (uint16_t)ctrl.code;
+       moisture_voltage_reading = sensor_adc_to_volts(code); //KH
+       water_content = sensor_water_content(code); //KH
+       window_stats_push(&moisture_stats, sensor_to_units(water_content, 100, -32768L, 32767L));
+       moisture_record_t moisture = { water_content, code };
+       snapshot_publish(&moisture_snapshot, &moisture);
+       sample_record(SAMPLE_CH_MOISTURE, sensor_to_units(water_content, 100, -32768L, 32767L), SAMPLE_Q_FILTERED);
+       if (ctrl.pump_on && (isrFlag1 == FALSE)) // logic to start or stop motor depnding on moisture level and tank level //DB
        {
            GpioDataRegs.GPASET.bit.GPIO22 = 1; // turn on motor
 
@@ -164,25 +453,104 @@ Void mySwiFxn(Void) //KH
            GpioDataRegs.GPACLEAR.bit.GPIO22 = 1; // turn off motor
        }
        endTime = Timestamp_get32();
-       elapsedTimeswi = endTime - startTime; // measured time elapsed for SWI //DB
+       profile_record(PROFILE_SWI, endTime - startTime); // measured time elapsed for SWI //DB
 }
 
 
-/* ========= myTskFxn1 ========== */
-//Tsk1 function that is posted from TSK 0 to interface with UART ESP32 //KH
+/* ========= myTskFxn2 ========== */
+//Tsk2 function that is posted from TSK 0 to send a binary telemetry frame (telemetry.h) to the ESP32 //KH
 Void myTskFxn2(Void) //KH
 {
     while (TRUE) {
-        Semaphore_pend(mySem2, BIOS_WAIT_FOREVER); // wait for semaphore to be posted
+        trace_sem_pend(mySem2, BIOS_WAIT_FOREVER); // wait for semaphore to be posted
         uint32_t startTime;
         uint32_t endTime;
         startTime = Timestamp_get32(); // collect start time stamp to measure TSK2 //DB
-        char str[50]; // store data //KH
-        sprintf(str,"Temp: %.3f Hum: %.3f\n", movingAverage,humidity); // convert char to string to transmit //KH
-        // Transmit the string over UART
-        uart_tx_str(str); //transmit string data through UART //KH
+        telemetry_sample_t sample;
+        env_record_t env;
+        level_record_t level;
+        moisture_record_t moisture;
+        snapshot_read(&env_snapshot, &env); // each record is whole even if its writer preempts us
+        snapshot_read(&level_snapshot, &level);
+        snapshot_read(&moisture_snapshot, &moisture);
+        // catch up on the sample records to know how old each channel is
+        static uint64_t channel_time[SAMPLE_CHANNELS]; // capture time of the newest record per channel
+        sample_record_t rec;
+        uint16_t ch;
+        uint16_t stale = 0;
+        while (sample_ring_read(&sample_ring, &uart_cursor, &rec))
+        {
+            channel_time[rec.channel] = rec.time;
+        }
+        uint64_t now64 = timebase_now();
+        uint64_t stale_counts = timebase_from_ms(&timebase, SAMPLE_STALE_MS);
+        for (ch = 0; ch < SAMPLE_CHANNELS; ch++)
+        {
+            if ((now64 - channel_time[ch]) > stale_counts)
+            {
+                stale = TELEMETRY_FLAG_STALE;
+            }
+        }
+        sample.seq = telemetry_seq++;
+        sample.time_ms = Clock_getTicks(); // Clock tick is 1 ms
+        sample.temperature_centi = (int16_t)sensor_to_units(env.temperature_avg, 100, -32768L, 32767L);
+        sample.humidity_centi = (uint16_t)sensor_to_units(env.humidity, 100, 0, 65535L);
+        sample.moisture_centi = (int16_t)sensor_to_units(moisture.water_content, 100, -32768L, 32767L);
+        sample.water_level_mm = (uint16_t)sensor_to_units(level.distance, 10, 0, 65535L);
+        sample.flags = (GpioDataRegs.GPADAT.bit.GPIO22 ? TELEMETRY_FLAG_PUMP_ON : 0) | (isrFlag1 ? TELEMETRY_FLAG_TANK_LOW : 0) | stale;
+#if SOIL_DUAL_CORE
+        ipc_cpu1_send_sample(&sample); // CPU2 encodes and transmits, a gap in seq shows a dropped sample
+#else
+        unsigned char *frame = (unsigned char *)uart_frame_acquire(); // encode straight into the free UART frame buffer
+        if (frame != NULL) // both frames still on the wire, skip this sample
+        {
+            uart_frame_submit(telemetry_encode(frame, &sample)); //ISR streams the frame while the next one is built
+        }
+#endif
         endTime = Timestamp_get32();
-        elapsedTimeuart = endTime - startTime; // collect total time elapsed from for TSK 2 //DB
+        profile_record(PROFILE_TSK2, endTime - startTime); // collect total time elapsed from for TSK 2 //DB
+#if !SOIL_DUAL_CORE
+        int16_t rx;
+        while ((rx = uart_rx_char()) >= 0) // the ESP32 asks for a dump with one command byte
+        {
+            if (rx == PROFILE_DUMP_COMMAND)
+            {
+                profile_dump_request = 1;
+            }
+            else if (rx == TRACE_DUMP_COMMAND)
+            {
+                trace_dump_request = 1;
+            }
+            else if (rx == BENCH_COMMAND)
+            {
+                bench_request = 1;
+            }
+            else if (rx == WINDOW_STATS_DUMP_COMMAND)
+            {
+                stats_dump_request = 1;
+            }
+        }
+        if (trace_dump_request)
+        {
+            trace_dump_request = 0;
+            trace_dump(); // before the profile dump adds its own frames to the trace
+        }
+        if (profile_dump_request)
+        {
+            profile_dump_request = 0;
+            profile_dump(); // outside the probe, it waits for the line
+        }
+        if (stats_dump_request)
+        {
+            stats_dump_request = 0;
+            stats_dump();
+        }
+        if (bench_request)
+        {
+            bench_request = 0;
+            bench_dump(); // last, the dumps above are not measured with the suite's load in them
+        }
+#endif
     }
 }
 
@@ -191,24 +559,22 @@ Void myTskFxn2(Void) //KH
 //Tsk function that is called to interface with I2C to collect Temp/Humidity data and DSP 
 Void myTskFxn(Void)
 {
+    UInt8 status = 0; //status of the sensor: read with 0x71 at start up, then the first byte of every reading //DB
     while (TRUE) {
-        Semaphore_pend(mySem, BIOS_WAIT_FOREVER); // wait for semaphore to be posted from timer0 
+        trace_sem_pend(mySem, BIOS_WAIT_FOREVER); // wait for semaphore to be posted from timer0 
         uint32_t startTime; 
         uint32_t endTime;
-        UInt8 status; //variable to collect status from sensor //DB
         UInt8 status_cmd = 0x71; //sending 0x71 as per datasheet to get status of sensor //DB
         startTime = Timestamp_get32(); // collect start time stamp to measure TSK 0 
-        // Step 1: Check sensor status once to initialize sensor //DB
+        // Step 1: Check sensor status once to initialize sensor, every reading refreshes it afterwards //DB
         if (once == 0){
-        i2c_master_transmit(DHT20_ADDRESS, &status_cmd, 1);
-        Task_sleep(20); // Short delay for transmission to complete
+        i2c_master_transmit(DHT20_ADDRESS, &status_cmd, 1); // transfers block until STOP, no settle delay needed
         i2c_master_receive(DHT20_ADDRESS, &status, 1);
-        Task_sleep(20); // Short delay for reception to complete
         once = 1;
         }
-        // Step 2: Initialize sensor if not correctly setup internally //DB
+        // Step 2: Initialize sensor if not correctly setup internally, a brown-out clears the calibration bits too //DB
 
-        if (status != 0x18) {
+        if ((status & 0x18) != 0x18) {
             resetRegister(0x1B);
             resetRegister(0x1C);
             resetRegister(0x1E);
@@ -217,77 +583,93 @@ Void myTskFxn(Void)
 
        // Step 3: Send measurement command to gather data
 
-       UInt8 measure_cmd = 0xAC; //send measurement command as per datasheet //DB
-       i2c_master_transmit(DHT20_ADDRESS, &measure_cmd, 1); 
+       UInt8 measure_cmd[3] = { 0xAC, 0x33, 0x00 }; //send measurement command and its parameters as per datasheet //DB
+       i2c_master_transmit(DHT20_ADDRESS, measure_cmd, 3);
        Task_sleep(80); // Wait for measurement to complete (as per data sheet)
 
        // Step 4: Read sensor data
 
        UInt8 data_rx[6]; // Array to store 6 bytes of data received from sensor
-       i2c_master_receive(DHT20_ADDRESS, data_rx, 6);
-       Task_sleep(20); // Short delay after reading data
-
-       // Extracting humidity from data_rx //DB
-
-       UInt32 upsizing = data_rx[1];
-       UInt32 SRH = (upsizing << 12) | (data_rx[2] << 4) | (data_rx[3] >> 4);
-       humidity = ((float)SRH / 1048576) * 100.0;
-
-       // Extracting temperature from data_rx //DB
-
-       UInt32 upsized = data_rx[3]; // converting UInt16 to UInt 32 to shift without data loss
-       UInt32 ST = ((upsized & 0x0F) << 16) | (data_rx[4] << 8) | data_rx[5];
-       temperature = ((float)ST / 1048576) * 200.0 - 50.0;
-
-       // storing values in circular buffer called temperature_buffer and implementing moving average filter //DB
-       // Subtract the oldest temperature from the sum if buffer is full //DB
-       if (num_samples == BUFFER_SIZE) {
-           sum -= temperature_buffer[counter_buffer];
+       bool received = i2c_master_receive(DHT20_ADDRESS, data_rx, 6);
+       bool valid = received && !(data_rx[0] & 0x80); // no answer, or busy bit: measurement not finished
+       if (received)
+       {
+           status = data_rx[0]; // checked in step 2 of the next cycle
        }
 
-       // Add new temperature to buffer
-       temperature_buffer[counter_buffer] = temperature;
+       if (valid) // data_rx holds no new reading, keep the last ones
+       {
+           // Extracting humidity from data_rx //DB
+
+           humidity = sensor_dht20_humidity(data_rx);
 
-       // Add new temperature to sum
-       sum += temperature;
+           // Extracting temperature from data_rx //DB
 
-       // Increment counter and wrap around if needed
-       counter_buffer = (counter_buffer + 1) % BUFFER_SIZE;
+           temperature = sensor_dht20_temperature(data_rx);
 
-       // Increment number of samples until the buffer is first filled
-       if (num_samples < BUFFER_SIZE) {
-           num_samples++;
+           // windowed statistics in integer units, the moving average no longer accumulates float error //DB
+           window_stats_push(&temperature_stats, sensor_to_units(temperature, 100, -32768L, 32767L));
+           window_stats_push(&humidity_stats, sensor_to_units(humidity, 100, 0, 65535L));
+           movingAverage = sensor_from_units(window_stats_mean(&temperature_stats), 100);
+           env_record_t env = { humidity, temperature, movingAverage };
+           snapshot_publish(&env_snapshot, &env); // humidity and temperature always reach Tsk2 as a pair
        }
-       // Calculate moving average
-       movingAverage = sum / (float)num_samples;
-       Semaphore_post(mySem2);
-       Semaphore_post(mySem);
+       uint16_t quality = valid ? SAMPLE_Q_OK : SAMPLE_Q_SENSOR_FAULT;
+       sample_record(SAMPLE_CH_TEMPERATURE, sensor_to_units(temperature, 100, -32768L, 32767L), quality);
+       sample_record(SAMPLE_CH_HUMIDITY, sensor_to_units(humidity, 100, 0, 65535L), quality);
+       trace_sem_post(mySem2);
+       trace_sem_post(mySem);
        endTime = Timestamp_get32();
-       elapsedTimei2c = endTime - startTime; // collect total elapsed time of TSK 0 //DB
+       profile_record(PROFILE_TSK0, endTime - startTime); // collect total elapsed time of TSK 0 //DB
     }
 }
 /* ========= myTskFxn1 ========== */
 //Tsk1 function that is called to interface with ultrasonic sensor and process results //DB
+//ePWM2 fires the trigger at ULTRASONIC_RATE_HZ, so the task only waits for ECAP_ISR
 Void myTskFxn1(Void) //DB
 {
+    uint16_t missed = 0; // consecutive ranging periods without an echo
+    uint32_t lastTick = Clock_getTicks();
     while (TRUE) {
         uint32_t startTime; 
         uint32_t endTime;
+        if (!trace_sem_pend(mySem1, ULTRASONIC_TIMEOUT_TICKS)) // wait for the echo from eCAP
+        {
+            ultrasonic_timeouts++;
+            if (++missed >= ULTRASONIC_MISS_LIMIT)
+            {
+                isrFlag1 = TRUE; // sensor silent, keep the pump off as if the tank were low
+            }
+            sample_record(SAMPLE_CH_DISTANCE, sensor_to_units(distance, 10, 0, 65535L), SAMPLE_Q_SENSOR_FAULT);
+            continue;
+        }
+        missed = 0;
         startTime = Timestamp_get32(); // collect start time stamp to measure TSK1 //DB
-        // Set trigger pin high
-        GpioDataRegs.GPBSET.bit.GPIO52 = 1;
-        // Delay for 10 Us
-        Task_sleep(10);
-        // Set trigger pin low
-        GpioDataRegs.GPBCLEAR.bit.GPIO52 = 1;
-
-        // distance calculated based on time and speed of sound
-        Semaphore_pend(mySem1, BIOS_WAIT_FOREVER); // wait for semaphore to be posted
-        distance = calculateDistance(ECAP_data); // calculate distance using data collected from eCAP
-        Semaphore_post(mySem1);
 
-        // check distance of water level to see if its within threshold
-        if (distance > WATER_LEVEL)
+        // both echoes go through the outlier check and median window, the first one came a period earlier
+        uint32_t now = Clock_getTicks();
+        uint32_t gap = now - lastTick;
+        lastTick = now;
+        int accepted = water_level_push(&tank_level, ultrasonic_echo[0], (gap > ULTRASONIC_PERIOD_MS) ? (gap - ULTRASONIC_PERIOD_MS) : 0);
+        accepted |= water_level_push(&tank_level, ultrasonic_echo[1], ULTRASONIC_PERIOD_MS);
+
+        // distance calculated based on time and speed of sound at the measured air temperature
+        env_record_t env;
+        snapshot_read(&env_snapshot, &env);
+        distance = water_level_cm(&tank_level, env.temperature_avg); // 20 C until the first DHT20 reading
+        window_stats_push(&distance_stats, sensor_to_units(distance, 10, 0, 65535L));
+
+        tank_volume = tank_volume_ml(distance);
+        tank_litres_left = tank_litres(tank_volume);
+        tank_pump_seconds_left = tank_pump_seconds(tank_volume);
+        level_record_t level = { distance, tank_volume };
+        snapshot_publish(&level_snapshot, &level);
+        sample_record(SAMPLE_CH_DISTANCE, sensor_to_units(distance, 10, 0, 65535L),
+                      SAMPLE_Q_FILTERED | (accepted ? 0 : SAMPLE_Q_REJECTED));
+        sample_record(SAMPLE_CH_TANK, (int32_t)tank_volume, SAMPLE_Q_FILTERED);
+
+        // check the volume left against the reserve the pump must not drain
+        if (tank_volume < TANK_RESERVE_ML)
         {
             isrFlag1 = TRUE;
         }
@@ -296,6 +678,6 @@ Void myTskFxn1(Void) //DB
             isrFlag1 = FALSE;
         }
         endTime = Timestamp_get32();
-        elapsedTimeultra = endTime - startTime; // collect total time elapsed for TSK 1
+        profile_record(PROFILE_TSK1, endTime - startTime); // collect total time elapsed for TSK 1
     }
 }
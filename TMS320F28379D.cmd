@@ -40,6 +40,9 @@ PAGE 0 :  /* Program Memory */
           /* BEGIN is used for the "boot to FLASH" bootloader mode   */
 
     D01SARAM   : origin = 0x00B000, length = 0x001000
+#ifdef MOISTURE_USE_CLA
+    RAMLS5     : origin = 0x00A800, length = 0x000800 /* CLA program */
+#endif
 
     /* Flash boot address */
     BEGIN   : origin = 0x080000, length = 0x000002
@@ -69,12 +72,19 @@ PAGE 1 : /* Data Memory */
 
     M01SARAM : origin = 0x000122, length = 0x0006DE  /* on-chip RAM */
 
+#ifdef MOISTURE_USE_CLA
+    LS05SARAM : origin = 0x008000, length = 0x002000 /* LS0-LS3, LS4/LS5 belong to the CLA */
+    RAMLS4    : origin = 0x00A000, length = 0x000800 /* CLA data */
+    CLA1_MSGRAMLOW  : origin = 0x001480, length = 0x000080
+    CLA1_MSGRAMHIGH : origin = 0x001500, length = 0x000080
+#else
     LS05SARAM : origin = 0x008000, length = 0x003000 /* on-chip RAM */
+#endif
 
     /* on-chip Global shared RAMs */
     RAMGS0  : origin = 0x00C000, length = 0x001000
     RAMGS1  : origin = 0x00D000, length = 0x001000
-    RAMGS2  : origin = 0x00E000, length = 0x001000
+    RAMGS2  : origin = 0x00E000, length = 0x001000 /* CPU1 -> CPU2 sample ring */
     RAMGS3  : origin = 0x00F000, length = 0x001000
     RAMGS4  : origin = 0x010000, length = 0x001000
     RAMGS5  : origin = 0x011000, length = 0x001000
@@ -86,8 +96,7 @@ PAGE 1 : /* Data Memory */
     RAMGS11 : origin = 0x017000, length = 0x001000
     RAMGS12 : origin = 0x018000, length = 0x001000
     RAMGS13 : origin = 0x019000, length = 0x001000
-    RAMGS14 : origin = 0x01A000, length = 0x001000
-    RAMGS15 : origin = 0x01B000, length = 0x001000
+    RAMGS14_15 : origin = 0x01A000, length = 0x002000 /* GS14 + GS15, holds the moisture LUT */
 
     /* Shared MessageRam */
     CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
@@ -167,10 +176,42 @@ SECTIONS
                             FLASHF | FLASHG | FLASHH | FLASHI | FLASHJ |
                             FLASHK | FLASHL | FLASHM | FLASHN PAGE = 0
 
-    Filter_RegsFile     : > RAMGS0 | RAMGS1 | RAMGS2 | RAMGS3 | RAMGS4 |
+    Filter_RegsFile     : > RAMGS0 | RAMGS1 | RAMGS3 | RAMGS4 |
                             RAMGS5 | RAMGS6 | RAMGS7 | RAMGS8 | RAMGS9 |
-                            RAMGS10 | RAMGS11 | RAMGS12 | RAMGS13 | RAMGS14 |
-                            RAMGS15 PAGE = 1
+                            RAMGS10 | RAMGS11 | RAMGS12 | RAMGS13 PAGE = 1
+
+    /* Moisture ADC ping-pong buffer (adc_dma.c), must be DMA accessible GS RAM */
+    AdcDmaBufFile       : > RAMGS1 PAGE = 1
+
+    /* ADC code -> water content table (moisture_lut.c). Link with
+       --define=MOISTURE_LUT_IN_RAM to copy it to GS RAM at boot for
+       zero wait-state lookups, otherwise it is read from flash. */
+#ifdef MOISTURE_LUT_IN_RAM
+    MoistureLutFile     : LOAD = FLASHF | FLASHG | FLASHH PAGE = 0,
+                          RUN  = RAMGS14_15 PAGE = 1,
+                          table(BINIT)
+#else
+    MoistureLutFile     : > FLASHF | FLASHG | FLASHH PAGE = 0
+#endif
+
+    /* CLA moisture task (moisture_cla_tasks.cla), link with --define=MOISTURE_USE_CLA.
+       The program is copied from flash to LS5 at boot, before LS5 is given to the CLA. */
+#ifdef MOISTURE_USE_CLA
+    Cla1Prog            : LOAD = FLASHB | FLASHC | FLASHD PAGE = 0,
+                          RUN  = RAMLS5 PAGE = 0,
+                          table(BINIT)
+    .const_cla          : LOAD = FLASHB | FLASHC | FLASHD PAGE = 0,
+                          RUN  = RAMLS4 PAGE = 1,
+                          table(BINIT)
+    .scratchpad         : > RAMLS4 PAGE = 1
+    .bss_cla            : > RAMLS4 PAGE = 1
+    Cla1DataRam         : > RAMLS4 PAGE = 1
+    Cla1ToCpuMsgRAM     : > CLA1_MSGRAMLOW PAGE = 1
+    CpuToCla1MsgRAM     : > CLA1_MSGRAMHIGH PAGE = 1
+#endif
+
+    /* CPU1 -> CPU2 sample ring (ipc_ring.h), CPU2 finds it at this fixed address */
+    IpcRingFile         : > 0x00E000 PAGE = 1, TYPE = NOINIT
 
     /* The following section definitions are required when using the IPC API Drivers */
     GROUP : > CPU1TOCPU2RAM, PAGE = 1
@@ -0,0 +1,82 @@
+/*
+ * adc_config.h
+ *
+ * Build-time configuration of the soil moisture acquisition on ADC-A channel A5,
+ * shared by DeviceInit() and the ADC interrupt path.
+ */
+
+#ifndef ADC_CONFIG_H_
+#define ADC_CONFIG_H_
+
+#define MOISTURE_ADC_CHANNEL 5 //A5
+#define MOISTURE_ADC_ACQPS 139 //acquisition window in SYSCLK cycles
+#define MOISTURE_ADC_TRIGSEL 2 //CPU1 Timer 1
+
+//Oversampling: every Timer1 trigger fires SOC0..SOC(N-1) on A5 back to back and ADCINT1
+//follows the last EOC. myHwi averages the N results with a shift. N = 1 << ADC_OVERSAMPLE_LOG2.
+#ifndef ADC_OVERSAMPLE_LOG2
+#define ADC_OVERSAMPLE_LOG2 3
+#endif
+
+#if (ADC_OVERSAMPLE_LOG2 < 0) || (ADC_OVERSAMPLE_LOG2 > 4)
+#error "ADC_OVERSAMPLE_LOG2 must be 0..4 (1 to 16 SOCs)"
+#endif
+
+#define ADC_OVERSAMPLE (1 << ADC_OVERSAMPLE_LOG2)
+
+//CLA mode: ADCINT1 starts CLA task 1, which averages the burst, filters it and decides the pump
+//state (moisture_ctrl.h). The CPU only gets the task-end interrupt. Also define MOISTURE_USE_CLA
+//for the linker, TMS320F28379D.cmd hands LS4/LS5 to the CLA.
+#ifndef MOISTURE_USE_CLA
+#define MOISTURE_USE_CLA 0
+#endif
+
+//DMA block mode: ADCINT1 triggers DMA CH1, which copies each burst into a ping-pong buffer in GS RAM.
+//ADC_DMA_ISR posts Swi0 once per block of 2^ADC_DMA_BLOCK_LOG2 triggers and myHwi stays disabled.
+//ADC_USE_DMA=0 keeps the per-trigger myHwi path. Off by default: the host shim has no DMA model,
+//so no scenario runs this path, and moisture_ctrl_step runs once per block here, which stretches
+//the filter and hysteresis time constant by ADC_DMA_BLOCK.
+#ifndef ADC_USE_DMA
+#define ADC_USE_DMA 0
+#endif
+#ifndef ADC_DMA_BLOCK_LOG2
+#define ADC_DMA_BLOCK_LOG2 2
+#endif
+
+#if (ADC_DMA_BLOCK_LOG2 < 0) || (ADC_DMA_BLOCK_LOG2 > 6)
+#error "ADC_DMA_BLOCK_LOG2 must be 0..6 (1 to 64 triggers per block)"
+#endif
+
+#if ADC_USE_DMA && MOISTURE_USE_CLA
+#error "ADC_USE_DMA and MOISTURE_USE_CLA both consume ADCINT1, pick one"
+#endif
+
+#define ADC_DMA_BLOCK (1 << ADC_DMA_BLOCK_LOG2)
+#define ADC_DMA_BLOCK_WORDS (ADC_OVERSAMPLE * ADC_DMA_BLOCK) //results per ping-pong half
+
+//Multi-rate moisture pipeline (decimator.h): every trigger's averaged code -> CIC -> FIR -> aggregate.
+//With the 2 Hz Timer1 trigger the defaults publish at 1 Hz, every 10 s and every minute.
+#ifndef MOISTURE_CIC_ORDER
+#define MOISTURE_CIC_ORDER 3
+#endif
+#ifndef MOISTURE_CIC_RATIO
+#define MOISTURE_CIC_RATIO 2
+#endif
+#ifndef MOISTURE_FIR_TAPS
+#define MOISTURE_FIR_TAPS 20
+#endif
+#ifndef MOISTURE_FIR_RATIO
+#define MOISTURE_FIR_RATIO 10
+#endif
+#ifndef MOISTURE_AGGREGATE
+#define MOISTURE_AGGREGATE 6 //FIR outputs per summary
+#endif
+
+#if (MOISTURE_CIC_ORDER < 1) || (MOISTURE_CIC_ORDER > 4) || (MOISTURE_CIC_RATIO < 1) || (MOISTURE_CIC_RATIO > 64)
+#error "MOISTURE_CIC_ORDER must be 1..4 and MOISTURE_CIC_RATIO 1..64"
+#endif
+#if (MOISTURE_FIR_TAPS > 64) || (((MOISTURE_FIR_TAPS + MOISTURE_FIR_RATIO - 1) / MOISTURE_FIR_RATIO) > 16)
+#error "MOISTURE_FIR_TAPS must be at most 64 and at most 16 * MOISTURE_FIR_RATIO"
+#endif
+
+#endif /* ADC_CONFIG_H_ */
@@ -0,0 +1,65 @@
+// Thie file contains the DMA CH1 setup that copies the moisture ADC bursts into a ping-pong buffer
+// in GS RAM (ADC_USE_DMA=1). One transfer = one block of ADC_DMA_BLOCK bursts.
+
+#include <Headers/F2837xD_device.h>
+#include "adc_config.h"
+#include "adc_dma.h"
+
+#define DMA_TRIGGER_ADCA1 1 //DMACHSRCSELx value for ADCAINT1
+
+//both halves, placed in GS RAM by TMS320F28379D.cmd (the DMA cannot reach M0/M1 or LS RAM)
+#pragma DATA_SECTION(adc_dma_buffer, "AdcDmaBufFile")
+static uint16_t adc_dma_buffer[2][ADC_DMA_BLOCK_WORDS];
+static uint16_t adc_dma_fill = 0; //half the current transfer writes into
+
+void adc_dma_init(void)
+{
+    EALLOW;
+    CpuSysRegs.PCLKCR0.bit.DMA = 1; //enable DMA clock
+    DmaRegs.DMACTRL.bit.HARDRESET = 1;
+    __asm(" NOP"); //reset needs one cycle
+    DmaRegs.DEBUGCTRL.bit.FREE = 1; //keep running on a debugger halt
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = DMA_TRIGGER_ADCA1;
+
+    //burst: ADCRESULT0..N-1 -> N consecutive words, then back to ADCRESULT0 for the next trigger
+    DmaRegs.CH1.BURST_SIZE.all = ADC_OVERSAMPLE - 1;
+    DmaRegs.CH1.SRC_BURST_STEP = 1;
+    DmaRegs.CH1.DST_BURST_STEP = 1;
+    DmaRegs.CH1.TRANSFER_SIZE = ADC_DMA_BLOCK - 1;
+    DmaRegs.CH1.SRC_TRANSFER_STEP = -(ADC_OVERSAMPLE - 1);
+    DmaRegs.CH1.DST_TRANSFER_STEP = 1;
+    DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF; //wrap is not used
+    DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+
+    //shadow registers are copied to the active ones at the start of every transfer
+    DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = (Uint32)&AdcaResultRegs.ADCRESULT0;
+    DmaRegs.CH1.SRC_ADDR_SHADOW = (Uint32)&AdcaResultRegs.ADCRESULT0;
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (Uint32)adc_dma_buffer[0];
+    DmaRegs.CH1.DST_ADDR_SHADOW = (Uint32)adc_dma_buffer[0];
+    adc_dma_fill = 0;
+
+    DmaRegs.CH1.MODE.all = 0;
+    DmaRegs.CH1.MODE.bit.PERINTSEL = 1;   //must match the channel number on F2837xD
+    DmaRegs.CH1.MODE.bit.PERINTE = 1;     //run one burst per ADCAINT1
+    DmaRegs.CH1.MODE.bit.CONTINUOUS = 1;  //re-arm after every transfer
+    DmaRegs.CH1.MODE.bit.CHINTMODE = 1;   //interrupt at the end of the transfer, i.e. once per block
+    DmaRegs.CH1.MODE.bit.CHINTE = 1;
+    DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1; //drop any trigger latched before the channel was set up
+    DmaRegs.CH1.CONTROL.bit.ERRCLR = 1;
+    DmaRegs.CH1.CONTROL.bit.RUN = 1;
+    EDIS;
+}
+
+const uint16_t *adc_dma_swap(void)
+{
+    uint16_t done = adc_dma_fill;
+
+    //the next transfer starts on the next ADCAINT1 and loads the shadow, so this must run
+    //within one trigger period of the end of the block
+    adc_dma_fill ^= 1;
+    EALLOW;
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (Uint32)adc_dma_buffer[adc_dma_fill];
+    DmaRegs.CH1.DST_ADDR_SHADOW = (Uint32)adc_dma_buffer[adc_dma_fill];
+    EDIS;
+    return adc_dma_buffer[done];
+}
@@ -0,0 +1,33 @@
+/*
+ * adc_dma.h
+ *
+ * DMA CH1 moves every moisture ADC burst from ADCRESULT0..N-1 into one half of a
+ * ping-pong buffer in GS RAM. The channel interrupts once per block (end of transfer),
+ * the CPU reduces the finished half while the DMA fills the other one.
+ * adc_block_mean() is plain C so the host model in host/adc_dma_model.c shares it.
+ */
+
+#ifndef ADC_DMA_H_
+#define ADC_DMA_H_
+
+#include <stdint.h>
+
+//mean of 2^log2_words ADC results, log2_words <= 20 keeps the 12-bit sum in 32 bits
+static inline uint16_t adc_block_mean(const uint16_t *block, uint16_t log2_words)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < ((uint32_t)1 << log2_words); i++)
+    {
+        sum += block[i];
+    }
+    return (uint16_t)(sum >> log2_words);
+}
+
+void adc_dma_init(void); //configure and start CH1, call after DeviceInit()
+//From the DMA CH1 interrupt: points the next transfer at the other half and returns
+//the half that just completed. It stays valid until the following block completes.
+const uint16_t *adc_dma_swap(void);
+
+#endif /* ADC_DMA_H_ */
@@ -0,0 +1,217 @@
+// Thie file contains the microbenchmark cases of the per-sample hot paths and their UART frames (bench.h)
+// The state and window sizes of every case match what SoilMonitor_main.c gives the live threads.
+
+#include "bench.h"
+#include "adc_config.h"
+#include "adc_dma.h"
+#include "sensor_math.h"
+#include "decimator.h"
+#include "window_stats.h"
+#include "water_level.h"
+#include "tank_model.h"
+#include "telemetry.h"
+
+#define BENCH_INPUTS 8                  //input sets cycled through, power of two
+#define BENCH_INPUT_MASK (BENCH_INPUTS - 1)
+#define BENCH_ENV_WINDOW 64             //BUFFER_SIZE
+#define BENCH_MOISTURE_WINDOW 32        //MOISTURE_WINDOW
+#define BENCH_PERIOD_MS 100             //ULTRASONIC_PERIOD_MS at the default rate
+
+const char *const bench_names[BENCH_CASES] = { "empty", "adc_mean", "moisture", "decimator", "moist_stats",
+                                               "dht20", "env_stats", "distance", "tank", "telemetry" };
+
+static uint16_t adc_bursts[BENCH_INPUTS * ADC_OVERSAMPLE];
+static unsigned char dht20_frames[BENCH_INPUTS][6];
+static uint32_t echo_widths[BENCH_INPUTS];
+static decim_channel_t decim;
+static int32_t moisture_window[WINDOW_STATS_WORDS(BENCH_MOISTURE_WINDOW)];
+static int32_t temperature_window[WINDOW_STATS_WORDS(BENCH_ENV_WINDOW)];
+static int32_t humidity_window[WINDOW_STATS_WORDS(BENCH_ENV_WINDOW)];
+static window_stats_t moisture_stats;
+static window_stats_t temperature_stats;
+static window_stats_t humidity_stats;
+static water_level_t level;
+static telemetry_sample_t sample;
+static unsigned char frame[TELEMETRY_FRAME_SIZE];
+static volatile uint32_t sink;          //keeps the timed calls from being optimised out
+
+typedef uint32_t (*bench_case_fxn)(uint16_t i);
+
+static uint32_t case_empty(uint16_t i)
+{
+    return i;
+}
+
+static uint32_t case_adc_mean(uint16_t i)
+{
+    return adc_block_mean(&adc_bursts[(i & BENCH_INPUT_MASK) * ADC_OVERSAMPLE], ADC_OVERSAMPLE_LOG2);
+}
+
+static uint32_t case_moisture(uint16_t i)
+{
+    uint16_t code = adc_bursts[i & BENCH_INPUT_MASK];
+    sensor_t volts = sensor_adc_to_volts(code);
+    sensor_t water = sensor_water_content(code);
+
+    return (uint32_t)sensor_to_units(volts, 1000, 0, 65535L) + (uint32_t)sensor_to_units(water, 100, -32768L, 32767L);
+}
+
+static uint32_t case_decimator(uint16_t i)
+{
+    return decim_channel_push(&decim, adc_bursts[i & BENCH_INPUT_MASK]);
+}
+
+static uint32_t case_moist_stats(uint16_t i)
+{
+    window_stats_push(&moisture_stats, 2000 + (int32_t)(adc_bursts[i & BENCH_INPUT_MASK] & 0x3FF));
+    return (uint32_t)window_stats_count(&moisture_stats);
+}
+
+static uint32_t case_dht20(uint16_t i)
+{
+    const unsigned char *data = dht20_frames[i & BENCH_INPUT_MASK];
+    sensor_t humidity = sensor_dht20_humidity(data);
+    sensor_t temperature = sensor_dht20_temperature(data);
+
+    return (uint32_t)sensor_to_units(humidity, 100, 0, 65535L) + (uint32_t)sensor_to_units(temperature, 100, -32768L, 32767L);
+}
+
+static uint32_t case_env_stats(uint16_t i)
+{
+    int32_t t = 2000 + (int32_t)(i & 0xFF);
+
+    window_stats_push(&temperature_stats, t);
+    window_stats_push(&humidity_stats, 4500 - (int32_t)(i & 0xFF));
+    return (uint32_t)sensor_to_units(sensor_from_units(window_stats_mean(&temperature_stats), 100), 100, -32768L, 32767L);
+}
+
+static uint32_t case_distance(uint16_t i)
+{
+    int accepted = water_level_push(&level, echo_widths[i & BENCH_INPUT_MASK], BENCH_PERIOD_MS);
+
+    accepted |= water_level_push(&level, echo_widths[(i + 1) & BENCH_INPUT_MASK], BENCH_PERIOD_MS);
+    return (uint32_t)sensor_to_units(water_level_cm(&level, SENSOR(22)), 10, 0, 65535L) + (uint32_t)accepted;
+}
+
+static uint32_t case_tank(uint16_t i)
+{
+    sensor_t distance = sensor_from_units(80 + (int32_t)(i & 0x3F), 10); //8 to 14.3 cm
+    uint32_t volume = tank_volume_ml(distance);
+
+    return volume + tank_pump_seconds(volume) + (uint32_t)sensor_to_units(tank_litres(volume), 1000, 0, 65535L);
+}
+
+static uint32_t case_telemetry(uint16_t i)
+{
+    sample.seq = i;
+    sample.time_ms += 100;
+    sample.moisture_centi = (int16_t)(3000 + (i & 0xFF));
+    return telemetry_encode(frame, &sample);
+}
+
+static const bench_case_fxn cases[BENCH_CASES] = { case_empty, case_adc_mean, case_moisture, case_decimator,
+                                                   case_moist_stats, case_dht20, case_env_stats, case_distance,
+                                                   case_tank, case_telemetry };
+
+//fixed pseudo random inputs, the same on every run and target
+static uint16_t bench_lcg(uint32_t *state)
+{
+    *state = *state * 1103515245UL + 12345UL;
+    return (uint16_t)((*state >> 16) & 0x7FFF);
+}
+
+void bench_init(void)
+{
+    uint32_t state = 1;
+    uint16_t i;
+
+    for (i = 0; i < BENCH_INPUTS * ADC_OVERSAMPLE; i++)
+    {
+        adc_bursts[i] = 3000 + (bench_lcg(&state) % 600); //about 25 to 40 % water content
+    }
+    for (i = 0; i < BENCH_INPUTS; i++)
+    {
+        uint32_t rh = 0x60000UL + (bench_lcg(&state) & 0x3FFF); //about 37 %RH
+        uint32_t t = 0x5C000UL + (bench_lcg(&state) & 0x3FFF);  //about 22 C
+        dht20_frames[i][0] = 0x18;
+        dht20_frames[i][1] = (unsigned char)((rh >> 12) & 0xFF);
+        dht20_frames[i][2] = (unsigned char)((rh >> 4) & 0xFF);
+        dht20_frames[i][3] = (unsigned char)(((rh & 0x0F) << 4) | ((t >> 16) & 0x0F));
+        dht20_frames[i][4] = (unsigned char)((t >> 8) & 0xFF);
+        dht20_frames[i][5] = (unsigned char)(t & 0xFF);
+        echo_widths[i] = (uint32_t)(10.0 * ECHO_COUNTS_PER_CM) + (bench_lcg(&state) % 2000); //10 cm, 2 mm jitter
+    }
+    decim_channel_init(&decim, MOISTURE_CIC_ORDER, MOISTURE_CIC_RATIO, MOISTURE_FIR_TAPS, MOISTURE_FIR_RATIO,
+                       MOISTURE_AGGREGATE);
+    window_stats_init(&moisture_stats, moisture_window, BENCH_MOISTURE_WINDOW);
+    window_stats_init(&temperature_stats, temperature_window, BENCH_ENV_WINDOW);
+    window_stats_init(&humidity_stats, humidity_window, BENCH_ENV_WINDOW);
+    water_level_init(&level);
+    sample.seq = 0;
+    sample.time_ms = 0;
+    sample.temperature_centi = 2200;
+    sample.humidity_centi = 4500;
+    sample.moisture_centi = 3000;
+    sample.water_level_mm = 1000;
+    sample.flags = 0;
+}
+
+void bench_run(uint16_t bench_case, uint16_t samples, bench_counter_fxn counter, profile_probe_t *probe)
+{
+    bench_case_fxn fxn = cases[bench_case];
+    uint16_t call = 0;
+    uint16_t s;
+    uint16_t b;
+
+    for (b = 0; b < BENCH_BATCH; b++)
+    {
+        sink += fxn(call++); //warm up: windows filled, caches and branch predictors on the host
+    }
+    for (s = 0; s < samples; s++)
+    {
+        uint32_t start = counter();
+        for (b = 0; b < BENCH_BATCH; b++)
+        {
+            sink += fxn(call++);
+        }
+        profile_record_probe(probe, counter() - start);
+    }
+}
+
+//header and CRC around the payload that ends at q
+static uint16_t bench_finish(unsigned char *frame, unsigned char *q)
+{
+    return telemetry_frame_finish(frame, BENCH_SYNC0, BENCH_SYNC1, BENCH_VERSION,
+                                  (uint16_t)(q - frame) - BENCH_HEADER_SIZE);
+}
+
+uint16_t bench_encode_start(unsigned char *frame, uint32_t counter_hz)
+{
+    unsigned char *q = frame + BENCH_HEADER_SIZE;
+
+    *q++ = BENCH_KIND_START;
+    *q++ = BENCH_CASES;
+    q = telemetry_put_u16(q, BENCH_BATCH);
+    q = telemetry_put_u32(q, counter_hz);
+    return bench_finish(frame, q);
+}
+
+uint16_t bench_encode_result(unsigned char *frame, uint16_t bench_case, const profile_probe_t *probe)
+{
+    unsigned char *q = frame + BENCH_HEADER_SIZE;
+    const char *name = bench_names[bench_case];
+    uint16_t i;
+
+    *q++ = BENCH_KIND_RESULT;
+    *q++ = bench_case & 0xFF;
+    q = telemetry_put_u32(q, probe->count);
+    q = telemetry_put_u32(q, probe->min);
+    q = telemetry_put_u32(q, probe->max);
+    q = telemetry_put_u32(q, (uint32_t)probe->sum);
+    q = telemetry_put_u32(q, (uint32_t)(probe->sum >> 32));
+    for (i = 0; i < BENCH_NAME_SIZE; i++)
+    {
+        *q++ = (*name != '\0') ? (unsigned char)*name++ : 0;
+    }
+    return bench_finish(frame, q);
+}
@@ -0,0 +1,78 @@
+/*
+ * bench.h
+ *
+ * Microbenchmarks of the per-sample hot paths: the same functions myHwi, mySwiFxn and the
+ * tasks call, run on private state and a table of varied inputs so the live readings are not
+ * touched. Each case times BENCH_BATCH calls per sample with the counter the caller passes
+ * (Timestamp_get32 on the target, the TSC on the host) and records the batch into a
+ * profile_probe_t (profile.h). The minimum per call is the figure to compare between builds:
+ * preemption only ever adds to a sample.
+ *
+ * 'B' on SCIB runs the suite in Tsk2 and sends the results; host/bench_suite runs it on the
+ * PC, or decodes a capture of the target's frames, and checks both against a baseline file.
+ * tank_model_init() must have run before bench_run().
+ *
+ * Frames (little endian, one octet per char on the C28x), each fits in UART_FRAME_SIZE:
+ *   [0..1]  sync 0xA5 0x5B
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload: kind u8, then
+ *           BENCH_KIND_START:  cases u8, calls per sample u16, counter rate u32 (Hz)
+ *           BENCH_KIND_RESULT: case u8, samples u32, min u32, max u32, sum u64 (counts per
+ *                              sample of BENCH_BATCH calls), name (BENCH_NAME_SIZE, NUL padded)
+ *   [last2] CRC-16/CCITT-FALSE over version..payload (telemetry_crc16)
+ * Plain C so the host tools build it as well.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+#include "profile.h"
+
+//cases, in the order of the sample's path through the threads
+#define BENCH_EMPTY 0        //the loop and the counter reads, the floor of every other case
+#define BENCH_ADC_MEAN 1     //myHwi: burst average
+#define BENCH_MOISTURE 2     //mySwiFxn: code to volts and water content
+#define BENCH_DECIMATOR 3    //mySwiFxn: CIC / FIR / aggregate push
+#define BENCH_MOIST_STATS 4  //mySwiFxn: moisture window
+#define BENCH_DHT20 5        //myTskFxn: humidity and temperature decode
+#define BENCH_ENV_STATS 6    //myTskFxn: windows and moving average
+#define BENCH_DISTANCE 7     //myTskFxn1: two echoes through the estimator, distance
+#define BENCH_TANK 8         //myTskFxn1: volume, litres, pump seconds
+#define BENCH_TELEMETRY 9    //myTskFxn2: frame encode
+#define BENCH_CASES 10
+
+#ifndef BENCH_BATCH
+#define BENCH_BATCH 16       //calls per timed sample
+#endif
+#define BENCH_SAMPLES 256    //samples per case on the target
+
+#define BENCH_COMMAND 0x42   //'B' received on SCIB runs the suite
+#define BENCH_SYNC0 0xA5
+#define BENCH_SYNC1 0x5B
+#define BENCH_VERSION 1
+#define BENCH_HEADER_SIZE 4
+#define BENCH_CRC_SIZE 2
+#define BENCH_KIND_START 0
+#define BENCH_KIND_RESULT 1
+#define BENCH_NAME_SIZE 12
+#define BENCH_START_PAYLOAD 8
+#define BENCH_RESULT_PAYLOAD (2 + 4 + 4 + 4 + 8 + BENCH_NAME_SIZE)
+#define BENCH_FRAME_MAX (BENCH_HEADER_SIZE + BENCH_RESULT_PAYLOAD + BENCH_CRC_SIZE)
+
+typedef uint32_t (*bench_counter_fxn)(void);
+
+extern const char *const bench_names[BENCH_CASES];
+
+//Resets the private state of every case
+void bench_init(void);
+//Times samples batches of case bench_case into probe (emptied with profile_probe_init, or accumulating)
+void bench_run(uint16_t bench_case, uint16_t samples, bench_counter_fxn counter, profile_probe_t *probe);
+
+//Writes the start frame (at least BENCH_FRAME_MAX elements), returns its length
+uint16_t bench_encode_start(unsigned char *frame, uint32_t counter_hz);
+//Writes the result frame of one case, returns its length
+uint16_t bench_encode_result(unsigned char *frame, uint16_t bench_case, const profile_probe_t *probe);
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,63 @@
+// Thie file contains the CPU1 side of the CPU1 -> CPU2 telemetry hand-off (SOIL_DUAL_CORE=1)
+// CPU2 boot and peripheral hand-over follow the F2837xD boot ROM IPC protocol.
+
+#include <Headers/F2837xD_device.h>
+#include "28379D_uart.h"
+#include "cpu1_ipc.h"
+
+#if SOIL_DUAL_CORE
+
+//CPU2 boot ROM protocol
+#define C2_BOOTROM_BOOTSTS_SYSTEM_READY     0x00000002UL
+#define C1C2_BROM_BOOTMODE_BOOT_FROM_FLASH  0x0000000BUL
+#define BROM_IPC_EXECUTE_BOOTMODE_CMD       0x00000013UL
+
+//placed at IPC_RING_TX_ADDR by TMS320F28379D.cmd, CPU2 reads it there
+#pragma DATA_SECTION(ipc_ring_tx, "IpcRingFile")
+ipc_ring_tx_t ipc_ring_tx;
+//read count owned by CPU2 (CPU2TOCPU1RAM)
+#define ipc_ring_rx (*(const ipc_ring_rx_t *)IPC_RING_RX_ADDR)
+
+static void ipc_boot_cpu2(void)
+{
+    while (IpcRegs.IPCBOOTSTS != C2_BOOTROM_BOOTSTS_SYSTEM_READY) //CPU2 boot ROM not up yet
+    {
+    }
+    while ((IpcRegs.IPCFLG.bit.IPC0 == 1) || (IpcRegs.IPCFLG.bit.IPC31 == 1)) //previous command not taken
+    {
+    }
+    IpcRegs.IPCBOOTMODE = C1C2_BROM_BOOTMODE_BOOT_FROM_FLASH;
+    IpcRegs.IPCSENDCOM = BROM_IPC_EXECUTE_BOOTMODE_CMD;
+    IpcRegs.IPCSET.all = 0x80000001UL; //IPC31 + IPC0 hand the command to the boot ROM
+}
+
+void ipc_cpu1_init(void)
+{
+    ipc_ring_tx_init(&ipc_ring_tx); //before CPU2 can look at it
+    uart_pin_init();
+    EALLOW;
+    DevCfgRegs.CPUSEL5.bit.SCI_B = 1; //SCIB belongs to CPU2
+    EDIS;
+    ipc_boot_cpu2();
+}
+
+bool ipc_cpu1_send_sample(const telemetry_sample_t *sample)
+{
+    ipc_msg_t msg;
+
+    if (IpcRegs.IPCSTS.bit.IPC2 == 0) //CPU2 has not initialised its read count yet
+    {
+        return false;
+    }
+    msg.type = IPC_MSG_SAMPLE;
+    msg.reserved = 0;
+    msg.sample = *sample;
+    if (!ipc_ring_push(&ipc_ring_tx, &ipc_ring_rx, &msg))
+    {
+        return false; //counted in ipc_ring_tx.dropped
+    }
+    IpcRegs.IPCSET.bit.IPC1 = 1; //IPC_FLAG_SAMPLE, CPU2 acks it in its IPC1 Hwi
+    return true;
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * cpu1_ipc.h
+ *
+ * CPU1 side of the dual-core split (SOIL_DUAL_CORE=1): CPU1 keeps sensing and control,
+ * CPU2 (cpu2/) owns telemetry encoding and SCIB. Samples cross in the ipc_ring.h ring,
+ * IPC flag 1 tells CPU2 there is something to read.
+ *
+ * Not usable yet: the tree has no project that builds the CPU2 image, and without it CPU2
+ * never reports ready, so CPU1 drops every sample and sends no telemetry.
+ */
+
+#ifndef CPU1_IPC_H_
+#define CPU1_IPC_H_
+
+#include <stdbool.h>
+#include "ipc_ring.h"
+
+#ifndef SOIL_DUAL_CORE
+#define SOIL_DUAL_CORE 0
+#endif
+
+extern ipc_ring_tx_t ipc_ring_tx;
+
+//Hands SCIB to CPU2, muxes its pins, clears the ring and boots CPU2 from flash.
+//Call after DeviceInit(), blocks until the CPU2 boot ROM is ready.
+void ipc_cpu1_init(void);
+//Queues one sample for CPU2 and rings IPC1. Returns false until CPU2 reports ready
+//and whenever CPU2 is a full ring behind.
+bool ipc_cpu1_send_sample(const telemetry_sample_t *sample);
+
+#endif /* CPU1_IPC_H_ */
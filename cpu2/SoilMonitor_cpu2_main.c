@@ -0,0 +1,77 @@
+// Filename:            SoilMonitor_cpu2_main.c
+//
+// Description:         CPU2 image for SOIL_DUAL_CORE=1. Receives sample records from CPU1 through the
+//                      IPC ring (ipc_ring.h), encodes the telemetry frames and owns SCIB.
+//                      There is no CPU2 project in this tree (the root project excludes cpu2/):
+//                      one has to be set up by hand with this file, ../28379D_uart.c,
+//                      ../telemetry.c, ../ipc_ring.c and ../F2837xD_GlobalVariableDefs.c, CPU2
+//                      predefined, the project root on the include path, app_cpu2.cfg and
+//                      TMS320F28379D_cpu2.cmd. Until then SOIL_DUAL_CORE=1 is not usable.
+//
+// Target:              TMS320F28379D (CPU2)
+
+//defines:
+#define xdc__strict //suppress typedef warnings
+
+//includes:
+#include <xdc/std.h>
+#include <stdint.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include "28379D_uart.h"
+#include "telemetry.h"
+#include "ipc_ring.h"
+#include <Headers/F2837xD_device.h>
+
+//Semaphore handle defined in .cfg File:
+extern const Semaphore_Handle ipcSem;
+
+//read count, placed at IPC_RING_RX_ADDR by TMS320F28379D_cpu2.cmd
+#pragma DATA_SECTION(ipc_ring_rx, "IpcRingAckFile")
+ipc_ring_rx_t ipc_ring_rx;
+//slots and write count owned by CPU1 (GS RAM, read only here)
+#define ipc_ring_tx (*(const ipc_ring_tx_t *)IPC_RING_TX_ADDR)
+
+/* ======== main ======== */
+Int main()
+{
+    ipc_ring_rx_init(&ipc_ring_rx);
+    uart_init(115200UL); // CPU1 has muxed the pins and handed SCIB over
+    IpcRegs.IPCSET.bit.IPC2 = 1; // IPC_FLAG_CPU2_READY, CPU1 starts pushing samples
+    //jump to RTOS (does not return):
+    BIOS_start();
+    return(0);
+}
+
+/* ======== IPC1_ISR ======== */
+//Hwi function called when CPU1 sets IPC_FLAG_SAMPLE after publishing records
+Void IPC1_ISR(UArg arg)
+{
+    IpcRegs.IPCACK.bit.IPC1 = 1;
+    Semaphore_post(ipcSem);
+}
+
+/* ========= telemetryTskFxn ========== */
+//Task that drains the ring, one telemetry frame per sample record
+Void telemetryTskFxn(Void)
+{
+    ipc_msg_t msg;
+
+    while (TRUE) {
+        Semaphore_pend(ipcSem, BIOS_WAIT_FOREVER); // wait for CPU1
+        while (ipc_ring_count(&ipc_ring_tx, &ipc_ring_rx) != 0)
+        {
+            unsigned char *frame = (unsigned char *)uart_frame_acquire();
+            if (frame == NULL) // both frames on the wire, records stay in the ring until one is free
+            {
+                Task_sleep(1);
+                continue;
+            }
+            if (ipc_ring_pop(&ipc_ring_tx, &ipc_ring_rx, &msg) && (msg.type == IPC_MSG_SAMPLE))
+            {
+                uart_frame_submit(telemetry_encode(frame, &msg.sample));
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Linker command file for the CPU2 image (SOIL_DUAL_CORE=1), used together with
+ * F2837xD_Headers_BIOS_cpu2.cmd from the F2837xD device support package.
+ * CPU2 runs from its own flash bank; RAMGS2 is owned by CPU1 and only read here.
+ */
+
+MEMORY
+{
+PAGE 0 :  /* Program Memory */
+
+    BEGIN   : origin = 0x080000, length = 0x000002
+    FLASHA  : origin = 0x080002, length = 0x001FFE  /* on-chip Flash */
+    FLASHB  : origin = 0x082000, length = 0x002000  /* on-chip Flash */
+    FLASHC  : origin = 0x084000, length = 0x002000  /* on-chip Flash */
+    FLASHD  : origin = 0x086000, length = 0x002000  /* on-chip Flash */
+    FLASHE  : origin = 0x088000, length = 0x008000  /* on-chip Flash */
+    FLASHF  : origin = 0x090000, length = 0x008000  /* on-chip Flash */
+    RESET   : origin = 0x3FFFC0, length = 0x000002
+
+PAGE 1 : /* Data Memory */
+
+    BOOT_RSVD : origin = 0x000002, length = 0x000120 /* Part of M0, BOOT rom
+                                                        will use this for
+                                                        stack */
+    M01SARAM : origin = 0x000122, length = 0x0006DE  /* on-chip RAM */
+    LS05SARAM : origin = 0x008000, length = 0x003000 /* on-chip RAM */
+
+    /* Shared MessageRam, only CPU2TOCPU1RAM is writable from CPU2 */
+    CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
+}
+
+SECTIONS
+{
+    .cinit              : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+    .pinit              : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+    .text               : > FLASHB | FLASHC | FLASHD | FLASHE | FLASHF PAGE = 0
+    codestart           : > BEGIN   PAGE = 0
+    .binit              : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+    .reset              : > RESET,  PAGE = 0, TYPE = DSECT
+    .stack              : > M01SARAM | LS05SARAM    PAGE = 1
+#ifdef __TI_EABI__
+    .bss                : > M01SARAM | LS05SARAM    PAGE = 1
+    .sysmem             : > LS05SARAM | M01SARAM    PAGE = 1
+    .init_array         : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+    .const              : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+#else
+    .ebss               : > M01SARAM | LS05SARAM    PAGE = 1
+    .esysmem            : > LS05SARAM | M01SARAM    PAGE = 1
+    .econst             : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+    .switch             : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+#endif
+    .data               : > M01SARAM | LS05SARAM    PAGE = 1
+    .cio                : > LS05SARAM | M01SARAM    PAGE = 1
+    .args               : > FLASHB | FLASHC | FLASHD | FLASHE   PAGE = 0
+
+    /* ring read count (ipc_ring.h), CPU1 reads it at this fixed address */
+    IpcRingAckFile      : > 0x03F800 PAGE = 1, TYPE = NOINIT
+}
@@ -0,0 +1,221 @@
+// Thie file contains the CIC, polyphase FIR and block aggregate stages of the multi-rate
+// pipeline (decimator.h). Ring indices wrap with a compare.
+
+#include <math.h>
+#include "decimator.h"
+#include "telemetry.h"
+
+#define FIR_CUTOFF 0.4 //pass band edge as a fraction of the output Nyquist rate
+
+//value / divisor rounded half away from zero, divisor > 0
+static int32_t divide_rounded(int64_t value, int64_t divisor)
+{
+    int64_t half = divisor / 2;
+    return (int32_t)((value >= 0) ? ((value + half) / divisor) : -((-value + half) / divisor));
+}
+
+void cic_init(cic_decimator_t *cic, uint16_t order, uint16_t ratio)
+{
+    uint16_t i;
+
+    cic->order = order;
+    cic->ratio = ratio;
+    cic->phase = 0;
+    cic->gain = 1;
+    for (i = 0; i < CIC_MAX_ORDER; i++)
+    {
+        cic->integrator[i] = 0;
+        cic->comb[i] = 0;
+    }
+    for (i = 0; i < order; i++)
+    {
+        cic->gain *= ratio;
+    }
+}
+
+int cic_push(cic_decimator_t *cic, int32_t in, int32_t *out)
+{
+    uint32_t x = (uint32_t)in;
+    uint16_t i;
+
+    if (cic->ratio == 1)
+    {
+        *out = in;
+        return 1;
+    }
+    for (i = 0; i < cic->order; i++)
+    {
+        cic->integrator[i] += x;
+        x = cic->integrator[i];
+    }
+    if (++cic->phase < cic->ratio)
+    {
+        return 0;
+    }
+    cic->phase = 0;
+    for (i = 0; i < cic->order; i++)
+    {
+        uint32_t y = x - cic->comb[i];
+        cic->comb[i] = x;
+        x = y;
+    }
+    *out = divide_rounded((int32_t)x, cic->gain);
+    return 1;
+}
+
+void fir_decim_init(fir_decimator_t *fir, uint16_t num_taps, uint16_t ratio)
+{
+    float taps[FIR_DECIM_MAX_TAPS];
+    float total = 0.0f;
+    int32_t sum = 0;
+    uint16_t i;
+
+    fir->num_taps = num_taps;
+    fir->ratio = ratio;
+    fir->phase = 0;
+    fir->front = 0;
+    fir->outputs = (uint16_t)((num_taps + ratio - 1) / ratio);
+    for (i = 0; i < FIR_DECIM_MAX_PHASES; i++)
+    {
+        fir->acc[i] = 0;
+    }
+
+    //Hamming windowed sinc, normalised to a DC gain of exactly 1.0 in Q15
+    for (i = 0; i < num_taps; i++)
+    {
+        float t = (float)i - (num_taps - 1) / 2.0f;
+        float fc = (float)(FIR_CUTOFF / ratio);
+        float sinc = (t == 0.0f) ? 2.0f * fc : sinf(6.2831853f * fc * t) / (3.1415927f * t);
+        float window = (num_taps > 1) ? 0.54f - 0.46f * cosf(6.2831853f * i / (num_taps - 1)) : 1.0f;
+        taps[i] = sinc * window;
+        total += taps[i];
+    }
+    for (i = 0; i < num_taps; i++)
+    {
+        fir->taps[i] = (int16_t)floorf(taps[i] / total * 32768.0f + 0.5f);
+        sum += fir->taps[i];
+    }
+    fir->taps[num_taps / 2] += (int16_t)(32768L - sum); //rounding error goes into the centre tap
+}
+
+int fir_decim_push(fir_decimator_t *fir, int32_t in, int32_t *out)
+{
+    uint16_t k = (uint16_t)(fir->ratio - 1 - fir->phase); //tap for the output completing next
+    uint16_t slot = fir->front;
+    uint16_t j;
+
+    if (fir->ratio == 1)
+    {
+        *out = in;
+        return 1;
+    }
+    //every input feeds the outputs in flight with taps k, k + ratio, k + 2 ratio, ...
+    for (j = 0; (j < fir->outputs) && (k < fir->num_taps); j++)
+    {
+        fir->acc[slot] += (int64_t)fir->taps[k] * in;
+        k += fir->ratio;
+        slot = (slot + 1 >= fir->outputs) ? 0 : (uint16_t)(slot + 1);
+    }
+    if (++fir->phase < fir->ratio)
+    {
+        return 0;
+    }
+    fir->phase = 0;
+    *out = divide_rounded(fir->acc[fir->front], 32768);
+    fir->acc[fir->front] = 0;
+    fir->front = (fir->front + 1 >= fir->outputs) ? 0 : (uint16_t)(fir->front + 1);
+    return 1;
+}
+
+void block_aggregate_init(block_aggregate_t *agg, uint16_t length)
+{
+    agg->sum = 0;
+    agg->min = 0;
+    agg->max = 0;
+    agg->count = 0;
+    agg->length = length;
+}
+
+int block_aggregate_push(block_aggregate_t *agg, int32_t in, decim_summary_t *out)
+{
+    if (agg->count == 0)
+    {
+        agg->sum = 0;
+        agg->min = in;
+        agg->max = in;
+    }
+    agg->sum += in;
+    if (in < agg->min)
+    {
+        agg->min = in;
+    }
+    if (in > agg->max)
+    {
+        agg->max = in;
+    }
+    if (++agg->count < agg->length)
+    {
+        return 0;
+    }
+    agg->count = 0;
+    out->mean = divide_rounded(agg->sum, agg->length);
+    out->min = agg->min;
+    out->max = agg->max;
+    out->seq++;
+    return 1;
+}
+
+void decim_channel_init(decim_channel_t *ch, uint16_t cic_order, uint16_t cic_ratio,
+                        uint16_t fir_taps, uint16_t fir_ratio, uint16_t aggregate_length)
+{
+    cic_init(&ch->cic, cic_order, cic_ratio);
+    fir_decim_init(&ch->fir, fir_taps, fir_ratio);
+    block_aggregate_init(&ch->aggregate, aggregate_length);
+    ch->cic_out = 0;
+    ch->cic_seq = 0;
+    ch->fir_out = 0;
+    ch->fir_seq = 0;
+    ch->summary.mean = 0;
+    ch->summary.min = 0;
+    ch->summary.max = 0;
+    ch->summary.seq = 0;
+}
+
+uint16_t decim_channel_push(decim_channel_t *ch, int32_t in)
+{
+    uint16_t ready = 0;
+
+    if (!cic_push(&ch->cic, in, &ch->cic_out))
+    {
+        return ready;
+    }
+    ch->cic_seq++;
+    ready |= DECIM_CIC_READY;
+    if (!fir_decim_push(&ch->fir, ch->cic_out, &ch->fir_out))
+    {
+        return ready;
+    }
+    ch->fir_seq++;
+    ready |= DECIM_FIR_READY;
+    if (block_aggregate_push(&ch->aggregate, ch->fir_out, &ch->summary))
+    {
+        ready |= DECIM_SUMMARY_READY;
+    }
+    return ready;
+}
+
+uint16_t decim_encode(unsigned char *frame, uint16_t channel, const decim_channel_t *ch)
+{
+    unsigned char *q = frame + DECIM_HEADER_SIZE;
+
+    *q++ = channel & 0xFF;
+    q = telemetry_put_u32(q, (uint32_t)ch->cic_out);
+    q = telemetry_put_u32(q, ch->cic_seq);
+    q = telemetry_put_u32(q, (uint32_t)ch->fir_out);
+    q = telemetry_put_u32(q, ch->fir_seq);
+    q = telemetry_put_u32(q, (uint32_t)ch->summary.mean);
+    q = telemetry_put_u32(q, (uint32_t)ch->summary.min);
+    q = telemetry_put_u32(q, (uint32_t)ch->summary.max);
+    q = telemetry_put_u32(q, ch->summary.seq);
+    return telemetry_frame_finish(frame, DECIM_SYNC0, DECIM_SYNC1, DECIM_VERSION, DECIM_PAYLOAD);
+}
@@ -0,0 +1,114 @@
+/*
+ * decimator.h
+ *
+ * Multi-rate pipeline for one sensor channel: integer samples at the input rate go through
+ *   CIC decimator     order N, ratio R1, no multiplies, gain R1^N divided out per output
+ *   FIR decimator     polyphase, Q15 windowed-sinc low pass, ratio R2, ceil(taps / R2)
+ *                     multiply-adds per input so the cost is spread evenly over the inputs
+ *   block aggregate   mean, min and max of every R3 FIR outputs (e.g. per minute)
+ * and each stage publishes its own output with a sequence number. A ratio of 1 passes the
+ * stage through. Plain C with 64-bit integer accumulators; only decim_channel_init()
+ * uses float (tap design), so it runs on the C28x and on the host.
+ *
+ * Frame for the UART dump of the published outputs (little endian, one octet per char on the C28x):
+ *   [0..1]  sync 0xA5 0x5D
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload: channel u8, cic_out i32, cic_seq u32, fir_out i32, fir_seq u32,
+ *           summary mean i32, min i32, max i32, seq u32
+ *   [last2] CRC-16/CCITT-FALSE over version..payload (telemetry_crc16)
+ */
+
+#ifndef DECIMATOR_H_
+#define DECIMATOR_H_
+
+#include <stdint.h>
+
+#define CIC_MAX_ORDER 4
+#define FIR_DECIM_MAX_TAPS 64
+#define FIR_DECIM_MAX_PHASES 16 //ceil(taps / ratio) partial outputs in flight
+
+typedef struct
+{
+    uint32_t integrator[CIC_MAX_ORDER]; //modulo 2^32, the combs undo the wrap
+    uint32_t comb[CIC_MAX_ORDER];       //previous input of every comb (differential delay 1)
+    uint32_t gain;                      //ratio^order
+    uint16_t order;
+    uint16_t ratio;
+    uint16_t phase;
+} cic_decimator_t;
+
+typedef struct
+{
+    int16_t taps[FIR_DECIM_MAX_TAPS];   //Q15, DC gain 1
+    int64_t acc[FIR_DECIM_MAX_PHASES];  //outputs being accumulated, acc[front] completes next
+    uint16_t num_taps;
+    uint16_t ratio;
+    uint16_t phase;
+    uint16_t outputs;                   //ceil(num_taps / ratio)
+    uint16_t front;
+} fir_decimator_t;
+
+typedef struct
+{
+    int64_t sum;
+    int32_t min;
+    int32_t max;
+    uint16_t count;
+    uint16_t length;
+} block_aggregate_t;
+
+typedef struct
+{
+    int32_t mean;
+    int32_t min;
+    int32_t max;
+    uint32_t seq;                       //aggregates published so far
+} decim_summary_t;
+
+typedef struct
+{
+    cic_decimator_t cic;
+    fir_decimator_t fir;
+    block_aggregate_t aggregate;
+    int32_t cic_out;                    //output of each stage at its own rate
+    uint32_t cic_seq;
+    int32_t fir_out;
+    uint32_t fir_seq;
+    decim_summary_t summary;
+} decim_channel_t;
+
+//CIC: order 1..CIC_MAX_ORDER, ratio >= 1. |input| * ratio^order must fit in 31 bits.
+void cic_init(cic_decimator_t *cic, uint16_t order, uint16_t ratio);
+int cic_push(cic_decimator_t *cic, int32_t in, int32_t *out); //1 when *out holds a new output
+
+//FIR: num_taps <= FIR_DECIM_MAX_TAPS and ceil(num_taps / ratio) <= FIR_DECIM_MAX_PHASES.
+//Designs a Hamming windowed sinc with its cutoff at 0.4 / ratio of the input rate.
+void fir_decim_init(fir_decimator_t *fir, uint16_t num_taps, uint16_t ratio);
+int fir_decim_push(fir_decimator_t *fir, int32_t in, int32_t *out);
+
+void block_aggregate_init(block_aggregate_t *agg, uint16_t length);
+int block_aggregate_push(block_aggregate_t *agg, int32_t in, decim_summary_t *out);
+
+void decim_channel_init(decim_channel_t *ch, uint16_t cic_order, uint16_t cic_ratio,
+                        uint16_t fir_taps, uint16_t fir_ratio, uint16_t aggregate_length);
+//One input sample. Returns a bit mask of the stages that published: 1 CIC, 2 FIR, 4 aggregate.
+uint16_t decim_channel_push(decim_channel_t *ch, int32_t in);
+
+#define DECIM_CIC_READY 1
+#define DECIM_FIR_READY 2
+#define DECIM_SUMMARY_READY 4
+
+#define DECIM_SYNC0 0xA5
+#define DECIM_SYNC1 0x5D
+#define DECIM_VERSION 1
+#define DECIM_HEADER_SIZE 4
+#define DECIM_CRC_SIZE 2
+#define DECIM_PAYLOAD 33
+#define DECIM_FRAME_SIZE (DECIM_HEADER_SIZE + DECIM_PAYLOAD + DECIM_CRC_SIZE)
+
+//Writes the dump frame of the channel's published outputs into frame (at least DECIM_FRAME_SIZE
+//elements), returns its length. channel is the caller's number for it (SAMPLE_CH_* in the firmware).
+uint16_t decim_encode(unsigned char *frame, uint16_t channel, const decim_channel_t *ch);
+
+#endif /* DECIMATOR_H_ */
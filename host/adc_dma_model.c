@@ -0,0 +1,194 @@
+// Thie file contains a host model of the moisture ADC pipeline that compares the per-trigger myHwi path
+// with the DMA block path (ADC_USE_DMA) for block sizes 1..64.
+//
+// build: cc -O2 -o adc_dma_model adc_dma_model.c
+// usage: adc_dma_model [rate_hz [hwi_cycles swi_cycles]]
+//        rate_hz is the ADC trigger rate (Timer1), default 2. hwi_cycles and swi_cycles are the
+//        C28x cost of one Hwi dispatch and one Swi post + run, defaults are rough SYS/BIOS figures
+//        and should be replaced with values measured with Timestamp on the target.
+//
+// For every configuration the model runs the firmware reduction (adc_block_mean) over synthetic
+// bursts, counts interrupts (one Hwi + one SWI each), and reports
+//   - modelled C28x CPU cycles per sample and the CPU load at rate_hz (200 MHz SYSCLK)
+//   - host nanoseconds per sample for the reduction work itself
+// DMA bus cycles are not charged to the CPU.
+//
+// Then the noise gain of oversampling (ADC_OVERSAMPLE_LOG2 0..4): a probe voltage anywhere in
+// the working range plus Gaussian noise of sigma LSB is converted (rounded, clamped to 12 bits)
+// 2^N times and reduced by adc_block_mean, as myHwi does. Reported against the true code: the
+// mean error (the shift truncates), the RMS error, the RMS the exact mean of the same
+// conversions would have (what the integer result gives away) and the gain in bits over a single
+// conversion, plus the RMS as soil water content at the middle of the range.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../adc_config.h"
+#include "../adc_dma.h"
+
+#define SYSCLK_HZ 200e6
+#define SAMPLES 262144UL  //triggers per run, a multiple of every block size
+#define WORD_CYCLES 4     //read + add of one result word (ADCRESULT or GS RAM)
+#define CONVERT_CYCLES 60 //sensor_water_content() from the LUT plus the GPIO22 decision
+#define NOISE_TRIGGERS 200000UL //per noise level and oversampling ratio
+#define CODE_LOW 2000.0   //working range of the probe, wet to dry
+#define CODE_HIGH 3500.0
+#define MOISTURE_PER_CODE (338520.0 / (2750.0 * 2750.0)) //|d water content / d code| at mid range, %
+
+static uint16_t *results; //SAMPLES bursts laid out back to back, as the DMA writes them
+static volatile uint16_t sink; //keeps the reductions from being optimised out
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 1;
+
+static double uniform(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return (rng_state + 0.5) / 4294967296.0;
+}
+
+static double gaussian(void)
+{
+    return sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform()); //Box-Muller
+}
+
+static uint16_t convert(double code)
+{
+    double rounded = floor(code + 0.5);
+    return (uint16_t)((rounded < 0.0) ? 0.0 : (rounded > 4095.0) ? 4095.0 : rounded);
+}
+
+static void noise_gain(void)
+{
+    static const double sigmas[] = { 0.25, 0.5, 1.0, 2.0, 4.0 };
+    uint16_t burst[1 << 4];
+    unsigned s;
+
+    printf("\n%-9s %4s %11s %11s %11s %9s %11s\n", "noise lsb", "socs", "mean err", "rms err", "rms exact",
+           "gain bits", "rms water %");
+    for (s = 0; s < sizeof(sigmas) / sizeof(sigmas[0]); s++)
+    {
+        double single_rms = 0.0;
+        uint16_t log2_n;
+
+        for (log2_n = 0; log2_n <= 4; log2_n++)
+        {
+            double bias = 0.0;
+            double sq = 0.0;
+            double exact_sq = 0.0;
+            double rms;
+            unsigned long n;
+            uint16_t i;
+
+            for (n = 0; n < NOISE_TRIGGERS; n++)
+            {
+                double truth = CODE_LOW + (CODE_HIGH - CODE_LOW) * uniform();
+                double sum = 0.0;
+                double err;
+
+                for (i = 0; i < (1U << log2_n); i++)
+                {
+                    burst[i] = convert(truth + sigmas[s] * gaussian());
+                    sum += burst[i];
+                }
+                err = adc_block_mean(burst, log2_n) - truth;
+                bias += err;
+                sq += err * err;
+                err = sum / (1U << log2_n) - truth;
+                exact_sq += err * err;
+            }
+            rms = sqrt(sq / NOISE_TRIGGERS);
+            if (log2_n == 0)
+            {
+                single_rms = rms;
+            }
+            printf("%-9g %4u %11.3f %11.3f %11.3f %9.2f %11.4f\n", sigmas[s], 1U << log2_n, bias / NOISE_TRIGGERS, rms,
+                   sqrt(exact_sq / NOISE_TRIGGERS), log2(single_rms / rms), rms * MOISTURE_PER_CODE);
+        }
+    }
+}
+
+static void print_row(const char *path, unsigned long block, unsigned long irqs, double cycles, double rate, double host_ns)
+{
+    printf("%-6s %6lu %12.1f %14.1f %10.5f %12.2f\n", path, block, irqs * 1000.0 / SAMPLES,
+           cycles, cycles * rate * 100.0 / SYSCLK_HZ, host_ns);
+}
+
+int main(int argc, char **argv)
+{
+    double rate = 2.0;
+    double hwi_cycles = 150.0;
+    double swi_cycles = 200.0;
+    unsigned long n;
+    unsigned long irqs;
+    double t0;
+    int log2_block;
+
+    if (argc >= 2)
+    {
+        rate = atof(argv[1]);
+    }
+    if (argc == 4)
+    {
+        hwi_cycles = atof(argv[2]);
+        swi_cycles = atof(argv[3]);
+    }
+    else if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [rate_hz [hwi_cycles swi_cycles]]\n", argv[0]);
+        return 1;
+    }
+
+    results = malloc(SAMPLES * ADC_OVERSAMPLE * sizeof(uint16_t));
+    if (results == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (n = 0; n < SAMPLES * ADC_OVERSAMPLE; n++)
+    {
+        results[n] = (uint16_t)((rand() & 0xFF) + 1800); //noisy mid-scale reading
+    }
+
+    printf("oversample %d, %g Hz trigger, Hwi %g cycles, Swi %g cycles\n", ADC_OVERSAMPLE, rate, hwi_cycles, swi_cycles);
+    printf("%-6s %6s %12s %14s %10s %12s\n", "path", "block", "irq/ksample", "cycles/sample", "load %", "host ns/smp");
+
+    //per-trigger path: myHwi averages the burst straight from ADCRESULT and posts Swi0 every time
+    irqs = 0;
+    t0 = now_ns();
+    for (n = 0; n < SAMPLES; n++)
+    {
+        sink = adc_block_mean(results + n * ADC_OVERSAMPLE, ADC_OVERSAMPLE_LOG2);
+        irqs++;
+    }
+    print_row("myHwi", 1, irqs, hwi_cycles + swi_cycles + CONVERT_CYCLES + ADC_OVERSAMPLE * WORD_CYCLES,
+              rate, (now_ns() - t0) / SAMPLES);
+
+    //DMA path: the bursts land in RAM for free, one interrupt, one SWI and one reduction per block
+    for (log2_block = 0; log2_block <= 6; log2_block++)
+    {
+        unsigned long block = 1UL << log2_block;
+
+        irqs = 0;
+        t0 = now_ns();
+        for (n = 0; n < SAMPLES; n += block)
+        {
+            sink = adc_block_mean(results + n * ADC_OVERSAMPLE, (uint16_t)(ADC_OVERSAMPLE_LOG2 + log2_block));
+            irqs++;
+        }
+        print_row("dma", block, irqs, (hwi_cycles + swi_cycles + CONVERT_CYCLES) / block + ADC_OVERSAMPLE * WORD_CYCLES,
+                  rate, (now_ns() - t0) / SAMPLES);
+    }
+    free(results);
+    noise_gain();
+    return 0;
+}
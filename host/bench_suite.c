@@ -0,0 +1,440 @@
+// Thie file contains the host runner of the microbenchmark suite (bench.h) and its baseline check
+//
+// build: make bench_suite
+// usage: bench_suite [-n samples] [-k repeats] [-b baseline] [-w baseline] [-r percent] [capture.bin]
+//   without a capture: runs every case on this PC (TSC cycles on x86, ns elsewhere)
+//   capture.bin: the target's answer to 'B' on SCIB (any other frames in it are skipped)
+//   -n  samples per case and repeat on the PC, default 16384
+//   -k  runs of the whole suite on the PC, each case keeps its minimum over all, default 8
+//   -b  compare with a baseline, exit 1 when a case got more than -r percent slower; on the PC
+//       the suite runs again, up to HOST_RECHECKS times, while a case is, keeping every minimum
+//   -w  write the results as a new baseline
+//   -r  allowed slowdown, default 50 %; the target repeats to a count or two, use -r 5 there
+//
+// Prints one CSV line per case: counts per call (min, mean, max of the samples of BENCH_BATCH
+// calls), the minimum in units of the empty case's, the baseline and the change.
+// Counter counts are not core cycles (the x86 TSC runs at a fixed rate whatever the core clock
+// does), so cases are compared as multiples of the empty case, which the core clock scales
+// the same way. The empty case itself is the unit: its change in counts is shown at the
+// baseline's counter rate but not judged, a few counts jitter by one. Baseline files hold a
+// "counter_hz rate" line and "case min_per_call per_empty" lines, '#' starts a comment; keep
+// one per machine or target (bench_baseline.txt is the x86-64 host, written with -k 256).
+// The PC default of -r is wide on purpose: on a shared x86-64 VM the minimum of env_stats
+// moved from 24 to 36 x empty (+47 %) and dht20 and tank by up to 35 % between quiet and busy
+// spells of the other tenants, spells that last seconds and outlast the rechecks. The other
+// cases stayed within 12 %. An unchanged tree has to pass there; a real slowdown of that size
+// still fails, and the target gate uses -r 5.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "../bench.h"
+#include "../tank_model.h"
+#include "../telemetry.h"
+
+#define DEFAULT_SAMPLES 16384
+#define DEFAULT_REPEATS 8
+#define HOST_RECHECKS 6         //runs of -k repeats more while a case is slower than the baseline
+#define HOST_ROUNDS 16          //the samples of a case are spread over this many passes of the suite
+#define DEFAULT_TOLERANCE 50.0  //see the top of the file
+#define RATE_TOLERANCE 0.02     //counter rates this close are the same counter (the PC measures its own)
+
+typedef struct
+{
+    char name[BENCH_NAME_SIZE + 1];
+    profile_probe_t probe;
+    double baseline;             //min per call, < 0 if the baseline has no such case
+    double baseline_rel;         //min per call / the empty case's, < 0 if not in the baseline
+} result_t;
+
+static result_t results[BENCH_CASES];
+static uint16_t result_count;
+static uint16_t batch = BENCH_BATCH;
+static uint32_t counter_hz;
+static unsigned long baseline_hz; //0 if the baseline does not say
+static uint64_t host_counts;      //counter counts and seconds of every repeat so far
+static double host_seconds;
+
+static uint32_t host_counter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void init_host(void)
+{
+    uint16_t c;
+
+    tank_model_init();
+    bench_init();
+    for (c = 0; c < BENCH_CASES; c++)
+    {
+        strcpy(results[c].name, bench_names[c]);
+        profile_probe_init(&results[c].probe);
+    }
+    result_count = BENCH_CASES;
+}
+
+//the probes collect every repeat of every call, so min is the fastest sample of all of them
+static void run_host(long samples, long repeats)
+{
+    uint16_t c;
+    uint16_t round;
+    long repeat;
+
+    for (repeat = 0; repeat < repeats; repeat++)
+    {
+        uint32_t c0 = host_counter();
+        double t0 = now_s();
+
+        for (round = 0; round < HOST_ROUNDS; round++)
+        {
+            for (c = 0; c < BENCH_CASES; c++)
+            {
+                //a slow spell of the PC is spread over every case instead of landing on one
+                bench_run(c, (uint16_t)(samples / HOST_ROUNDS), host_counter, &results[c].probe);
+            }
+        }
+        host_counts += (uint32_t)(host_counter() - c0); //one repeat runs well under one wrap
+        host_seconds += now_s() - t0;
+    }
+    counter_hz = (uint32_t)(host_counts / host_seconds);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void decode_frame(const uint8_t *payload, uint16_t length)
+{
+    if ((payload[0] == BENCH_KIND_START) && (length == BENCH_START_PAYLOAD))
+    {
+        batch = payload[2] | (payload[3] << 8);
+        counter_hz = get_u32(payload + 4);
+        result_count = 0; //a new run, the last one in the capture counts
+    }
+    else if ((payload[0] == BENCH_KIND_RESULT) && (length == BENCH_RESULT_PAYLOAD) && (result_count < BENCH_CASES))
+    {
+        result_t *r = &results[result_count++];
+        memcpy(r->name, payload + 22, BENCH_NAME_SIZE);
+        r->name[BENCH_NAME_SIZE] = '\0';
+        r->probe.count = get_u32(payload + 2);
+        r->probe.min = get_u32(payload + 6);
+        r->probe.max = get_u32(payload + 10);
+        r->probe.sum = get_u32(payload + 14) | ((uint64_t)get_u32(payload + 18) << 32);
+    }
+}
+
+//scans for bench frames byte by byte, telemetry and dump frames in between are skipped by their CRC
+static int read_capture(const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    uint8_t buf[BENCH_FRAME_MAX];
+    size_t fill = 0;
+    unsigned long bad = 0;
+    int c;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    while ((c = fgetc(in)) != EOF)
+    {
+        buf[fill++] = (uint8_t)c;
+        if ((fill == 1) && (buf[0] != BENCH_SYNC0))
+        {
+            fill = 0;
+        }
+        else if ((fill == 2) && (buf[1] != BENCH_SYNC1))
+        {
+            fill = (buf[1] == BENCH_SYNC0) ? 1 : 0;
+            buf[0] = buf[1];
+        }
+        else if ((fill == 4) && ((buf[2] != BENCH_VERSION) || (buf[3] + BENCH_HEADER_SIZE + BENCH_CRC_SIZE > BENCH_FRAME_MAX)))
+        {
+            fill = 0;
+        }
+        else if ((fill > 4) && (fill == (size_t)buf[3] + BENCH_HEADER_SIZE + BENCH_CRC_SIZE))
+        {
+            uint16_t crc = buf[fill - 2] | (buf[fill - 1] << 8);
+            if (crc == telemetry_crc16(buf + 2, (uint16_t)(fill - 2 - BENCH_CRC_SIZE)))
+            {
+                decode_frame(buf + BENCH_HEADER_SIZE, buf[3]);
+            }
+            else
+            {
+                bad++;
+            }
+            fill = 0;
+        }
+    }
+    fclose(in);
+    if (bad != 0)
+    {
+        fprintf(stderr, "%s: %lu bench frames with a bad CRC\n", path, bad);
+    }
+    if (result_count == 0)
+    {
+        fprintf(stderr, "%s: no bench results\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static int read_baseline(const char *path)
+{
+    FILE *in = fopen(path, "r");
+    char line[128];
+    uint16_t i;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        char name[BENCH_NAME_SIZE + 1];
+        double value;
+        double rel = -1.0;
+        char *comment = strchr(line, '#');
+
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        if (sscanf(line, "%12s %lf %lf", name, &value, &rel) < 2)
+        {
+            continue;
+        }
+        if (strcmp(name, "counter_hz") == 0)
+        {
+            baseline_hz = (unsigned long)value;
+            continue;
+        }
+        for (i = 0; i < result_count; i++)
+        {
+            if (strcmp(results[i].name, name) == 0)
+            {
+                results[i].baseline = value;
+                results[i].baseline_rel = rel;
+            }
+        }
+    }
+    fclose(in);
+    return 0;
+}
+
+//minimum per call of the empty case, 0 if the run has none
+static double empty_min(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < result_count; i++)
+    {
+        if (strcmp(results[i].name, bench_names[BENCH_EMPTY]) == 0)
+        {
+            return (double)results[i].probe.min / batch;
+        }
+    }
+    return 0.0;
+}
+
+//cases more than tolerance % slower than the baseline, in units of the empty case
+static int slower_cases(double tolerance)
+{
+    double empty = empty_min();
+    int slower = 0;
+    uint16_t i;
+
+    for (i = 0; (i < result_count) && (empty > 0.0); i++)
+    {
+        const result_t *r = &results[i];
+        double rel = (double)r->probe.min / batch / empty;
+
+        if ((strcmp(r->name, bench_names[BENCH_EMPTY]) != 0) && (r->baseline_rel > 0.0) &&
+            (100.0 * (rel - r->baseline_rel) / r->baseline_rel > tolerance))
+        {
+            slower++;
+        }
+    }
+    return slower;
+}
+
+static int write_baseline(const char *path, const char *source)
+{
+    FILE *out = fopen(path, "w");
+    double empty = empty_min();
+    uint16_t i;
+
+    if (out == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    if (empty <= 0.0)
+    {
+        fprintf(stderr, "%s: no empty case to normalise to\n", path);
+        fclose(out);
+        return -1;
+    }
+    fprintf(out, "# bench_suite baseline, %s: min counts per call and the same in units of the empty case\n", source);
+    fprintf(out, "counter_hz   %lu\n", (unsigned long)counter_hz);
+    for (i = 0; i < result_count; i++)
+    {
+        double min = (double)results[i].probe.min / batch;
+        fprintf(out, "%-12s %.1f %.3f\n", results[i].name, min, min / empty);
+    }
+    fclose(out);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *baseline = NULL;
+    const char *write = NULL;
+    double tolerance = DEFAULT_TOLERANCE;
+    long samples = DEFAULT_SAMPLES;
+    long repeats = DEFAULT_REPEATS;
+    int regressions = 0;
+    int recheck;
+    char source[48];
+    double empty;
+    int same_counter;
+    uint16_t i;
+    int c;
+
+    while ((c = getopt(argc, argv, "n:k:b:w:r:")) != -1)
+    {
+        switch (c)
+        {
+        case 'n':
+            samples = strtol(optarg, NULL, 0);
+            break;
+        case 'k':
+            repeats = strtol(optarg, NULL, 0);
+            break;
+        case 'b':
+            baseline = optarg;
+            break;
+        case 'w':
+            write = optarg;
+            break;
+        case 'r':
+            tolerance = atof(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n samples] [-k repeats] [-b baseline] [-w baseline] [-r percent] [capture.bin]\n", argv[0]);
+            return 2;
+        }
+    }
+    if ((samples < HOST_ROUNDS) || (samples > 65535L * HOST_ROUNDS) || (repeats < 1) || (argc - optind > 1))
+    {
+        fprintf(stderr, "usage: %s [-n samples] [-k repeats] [-b baseline] [-w baseline] [-r percent] [capture.bin]\n", argv[0]);
+        return 2;
+    }
+    for (i = 0; i < BENCH_CASES; i++)
+    {
+        results[i].baseline = -1.0;
+        results[i].baseline_rel = -1.0;
+    }
+    if (optind < argc)
+    {
+        if (read_capture(argv[optind]) != 0)
+        {
+            return 2;
+        }
+    }
+    else
+    {
+        init_host();
+        run_host(samples, repeats);
+    }
+    if ((baseline != NULL) && (read_baseline(baseline) != 0))
+    {
+        return 2;
+    }
+    empty = empty_min();
+    same_counter = (baseline_hz != 0) && (fabs((double)baseline_hz - counter_hz) <= RATE_TOLERANCE * counter_hz);
+    if ((baseline != NULL) && !same_counter)
+    {
+        fprintf(stderr, "%s: counter %lu Hz, this run %lu Hz: the empty case is not shown against it\n", baseline,
+                baseline_hz, (unsigned long)counter_hz);
+    }
+    for (i = 0; (baseline != NULL) && (i < result_count); i++)
+    {
+        if ((results[i].baseline > 0.0) && (results[i].baseline_rel < 0.0))
+        {
+            fprintf(stderr, "%s: no per_empty column, write it again with -w\n", baseline);
+            return 2;
+        }
+    }
+    //a memory bound case on a shared PC is slow for seconds at a time while another tenant
+    //thrashes the cache, measure again before calling it a regression; a real one stays
+    for (recheck = 0; (baseline != NULL) && (optind >= argc) && (recheck < HOST_RECHECKS) &&
+                      (slower_cases(tolerance) != 0); recheck++)
+    {
+        fprintf(stderr, "%d cases slower than %s, measuring again (%d of %d)\n", slower_cases(tolerance), baseline,
+                recheck + 1, HOST_RECHECKS);
+        run_host(samples, repeats);
+    }
+
+    printf("case,samples,min,mean,max,per_empty,baseline,change_pct\n"); //baseline in counts for empty, per_empty for the rest
+    for (i = 0; i < result_count; i++)
+    {
+        const result_t *r = &results[i];
+        double min = (double)r->probe.min / batch;
+        double mean = r->probe.count ? (double)r->probe.sum / r->probe.count / batch : 0.0;
+        double max = (double)r->probe.max / batch;
+        double rel = (empty > 0.0) ? min / empty : 0.0;
+        int is_empty = (strcmp(r->name, bench_names[BENCH_EMPTY]) == 0);
+        double value = is_empty ? min : rel;        //see above
+        double base = is_empty ? (same_counter ? r->baseline : -1.0) : r->baseline_rel;
+
+        printf("%s,%lu,%.1f,%.1f,%.1f,%.3f", r->name, (unsigned long)r->probe.count, min, mean, max, rel);
+        if ((base > 0.0) && (empty > 0.0))
+        {
+            double change = 100.0 * (value - base) / base;
+            printf(",%.3f,%+.1f", base, change);
+            if (!is_empty && (change > tolerance))
+            {
+                fprintf(stderr, "regression: %s %.3f x empty, baseline %.3f (%+.1f %%)\n", r->name, value, base, change);
+                regressions++;
+            }
+        }
+        else
+        {
+            printf(",,");
+        }
+        printf("\n");
+    }
+    fprintf(stderr, "%u cases, %u calls per sample, counter %.1f MHz%s\n", result_count, batch, counter_hz / 1e6,
+            (optind < argc) ? " (target)" : "");
+
+    snprintf(source, sizeof(source), "host, %ld repeats", repeats);
+    if ((write != NULL) && (write_baseline(write, (optind < argc) ? argv[optind] : source) != 0))
+    {
+        return 2;
+    }
+    return (regressions != 0) ? 1 : 0;
+}
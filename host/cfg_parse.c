@@ -0,0 +1,553 @@
+// Thie file contains the reader for the SYS/BIOS objects of app.cfg (cfg_parse.h)
+// Statements are split on ';' once the comments are gone; anything it does not know is skipped.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cfg_parse.h"
+
+#define CFG_MODULES 48
+#define CFG_PARAMS CFG_OBJECTS
+#define CFG_PATH_SIZE 64
+#define CFG_ARGS 4
+
+typedef struct
+{
+    char var[CFG_PATH_SIZE];      //JavaScript variable
+    char path[CFG_PATH_SIZE];     //xdc.useModule('...') argument
+} cfg_module_t;
+
+typedef struct
+{
+    char var[CFG_PATH_SIZE];
+    cfg_object_t fields;          //what the statements set, copied into the created object
+} cfg_params_t;
+
+typedef struct
+{
+    cfg_t *cfg;
+    const char *path;
+    cfg_module_t modules[CFG_MODULES];
+    uint16_t module_count;
+    cfg_params_t params[CFG_PARAMS];
+    uint16_t params_count;
+} cfg_reader_t;
+
+static void cfg_copy(char *dst, size_t size, const char *src, size_t len)
+{
+    if (len >= size)
+    {
+        len = size - 1;
+    }
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static char *cfg_trim(char *s)
+{
+    char *end;
+
+    while (isspace((unsigned char)*s))
+    {
+        s++;
+    }
+    end = s + strlen(s);
+    while ((end > s) && isspace((unsigned char)end[-1]))
+    {
+        *--end = '\0';
+    }
+    return s;
+}
+
+//blanks out comments, keeping quoted text and line count
+static void cfg_strip(char *text)
+{
+    char quote = 0;
+    char *p;
+
+    for (p = text; *p != '\0'; p++)
+    {
+        if (quote != 0)
+        {
+            quote = (*p == quote) ? 0 : quote;
+        }
+        else if ((*p == '"') || (*p == '\''))
+        {
+            quote = *p;
+        }
+        else if ((p[0] == '/') && (p[1] == '/'))
+        {
+            while ((*p != '\0') && (*p != '\n'))
+            {
+                *p++ = ' ';
+            }
+            p--;
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            while ((*p != '\0') && !((p[0] == '*') && (p[1] == '/')))
+            {
+                *p = (*p == '\n') ? '\n' : ' ';
+                p++;
+            }
+            if (*p != '\0')
+            {
+                p[0] = ' ';
+                p[1] = ' ';
+                p++;
+            }
+        }
+    }
+}
+
+//text between the quotes of a string literal, or the whole word; '&' of a function is dropped
+static void cfg_value(char *dst, size_t size, const char *src)
+{
+    const char *end;
+
+    while (isspace((unsigned char)*src))
+    {
+        src++;
+    }
+    if ((*src == '"') || (*src == '\''))
+    {
+        end = strchr(src + 1, *src);
+        src++;
+    }
+    else
+    {
+        end = src + strcspn(src, " \t\r\n,)");
+    }
+    if (end == NULL)
+    {
+        end = src + strlen(src);
+    }
+    if (*src == '&')
+    {
+        src++;
+    }
+    cfg_copy(dst, size, src, (size_t)(end - src));
+    if (strcmp(dst, "null") == 0)
+    {
+        dst[0] = '\0';
+    }
+}
+
+static long cfg_number(const char *s)
+{
+    char *end;
+    long value = strtol(s, &end, 0);
+
+    return (end == s) ? CFG_UNSET : value;
+}
+
+static const char *cfg_module_path(const cfg_reader_t *r, const char *var, size_t len)
+{
+    uint16_t i;
+
+    for (i = 0; i < r->module_count; i++)
+    {
+        if ((strlen(r->modules[i].var) == len) && (strncmp(r->modules[i].var, var, len) == 0))
+        {
+            return r->modules[i].path;
+        }
+    }
+    return NULL;
+}
+
+//object kind of a module path, -1 for modules without analysed objects
+static int cfg_module_kind(const char *path)
+{
+    const char *last = strrchr(path, '.');
+
+    last = (last != NULL) ? last + 1 : path;
+    if (strcmp(path, "ti.sysbios.knl.Task") == 0)
+    {
+        return CFG_TASK;
+    }
+    if (strcmp(path, "ti.sysbios.knl.Swi") == 0)
+    {
+        return CFG_SWI;
+    }
+    if (strcmp(path, "ti.sysbios.knl.Semaphore") == 0)
+    {
+        return CFG_SEMAPHORE;
+    }
+    if ((strncmp(path, "ti.sysbios.", 11) == 0) && (strcmp(last, "Hwi") == 0))
+    {
+        return CFG_HWI;
+    }
+    if ((strncmp(path, "ti.sysbios.", 11) == 0) && (strcmp(last, "Timer") == 0))
+    {
+        return CFG_TIMER;
+    }
+    return -1;
+}
+
+static cfg_params_t *cfg_find_params(cfg_reader_t *r, const char *var, size_t len)
+{
+    uint16_t i;
+
+    for (i = 0; i < r->params_count; i++)
+    {
+        if ((strlen(r->params[i].var) == len) && (strncmp(r->params[i].var, var, len) == 0))
+        {
+            return &r->params[i];
+        }
+    }
+    return NULL;
+}
+
+static void cfg_object_init(cfg_object_t *o)
+{
+    memset(o, 0, sizeof(*o));
+    o->priority = CFG_UNSET;
+    o->number = CFG_UNSET;
+    o->stack_size = CFG_UNSET;
+    o->count = 0;
+}
+
+//splits the arguments of "Module.create(a, b, c)" at the top level
+static uint16_t cfg_args(char *call, char *args[CFG_ARGS])
+{
+    char *open = strchr(call, '(');
+    char *close = strrchr(call, ')');
+    uint16_t n = 0;
+    char quote = 0;
+    char *p;
+
+    if ((open == NULL) || (close == NULL) || (close < open))
+    {
+        return 0;
+    }
+    *close = '\0';
+    args[n++] = open + 1;
+    for (p = open + 1; *p != '\0'; p++)
+    {
+        if (quote != 0)
+        {
+            quote = (*p == quote) ? 0 : quote;
+        }
+        else if ((*p == '"') || (*p == '\''))
+        {
+            quote = *p;
+        }
+        else if ((*p == ',') && (n < CFG_ARGS))
+        {
+            *p = '\0';
+            args[n++] = p + 1;
+        }
+    }
+    if ((n == 1) && (*cfg_trim(args[0]) == '\0'))
+    {
+        n = 0; //"create()"
+    }
+    return n;
+}
+
+static int cfg_create(cfg_reader_t *r, const char *name, char *rhs)
+{
+    cfg_t *cfg = r->cfg;
+    char *dot = strchr(rhs, '.');
+    const char *path;
+    cfg_params_t *params = NULL;
+    cfg_object_t *o;
+    char *args[CFG_ARGS];
+    uint16_t n;
+    int kind;
+
+    if ((dot == NULL) || (strncmp(dot, ".create", 7) != 0))
+    {
+        return 0;
+    }
+    path = cfg_module_path(r, rhs, (size_t)(dot - rhs));
+    kind = (path != NULL) ? cfg_module_kind(path) : -1;
+    if (kind < 0)
+    {
+        return 0; //LoggerBuf and the like
+    }
+    if (cfg->count == CFG_OBJECTS)
+    {
+        fprintf(stderr, "%s: more than %d objects\n", r->path, CFG_OBJECTS);
+        return -1;
+    }
+    n = cfg_args(dot, args);
+    if (n > 0)
+    {
+        char *last = cfg_trim(args[n - 1]);
+        params = cfg_find_params(r, last, strlen(last));
+        n -= (params != NULL);
+    }
+    o = &cfg->objects[cfg->count++];
+    if (params != NULL)
+    {
+        *o = params->fields;
+    }
+    else
+    {
+        cfg_object_init(o);
+    }
+    o->kind = (cfg_kind_t)kind;
+    cfg_copy(o->name, sizeof(o->name), name, strlen(name));
+    switch (o->kind)
+    {
+    case CFG_TASK:
+    case CFG_SWI:
+        if (n > 0)
+        {
+            cfg_value(o->fxn, sizeof(o->fxn), args[0]);
+        }
+        break;
+    case CFG_SEMAPHORE:
+        o->count = (n > 0) ? cfg_number(cfg_trim(args[0])) : 0;
+        o->count = (o->count < 0) ? 0 : o->count;
+        break;
+    case CFG_HWI:
+        if (n > 1)
+        {
+            o->number = cfg_number(cfg_trim(args[0]));
+            cfg_value(o->fxn, sizeof(o->fxn), args[1]);
+        }
+        break;
+    case CFG_TIMER:
+        if (n > 1)
+        {
+            o->number = cfg_number(cfg_trim(args[0])); //Timer.ANY is not a number
+            cfg_value(o->fxn, sizeof(o->fxn), args[1]);
+        }
+        break;
+    }
+    return 0;
+}
+
+//"params.field = value" of a Params object
+static void cfg_param(cfg_params_t *params, const char *field, const char *value)
+{
+    cfg_object_t *o = &params->fields;
+
+    if (strcmp(field, "instance.name") == 0)
+    {
+        cfg_value(o->instance, sizeof(o->instance), value);
+    }
+    else if (strcmp(field, "priority") == 0)
+    {
+        o->priority = cfg_number(value);
+    }
+    else if (strcmp(field, "stackSize") == 0)
+    {
+        o->stack_size = cfg_number(value);
+    }
+    else if (strcmp(field, "period") == 0)
+    {
+        o->period = (unsigned long)cfg_number(value);
+    }
+    else if (strcmp(field, "periodType") == 0)
+    {
+        o->period_counts = strstr(value, "PeriodType_COUNTS") != NULL;
+    }
+    else if (strcmp(field, "mode") == 0)
+    {
+        o->binary = strstr(value, "Mode_BINARY") != NULL;
+    }
+}
+
+//"Module.field = value" of a module
+static void cfg_module_setting(cfg_t *cfg, const char *path, const char *field, const char *value)
+{
+    if ((strcmp(path, "ti.sysbios.BIOS") == 0) && (strcmp(field, "cpuFreq.lo") == 0))
+    {
+        cfg->cpu_hz = (unsigned long)cfg_number(value);
+    }
+    else if ((strcmp(path, "ti.sysbios.knl.Clock") == 0) && (strcmp(field, "tickPeriod") == 0))
+    {
+        cfg->clock_tick_us = (unsigned long)cfg_number(value);
+    }
+    else if ((strcmp(path, "ti.sysbios.knl.Swi") == 0) && (strcmp(field, "numPriorities") == 0))
+    {
+        cfg->swi_priorities = cfg_number(value);
+    }
+    else if ((strcmp(path, "ti.sysbios.knl.Idle") == 0) && (strncmp(field, "idleFxns[", 9) == 0))
+    {
+        long i = cfg_number(field + 9);
+        if ((i >= 0) && (i < CFG_IDLE_FXNS))
+        {
+            cfg_value(cfg->idle_fxns[i], sizeof(cfg->idle_fxns[i]), value);
+            if ((uint16_t)(i + 1) > cfg->idle_count)
+            {
+                cfg->idle_count = (uint16_t)(i + 1);
+            }
+        }
+    }
+}
+
+static int cfg_statement(cfg_reader_t *r, char *s)
+{
+    char *eq;
+    char *lhs;
+    char *rhs;
+    char *dot;
+    const char *path;
+    cfg_params_t *params;
+
+    s = cfg_trim(s);
+    eq = strchr(s, '=');
+    if ((eq == NULL) || (eq == s))
+    {
+        return 0;
+    }
+    *eq = '\0';
+    lhs = cfg_trim(s);
+    rhs = cfg_trim(eq + 1);
+
+    if (strncmp(lhs, "var ", 4) == 0)
+    {
+        char *var = cfg_trim(lhs + 4);
+        if (strncmp(rhs, "xdc.useModule(", 14) == 0)
+        {
+            if (r->module_count < CFG_MODULES)
+            {
+                cfg_module_t *m = &r->modules[r->module_count++];
+                cfg_copy(m->var, sizeof(m->var), var, strlen(var));
+                cfg_value(m->path, sizeof(m->path), rhs + 14);
+            }
+        }
+        else if ((strncmp(rhs, "new ", 4) == 0) && (strstr(rhs, ".Params(") != NULL))
+        {
+            if (r->params_count == CFG_PARAMS)
+            {
+                fprintf(stderr, "%s: more than %d Params objects\n", r->path, CFG_PARAMS);
+                return -1;
+            }
+            params = &r->params[r->params_count++];
+            cfg_copy(params->var, sizeof(params->var), var, strlen(var));
+            cfg_object_init(&params->fields);
+        }
+        return 0;
+    }
+    if (strncmp(lhs, "Program.global.", 15) == 0)
+    {
+        return cfg_create(r, lhs + 15, rhs);
+    }
+    dot = strchr(lhs, '.');
+    if (dot == NULL)
+    {
+        return 0;
+    }
+    params = cfg_find_params(r, lhs, (size_t)(dot - lhs));
+    if (params != NULL)
+    {
+        cfg_param(params, dot + 1, rhs);
+        return 0;
+    }
+    path = cfg_module_path(r, lhs, (size_t)(dot - lhs));
+    if (path != NULL)
+    {
+        cfg_module_setting(r->cfg, path, dot + 1, rhs);
+    }
+    return 0;
+}
+
+int cfg_load(const char *path, cfg_t *cfg)
+{
+    static cfg_reader_t r;
+    FILE *in = fopen(path, "rb");
+    char *text;
+    char *s;
+    long size;
+    int result = 0;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    fseek(in, 0, SEEK_END);
+    size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    text = malloc((size_t)size + 1);
+    if ((text == NULL) || (fread(text, 1, (size_t)size, in) != (size_t)size))
+    {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(in);
+        free(text);
+        return -1;
+    }
+    fclose(in);
+    text[size] = '\0';
+
+    memset(&r, 0, sizeof(r));
+    memset(cfg, 0, sizeof(*cfg));
+    r.cfg = cfg;
+    r.path = path;
+    cfg->cpu_hz = 200000000UL;
+    cfg->clock_tick_us = 1000;
+    cfg->swi_priorities = 16;
+    cfg_strip(text);
+    for (s = strtok(text, ";"); (s != NULL) && (result == 0); s = strtok(NULL, ";"))
+    {
+        result = cfg_statement(&r, s);
+    }
+    free(text);
+    return result;
+}
+
+const cfg_object_t *cfg_find_fxn(const cfg_t *cfg, cfg_kind_t kind, const char *fxn)
+{
+    uint16_t i;
+
+    for (i = 0; i < cfg->count; i++)
+    {
+        if ((cfg->objects[i].kind == kind) && (strcmp(cfg->objects[i].fxn, fxn) == 0))
+        {
+            return &cfg->objects[i];
+        }
+    }
+    return NULL;
+}
+
+const cfg_object_t *cfg_find(const cfg_t *cfg, cfg_kind_t kind, const char *name)
+{
+    uint16_t i;
+
+    for (i = 0; i < cfg->count; i++)
+    {
+        if ((cfg->objects[i].kind == kind) && (strcmp(cfg->objects[i].name, name) == 0))
+        {
+            return &cfg->objects[i];
+        }
+    }
+    return NULL;
+}
+
+const cfg_object_t *cfg_find_timer(const cfg_t *cfg, long id)
+{
+    uint16_t i;
+
+    for (i = 0; i < cfg->count; i++)
+    {
+        if ((cfg->objects[i].kind == CFG_TIMER) && (cfg->objects[i].number == id))
+        {
+            return &cfg->objects[i];
+        }
+    }
+    return NULL;
+}
+
+double cfg_timer_cycles(const cfg_t *cfg, const cfg_object_t *timer)
+{
+    if (timer->period_counts)
+    {
+        return (double)timer->period;
+    }
+    return (double)timer->period * cfg->cpu_hz / 1e6;
+}
+
+long cfg_priority(const cfg_t *cfg, const cfg_object_t *object)
+{
+    if (object->priority != CFG_UNSET)
+    {
+        return object->priority;
+    }
+    return (object->kind == CFG_SWI) ? cfg->swi_priorities - 1 : 1;
+}
@@ -0,0 +1,76 @@
+/*
+ * cfg_parse.h
+ *
+ * Reads the SYS/BIOS objects out of the firmware's app.cfg, for the host tools that analyse
+ * the thread set against the configured rates. It understands the statements the CCS
+ * configuration editor writes, and nothing more general:
+ *
+ *   var Task = xdc.useModule('ti.sysbios.knl.Task');
+ *   var task0Params = new Task.Params();
+ *   task0Params.instance.name = "Tsk0";
+ *   task0Params.priority = 9;
+ *   Program.global.Tsk0 = Task.create("&myTskFxn", task0Params);
+ *
+ * for Task, Swi, Semaphore, Hwi (family c28 or hal) and Timer (family c28 or hal), plus
+ * BIOS.cpuFreq.lo, Clock.tickPeriod, Swi.numPriorities and Idle.idleFxns. Comments are skipped.
+ */
+
+#ifndef CFG_PARSE_H_
+#define CFG_PARSE_H_
+
+#include <stdint.h>
+
+#define CFG_NAME_SIZE 32
+#define CFG_OBJECTS 32
+#define CFG_IDLE_FXNS 4
+#define CFG_UNSET (-1L)          //parameter not given, the module default applies
+
+typedef enum
+{
+    CFG_TASK,
+    CFG_SWI,
+    CFG_SEMAPHORE,
+    CFG_HWI,
+    CFG_TIMER
+} cfg_kind_t;
+
+typedef struct
+{
+    cfg_kind_t kind;
+    char name[CFG_NAME_SIZE];     //Program.global name, e.g. Tsk0, hwi1, myTimer0
+    char instance[CFG_NAME_SIZE]; //instance.name, empty if not set
+    char fxn[CFG_NAME_SIZE];      //function without the '&', empty for null
+    long priority;                //Task, Swi
+    long number;                  //Hwi interrupt number, Timer id (CFG_UNSET = any timer)
+    long stack_size;              //Task
+    unsigned long period;         //Timer, in counts or microseconds
+    int period_counts;            //Timer periodType is PeriodType_COUNTS
+    int binary;                   //Semaphore mode is Mode_BINARY
+    long count;                   //Semaphore initial count
+} cfg_object_t;
+
+typedef struct
+{
+    unsigned long cpu_hz;         //BIOS.cpuFreq.lo, 200 MHz if not set
+    unsigned long clock_tick_us;  //Clock.tickPeriod, 1000 if not set
+    long swi_priorities;          //Swi.numPriorities, 16 if not set
+    cfg_object_t objects[CFG_OBJECTS];
+    uint16_t count;
+    char idle_fxns[CFG_IDLE_FXNS][CFG_NAME_SIZE];
+    uint16_t idle_count;
+} cfg_t;
+
+//Reads path into cfg. Returns 0, or -1 after printing the error.
+int cfg_load(const char *path, cfg_t *cfg);
+//First object of the kind whose function is fxn, NULL if none
+const cfg_object_t *cfg_find_fxn(const cfg_t *cfg, cfg_kind_t kind, const char *fxn);
+//First object of the kind with the given Program.global name, NULL if none
+const cfg_object_t *cfg_find(const cfg_t *cfg, cfg_kind_t kind, const char *name);
+//Timer with the given id, NULL if none
+const cfg_object_t *cfg_find_timer(const cfg_t *cfg, long id);
+//Timer period in CPU cycles
+double cfg_timer_cycles(const cfg_t *cfg, const cfg_object_t *timer);
+//Priority the kernel gives the object: the default (Task 1, Swi the highest) when not set
+long cfg_priority(const cfg_t *cfg, const cfg_object_t *object);
+
+#endif /* CFG_PARSE_H_ */
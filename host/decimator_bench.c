@@ -0,0 +1,207 @@
+// Thie file contains the host check and benchmark of the multi-rate pipeline (decimator.h).
+//
+// build: cc -O2 -o decimator_bench decimator_bench.c ../decimator.c -lm
+// usage: decimator_bench
+//
+// Runs the example chain 1 kHz -> CIC (order 3, /100) -> 10 Hz -> FIR (40 taps, /10) -> 1 Hz
+// -> aggregate (60) -> per minute, and
+//   - drives each stage and the whole chain with sines and compares the measured output
+//     amplitude with the theoretical response (CIC sinc^N, FIR DFT of the Q15 taps),
+//   - checks that a constant input comes out unchanged at every rate,
+//   - times the chain per input sample (ns, and TSC cycles on x86).
+// Exits non-zero when a measured gain is more than TOLERANCE away from theory.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "../decimator.h"
+
+#define INPUT_HZ 1000.0
+#define CIC_ORDER 3
+#define CIC_RATIO 100
+#define FIR_TAPS 40
+#define FIR_RATIO 10
+#define AGGREGATE 60
+#define AMPLITUDE 2000.0  //|input| * CIC_RATIO^CIC_ORDER must fit in 31 bits
+#define TOLERANCE 0.005   //absolute gain error allowed (quantisation at AMPLITUDE)
+#define OUTPUTS 2000      //steady state outputs measured per tone
+#define SETTLE 8          //outputs skipped while the stage fills
+#define PI 3.14159265358979
+
+static int failures = 0;
+
+static double cic_theory(double f, double fs)
+{
+    double x = PI * f / fs;
+    return (fabs(sin(x)) < 1e-12) ? 1.0 : pow(fabs(sin(CIC_RATIO * x) / (CIC_RATIO * sin(x))), CIC_ORDER);
+}
+
+static double fir_theory(const fir_decimator_t *fir, double f, double fs)
+{
+    double re = 0.0;
+    double im = 0.0;
+    int k;
+
+    for (k = 0; k < fir->num_taps; k++)
+    {
+        re += fir->taps[k] / 32768.0 * cos(2.0 * PI * f / fs * k);
+        im -= fir->taps[k] / 32768.0 * sin(2.0 * PI * f / fs * k);
+    }
+    return sqrt(re * re + im * im);
+}
+
+//frequency the output of a decimator sees for an input tone f
+static double alias(double f, double fs)
+{
+    return fabs(f - floor(f / fs + 0.5) * fs);
+}
+
+//amplitude of a sequence from its variance, in units of AMPLITUDE
+static double measured_gain(const int32_t *y, int n)
+{
+    double mean = 0.0;
+    double var = 0.0;
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        mean += y[i];
+    }
+    mean /= n;
+    for (i = 0; i < n; i++)
+    {
+        var += (y[i] - mean) * (y[i] - mean);
+    }
+    return sqrt(2.0 * var / n) / AMPLITUDE;
+}
+
+static void report(const char *stage, double f, double theory, double measured)
+{
+    int bad = fabs(theory - measured) > TOLERANCE;
+
+    failures |= bad;
+    printf("%-6s %9.3f Hz  theory %8.5f (%7.1f dB)  measured %8.5f  %s\n", stage, f, theory,
+           20.0 * log10(theory + 1e-9), measured, bad ? "FAIL" : "ok");
+}
+
+//runs one tone through the stage selected by mask (1 CIC, 2 FIR, 3 both) and returns the gain
+static double tone(double f, double fs, int mask, const fir_decimator_t **fir_out)
+{
+    static int32_t y[OUTPUTS];
+    static decim_channel_t ch;
+    int n = 0;
+    long i = 0;
+
+    decim_channel_init(&ch, CIC_ORDER, (mask & 1) ? CIC_RATIO : 1, FIR_TAPS, (mask & 2) ? FIR_RATIO : 1, AGGREGATE);
+    *fir_out = &ch.fir;
+    while (n < OUTPUTS + SETTLE)
+    {
+        int32_t x = (int32_t)floor(AMPLITUDE * sin(2.0 * PI * f / fs * i + 0.3) + 0.5);
+        uint16_t ready = decim_channel_push(&ch, x);
+
+        if (ready & DECIM_FIR_READY)
+        {
+            if (n >= SETTLE)
+            {
+                y[n - SETTLE] = ch.fir_out;
+            }
+            n++;
+        }
+        i++;
+    }
+    return measured_gain(y, OUTPUTS);
+}
+
+int main(void)
+{
+    static const double cic_tones[] = { 0.3, 1.1, 2.3, 3.7, 4.3, 13.0, 27.0, 47.3, 103.0, 211.0 };
+    static const double fir_tones[] = { 0.05, 0.13, 0.27, 0.35, 0.45, 0.7, 1.3, 2.7, 4.1 };
+    static const double chain_tones[] = { 0.13, 0.27, 0.45, 0.7, 2.3, 13.0 };
+    const fir_decimator_t *fir;
+    decim_channel_t ch;
+    double mid = INPUT_HZ / CIC_RATIO;
+    unsigned i;
+    long n;
+    int ok;
+    double t0;
+    struct timespec ts;
+
+    printf("chain: %.0f Hz -> CIC %d/%d -> %.0f Hz -> FIR %d taps /%d -> %.0f Hz -> aggregate %d\n",
+           INPUT_HZ, CIC_ORDER, CIC_RATIO, mid, FIR_TAPS, FIR_RATIO, mid / FIR_RATIO, AGGREGATE);
+
+    for (i = 0; i < sizeof(cic_tones) / sizeof(cic_tones[0]); i++)
+    {
+        double m = tone(cic_tones[i], INPUT_HZ, 1, &fir);
+        report("cic", cic_tones[i], cic_theory(cic_tones[i], INPUT_HZ), m);
+    }
+    for (i = 0; i < sizeof(fir_tones) / sizeof(fir_tones[0]); i++)
+    {
+        double m = tone(fir_tones[i], mid, 2, &fir);
+        report("fir", fir_tones[i], fir_theory(fir, fir_tones[i], mid), m);
+    }
+    for (i = 0; i < sizeof(chain_tones) / sizeof(chain_tones[0]); i++)
+    {
+        double m = tone(chain_tones[i], INPUT_HZ, 3, &fir);
+        double theory = cic_theory(chain_tones[i], INPUT_HZ) * fir_theory(fir, alias(chain_tones[i], mid), mid);
+        report("chain", chain_tones[i], theory, m);
+    }
+
+    //a constant must come out unchanged at every rate
+    decim_channel_init(&ch, CIC_ORDER, CIC_RATIO, FIR_TAPS, FIR_RATIO, AGGREGATE);
+    for (n = 0; n < (long)CIC_RATIO * FIR_RATIO * AGGREGATE * 2; n++)
+    {
+        decim_channel_push(&ch, 1234);
+    }
+    ok = (ch.cic_out == 1234) && (ch.fir_out == 1234) && (ch.summary.mean == 1234) &&
+         (ch.summary.min == 1234) && (ch.summary.max == 1234) && (ch.summary.seq == 2);
+    failures |= !ok;
+    printf("dc     cic %ld fir %ld minute mean %ld min %ld max %ld (%lu summaries)  %s\n", (long)ch.cic_out,
+           (long)ch.fir_out, (long)ch.summary.mean, (long)ch.summary.min, (long)ch.summary.max,
+           (unsigned long)ch.summary.seq, ok ? "ok" : "FAIL");
+
+    //cost per input sample over 10 simulated minutes of noise
+    {
+        const long samples = (long)(INPUT_HZ * 600);
+        int32_t *input = malloc(samples * sizeof(int32_t));
+        volatile uint32_t sink = 0;
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned long long c0;
+        double cycles;
+#endif
+
+        if (input == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        for (n = 0; n < samples; n++)
+        {
+            input[n] = 2000 + (rand() % 200);
+        }
+        decim_channel_init(&ch, CIC_ORDER, CIC_RATIO, FIR_TAPS, FIR_RATIO, AGGREGATE);
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        t0 = ts.tv_sec * 1e9 + ts.tv_nsec;
+#if defined(__x86_64__) || defined(__i386__)
+        c0 = __rdtsc();
+#endif
+        for (n = 0; n < samples; n++)
+        {
+            sink += decim_channel_push(&ch, input[n]);
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        cycles = (double)(__rdtsc() - c0) / samples;
+#endif
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        printf("cost   %.2f ns per input sample", (ts.tv_sec * 1e9 + ts.tv_nsec - t0) / samples);
+#if defined(__x86_64__) || defined(__i386__)
+        printf(", %.1f TSC cycles", cycles);
+#endif
+        printf(" (%lu summaries)\n", (unsigned long)ch.summary.seq);
+        free(input);
+    }
+    return failures;
+}
@@ -0,0 +1,237 @@
+// Thie file contains a host runner for the whole firmware on the SYS/BIOS shim (shim/shim.h)
+//
+// build: make firmware_host
+// usage: firmware_host [-t seconds] [-c cycles] [-s script] [-S seed] [-m code] [-d mm] [-u capture] [-w]
+//   -t  virtual run time, default 10 s
+//   -c  virtual cycles each kernel call costs, default 20 (0 = firmware code takes no time)
+//   -s  scenario script for the sensor models (sim/sim.h), default constant conditions
+//   -S  seed of the noise and fault injection, default 1
+//   -m  moisture ADC code the probe reads, overrides the script, default 3200 (34 %)
+//   -d  distance to the water, overrides the script, default 100 mm
+//   -u  write every byte the firmware sends on SCIB to this file (telemetry_dump reads it)
+//   -w  start the timestamp counter 2 s before it wraps
+//
+// SoilMonitor_main.c and the drivers are built unchanged with main renamed to firmware_main,
+// in the default configuration (ADC_USE_DMA=0, the myHwi path). The parts around them are the models of sim/: the DHT20
+// on I2C-B, the HC-SR04 on ePWM2 and eCAP1, the probe on ADC-A and the ESP32 link on SCIB.
+// The GPIO set/clear/toggle registers act on GPADAT once per millisecond.
+//
+// Prints the shim's per thread report, the models' counters, the telemetry the link carried,
+// then the firmware state and the schedule digest. The same options give the same output apart
+// from the host ns column. Expect lines of the script can check the models' counters and
+// distance_cm, temperature_c, humidity_rh and tank_low of the firmware; the exit status is 1 if
+// one failed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "shim/shim.h"
+#include "sim/sim.h"
+#include "telemetry_decode.h"
+#include "../sensor_math.h"
+#include "../profile.h"
+#include "../trace_bios.h"
+#include <Headers/F2837xD_device.h>
+
+#define USAGE "usage: %s [-t seconds] [-c cycles] [-s script] [-S seed] [-m code] [-d mm] [-u capture] [-w]\n"
+
+extern Int firmware_main();
+extern volatile UInt16 tickCount;
+extern volatile Bool isrFlag1;
+extern uint16_t telemetry_seq;
+extern uint32_t ultrasonic_timeouts;
+extern uint32_t tank_volume;
+extern sensor_t water_content;
+extern sensor_t distance;
+extern sensor_t temperature;
+extern sensor_t humidity;
+
+//what the ESP32 end of the link saw
+static struct
+{
+    telemetry_decoder_t dec;
+    telemetry_sample_t last;
+    FILE *capture;
+} esp32;
+
+static struct
+{
+    unsigned long on_ms;
+    unsigned long switches;
+    int on;
+} pump;
+
+static void link_byte(void *arg, uint8_t byte)
+{
+    telemetry_sample_t s;
+
+    if (esp32.capture != NULL)
+    {
+        fputc(byte, esp32.capture);
+    }
+    if (telemetry_decoder_push(&esp32.dec, byte, &s))
+    {
+        esp32.last = s;
+    }
+}
+
+//firmware state for the expect lines of a script
+static double distance_cm(void)
+{
+    return sensor_to_units(distance, 100, 0, 2147483647L) / 100.0;
+}
+
+static double temperature_c(void)
+{
+    return sensor_to_units(temperature, 100, -2147483647L, 2147483647L) / 100.0;
+}
+
+static double humidity_rh(void)
+{
+    return sensor_to_units(humidity, 100, -2147483647L, 2147483647L) / 100.0;
+}
+
+static double tank_low(void)
+{
+    return isrFlag1 ? 1.0 : 0.0;
+}
+
+//GPIO set/clear/toggle are write-only: fold them into GPADAT, then watch the pump on GPIO22
+static void gpio_update(void *arg)
+{
+    int on;
+
+    if (GpioDataRegs.GPASET.all | GpioDataRegs.GPACLEAR.all | GpioDataRegs.GPATOGGLE.all)
+    {
+        GpioDataRegs.GPADAT.all = ((GpioDataRegs.GPADAT.all | GpioDataRegs.GPASET.all) & ~GpioDataRegs.GPACLEAR.all) ^
+                                  GpioDataRegs.GPATOGGLE.all;
+        GpioDataRegs.GPASET.all = 0; //write-only, read as 0
+        GpioDataRegs.GPACLEAR.all = 0;
+        GpioDataRegs.GPATOGGLE.all = 0;
+    }
+    on = GpioDataRegs.GPADAT.bit.GPIO22;
+    pump.switches += (on != pump.on);
+    pump.on = on;
+    pump.on_ms += on;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 10.0;
+    const char *script = NULL;
+    const char *capture = NULL;
+    double adc_code = -1.0;
+    double distance_mm = -1.0;
+    uint16_t probe;
+    int c;
+
+    shim_config.call_cycles = 20;
+    while ((c = getopt(argc, argv, "t:c:s:S:m:d:u:w")) != -1)
+    {
+        switch (c)
+        {
+        case 't':
+            seconds = atof(optarg);
+            break;
+        case 'c':
+            shim_config.call_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            script = optarg;
+            break;
+        case 'S':
+            sim_seed((uint32_t)strtoul(optarg, NULL, 0));
+            break;
+        case 'm':
+            adc_code = atof(optarg);
+            break;
+        case 'd':
+            distance_mm = atof(optarg);
+            break;
+        case 'u':
+            capture = optarg;
+            break;
+        case 'w':
+            shim_config.timestamp_start = (uint32_t)(0U - 2U * SHIM_CPU_HZ);
+            break;
+        default:
+            fprintf(stderr, USAGE, argv[0]);
+            return 1;
+        }
+    }
+    if ((seconds <= 0.0) || (optind != argc))
+    {
+        fprintf(stderr, USAGE, argv[0]);
+        return 1;
+    }
+    if (shim_app_check() != 0)
+    {
+        return 1;
+    }
+    shim_config.run_cycles = (uint64_t)(seconds * SHIM_CPU_HZ);
+    sim_expect_value("distance_cm", distance_cm);
+    sim_expect_value("temperature_c", temperature_c);
+    sim_expect_value("humidity_rh", humidity_rh);
+    sim_expect_value("tank_low", tank_low);
+    if ((script != NULL) && (sim_script_load(script) != 0))
+    {
+        return 1;
+    }
+    if (adc_code >= 0.0)
+    {
+        sim_signal_set(SIM_A5, adc_code);
+    }
+    if (distance_mm >= 0.0)
+    {
+        sim_signal_set(SIM_DISTANCE, distance_mm);
+    }
+    if (capture != NULL)
+    {
+        esp32.capture = fopen(capture, "wb");
+        if (esp32.capture == NULL)
+        {
+            perror(capture);
+            return 1;
+        }
+    }
+    telemetry_decoder_init(&esp32.dec);
+
+    sim_i2c_init();
+    sim_hcsr04_init();
+    sim_adc_init();
+    sim_sci_init(link_byte, NULL);
+    shim_at(0, SIM_CYCLES_MS, gpio_update, NULL);
+    firmware_main(); //returns at the end of the run on the host
+
+    shim_report(stdout);
+    printf("\n%-10s %10s %10s %10s\n", "probe", "runs", "min", "max");
+    for (probe = 0; probe < PROFILE_PROBES; probe++)
+    {
+        const profile_probe_t *p = &profile_probes[probe];
+        printf("%-10s %10lu %10lu %10lu\n", profile_probe_names[probe], (unsigned long)p->count,
+               (unsigned long)(p->count ? p->min : 0), (unsigned long)p->max);
+    }
+    printf("\n");
+    sim_report(stdout);
+    printf("telemetry frames %lu, bad %lu", esp32.dec.frames, esp32.dec.crc_errors);
+    if (esp32.dec.frames != 0)
+    {
+        printf(", last seq %u: %.2f C, %.2f %%RH, %.2f %%, %.1f cm", esp32.last.seq,
+               esp32.last.temperature_centi / 100.0, esp32.last.humidity_centi / 100.0,
+               esp32.last.moisture_centi / 100.0, esp32.last.water_level_mm / 10.0);
+    }
+    printf("\n\ntickCount %u, telemetry frames %u, ultrasonic timeouts %lu, trace events %lu\n", (unsigned)tickCount,
+           (unsigned)telemetry_seq, (unsigned long)ultrasonic_timeouts, (unsigned long)trace_buffer.count);
+    printf("temperature %.2f C, humidity %.2f %%RH, water content %.2f %%, distance %.1f cm, tank %lu mL, tank low %d\n",
+           sensor_to_units(temperature, 100, -2147483647L, 2147483647L) / 100.0,
+           sensor_to_units(humidity, 100, -2147483647L, 2147483647L) / 100.0,
+           sensor_to_units(water_content, 100, -2147483647L, 2147483647L) / 100.0,
+           sensor_to_units(distance, 10, 0, 2147483647L) / 10.0, (unsigned long)tank_volume, (int)isrFlag1);
+    printf("pump %s, on %.3f s in %lu switches\n", pump.on ? "on" : "off", pump.on_ms / 1000.0, pump.switches);
+    printf("schedule digest %08lx\n", (unsigned long)shim_digest());
+    if (esp32.capture != NULL)
+    {
+        fclose(esp32.capture);
+    }
+    return (sim_expect_failures() != 0) ? 1 : 0;
+}
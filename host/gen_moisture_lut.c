@@ -0,0 +1,89 @@
+// Thie file contains a host tool that generates moisture_lut.c, the ADC code to soil water content table
+// used by sensor_water_content() when MOISTURE_LUT=1.
+//
+// build: cc -O2 -o gen_moisture_lut gen_moisture_lut.c -lm
+// usage: gen_moisture_lut [vrefhi slope offset] > ../moisture_lut.c
+//        water content = (slope / volts - offset) * 100, volts = vrefhi * code / 4095
+//        defaults match sensor_math.h (3.0 2.48 0.72). The error bound report goes to stderr.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LUT_SIZE 4096
+#define Q16_LIMIT (2147483647.0 / 65536.0) //largest value representable in Q16.16
+
+int main(int argc, char **argv)
+{
+    double vref = 3.0;
+    double slope = 2.48;
+    double offset = 0.72;
+    double max_err_q16 = 0.0;
+    double max_err_float = 0.0;
+    int worst_q16 = 0;
+    int worst_float = 0;
+    int saturated = 0;
+    int code;
+
+    if (argc == 4)
+    {
+        vref = atof(argv[1]);
+        slope = atof(argv[2]);
+        offset = atof(argv[3]);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [vrefhi slope offset]\n", argv[0]);
+        return 1;
+    }
+
+    printf("// Filename:            moisture_lut.c\n");
+    printf("//\n");
+    printf("// Description:         ADC code -> soil water content table, generated by host/gen_moisture_lut.\n");
+    printf("//                      Do not edit, regenerate with: gen_moisture_lut %g %g %g\n", vref, slope, offset);
+    printf("//\n");
+    printf("// Target:              TMS320F28379D\n\n");
+    printf("#include \"sensor_math.h\"\n\n");
+    printf("#if MOISTURE_LUT\n\n");
+    printf("//placed by TMS320F28379D.cmd in flash, or copied to GS RAM at boot with MOISTURE_LUT_IN_RAM\n");
+    printf("#pragma DATA_SECTION(moisture_lut, \"MoistureLutFile\")\n");
+    printf("const sensor_t moisture_lut[MOISTURE_LUT_SIZE] = {\n");
+
+    for (code = 0; code < LUT_SIZE; code++)
+    {
+        double volts = vref * code / 4095.0;
+        double exact = (code == 0) ? INFINITY : (slope / volts - offset) * 100.0;
+        double entry = exact;
+        double q16;
+
+        if (!(entry < Q16_LIMIT))
+        {
+            entry = Q16_LIMIT; //saturate like the fixed-point path
+            saturated++;
+        }
+        else
+        {
+            q16 = floor(entry * 65536.0 + 0.5) / 65536.0;
+            if (fabs(q16 - exact) > max_err_q16)
+            {
+                max_err_q16 = fabs(q16 - exact);
+                worst_q16 = code;
+            }
+            if (fabs((float)entry - exact) > max_err_float)
+            {
+                max_err_float = fabs((float)entry - exact);
+                worst_float = code;
+            }
+        }
+        printf("%sSENSOR(%.6f)%s", (code % 4 == 0) ? "    " : "", entry,
+               (code == LUT_SIZE - 1) ? "\n" : ((code % 4 == 3) ? ",\n" : ", "));
+    }
+
+    printf("};\n\n");
+    printf("#endif\n");
+
+    fprintf(stderr, "moisture LUT: %d entries, %d saturated (codes 0..%d)\n", LUT_SIZE, saturated, saturated - 1);
+    fprintf(stderr, "max error vs exact, Q16.16: %.3g %% at code %d\n", max_err_q16, worst_q16);
+    fprintf(stderr, "max error vs exact, float:  %.3g %% at code %d\n", max_err_float, worst_float);
+    return 0;
+}
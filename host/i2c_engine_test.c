@@ -0,0 +1,314 @@
+// Thie file contains a host test of the interrupt-driven I2C-B engine (i2c_driver.h) against the
+// I2C-B and DHT20 model of sim/i2c_dht20.c, on the SYS/BIOS shim
+//
+// build: make i2c_engine_test
+// usage: i2c_engine_test [reads]     DHT20 reads timed at the end, default 20
+//
+// Only i2c_driver.c of the firmware is linked: one test task drives i2c_submit, i2c_wait and
+// i2c_transfer while the model raises I2CB_ISR and I2CB_FIFO_ISR. Checked:
+//   - a 7-byte DHT20 read after the 0xAC 0x33 0x00 trigger: status, CRC, humidity and temperature
+//   - write-then-read with the repeated START, and writes and reads longer than the 16-byte FIFOs
+//   - NACK: a wrong address, and every address NACKed while the DHT20 ignores the bus
+//   - a NACK in the middle of a queue does not stop the transactions behind it
+//   - timeout: with SCL held low (i2c_stall) i2c_wait gives up after I2C_TIMEOUT_TICKS and resets
+//     the module, the next transfer works
+//   - abort: a full queue is failed by i2c_abort, each caller's semaphore posted once; the fifth
+//     submit is refused with I2C_QUEUE_FULL
+// Then per DHT20 read (trigger plus data): bus time, I2C interrupts taken and the CPU cycles the
+// shim charged to them (-c of firmware_host, 20 per kernel call; the ISR bodies themselves cost no
+// virtual time here, time them on the target with the profile probes).
+// Every failed check is printed and the exit status is 1.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "shim/shim.h"
+#include <ti/sysbios/knl/Clock.h>
+#include "sim/sim.h"
+#include "../i2c_driver.h"
+#include "../trace_bios.h"
+
+#define CALL_CYCLES 20
+#define DHT20_WAIT_MS 80
+#define HUMIDITY 52.25
+#define TEMPERATURE 23.5
+
+extern Void I2CB_ISR(UArg arg);
+extern Void I2CB_FIFO_ISR(UArg arg);
+static Void test_task(UArg arg0, UArg arg1);
+
+static struct Task_Object task_obj = { "test", test_task, 0, 0, 9 };
+static struct Semaphore_Object i2c_sem_obj = { "i2cSem", Semaphore_Mode_BINARY, 0 };
+static struct Semaphore_Object queue_sem_obj[I2C_QUEUE_DEPTH + 1];
+static struct Hwi_Object i2c_hwi = { "I2CB_ISR", 90, I2CB_ISR, 0 };
+static struct Hwi_Object fifo_hwi = { "I2CB_FIFO_ISR", 91, I2CB_FIFO_ISR, 0 };
+const Semaphore_Handle i2cSem = &i2c_sem_obj;
+
+static const Task_Handle tasks[] = { &task_obj };
+static const Hwi_Handle hwis[] = { &i2c_hwi, &fifo_hwi };
+
+const shim_app_t shim_app = {
+    tasks, 1,
+    NULL, 0,
+    hwis, 2,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0
+};
+
+static long reads = 20;
+static unsigned long failures;
+static volatile int finished;
+
+//no trace recorder in this build
+void trace_sem_post(Semaphore_Handle sem)
+{
+    Semaphore_post(sem);
+}
+
+Bool trace_sem_pend(Semaphore_Handle sem, UInt32 timeout)
+{
+    return Semaphore_pend(sem, timeout);
+}
+
+static const char *status_name(i2c_status_t status)
+{
+    static const char *const names[] = { "PENDING", "OK", "NACK", "ARB_LOST", "TIMEOUT", "QUEUE_FULL" };
+    return (status <= I2C_QUEUE_FULL) ? names[status] : "?";
+}
+
+static void expect(const char *what, i2c_status_t got, i2c_status_t want)
+{
+    if (got != want)
+    {
+        printf("FAIL %s: %s, expected %s\n", what, status_name(got), status_name(want));
+        failures++;
+    }
+}
+
+static void check(const char *what, int ok)
+{
+    if (!ok)
+    {
+        printf("FAIL %s\n", what);
+        failures++;
+    }
+}
+
+static uint8_t crc8(const UInt8 *data, uint16_t length)
+{
+    uint8_t crc = 0xFF;
+    uint16_t i;
+    uint16_t bit;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void txn_init(i2c_txn_t *txn, UInt8 addr, const UInt8 *tx, uint16_t tx_len, UInt8 *rx, uint16_t rx_len,
+                     Semaphore_Handle done)
+{
+    txn->dev_addr = addr;
+    txn->tx_data = tx;
+    txn->tx_len = tx_len;
+    txn->rx_data = rx;
+    txn->rx_len = rx_len;
+    txn->done = done;
+}
+
+//trigger, wait, read 7 bytes and check them; returns the cycles spent in the two transfers
+static uint64_t dht20_measure(void)
+{
+    static const UInt8 trigger[] = { 0xAC, 0x33, 0x00 };
+    UInt8 data[7];
+    uint32_t srh;
+    uint32_t st;
+    uint64_t t0 = shim_now();
+    uint64_t bus;
+
+    expect("dht20 trigger", i2c_transfer(DHT20_ADDR, trigger, 3, NULL, 0), I2C_OK);
+    bus = shim_now() - t0;
+    Task_sleep(DHT20_WAIT_MS);
+    t0 = shim_now();
+    expect("dht20 read", i2c_transfer(DHT20_ADDR, NULL, 0, data, 7), I2C_OK);
+    bus += shim_now() - t0;
+    srh = ((uint32_t)data[1] << 12) | ((uint32_t)data[2] << 4) | (data[3] >> 4);
+    st = ((uint32_t)(data[3] & 0x0F) << 16) | ((uint32_t)data[4] << 8) | data[5];
+    check("dht20 status busy or uncalibrated", (data[0] & 0x98) == 0x18);
+    check("dht20 crc", crc8(data, 6) == data[6]);
+    check("dht20 humidity", fabs(srh / 1048576.0 * 100.0 - HUMIDITY) < 0.001);
+    check("dht20 temperature", fabs(st / 1048576.0 * 200.0 - 50.0 - TEMPERATURE) < 0.001);
+    return bus;
+}
+
+static void check_transfers(void)
+{
+    static const UInt8 select_reg[] = { 0x1B, 0x00, 0x00 };
+    UInt8 long_tx[40];
+    UInt8 rx[40];
+    uint16_t i;
+
+    dht20_measure();
+
+    expect("write-then-read", i2c_transfer(DHT20_ADDR, select_reg, 3, rx, 3), I2C_OK);
+    check("register read back", (rx[1] == 0x00) && (rx[2] == 0x00));
+
+    for (i = 0; i < sizeof(long_tx); i++)
+    {
+        long_tx[i] = (UInt8)(0x40 + i); //no DHT20 command starts with these
+    }
+    expect("40-byte write", i2c_transfer(DHT20_ADDR, long_tx, sizeof(long_tx), NULL, 0), I2C_OK);
+    for (i = 0; i < sizeof(rx); i++)
+    {
+        rx[i] = 0;
+    }
+    expect("40-byte read", i2c_transfer(DHT20_ADDR, NULL, 0, rx, sizeof(rx)), I2C_OK);
+    check("40-byte read tail", (rx[7] == 0xFF) && (rx[sizeof(rx) - 1] == 0xFF));
+}
+
+static void check_nack(void)
+{
+    static const UInt8 trigger[] = { 0xAC, 0x33, 0x00 };
+    UInt8 rx[7];
+    i2c_txn_t txn[3];
+    unsigned long nacks = sim_stats.i2c_nacks;
+
+    expect("wrong address write", i2c_transfer(DHT20_ADDR + 1, trigger, 3, NULL, 0), I2C_NACK);
+    expect("wrong address read", i2c_transfer(DHT20_ADDR + 1, NULL, 0, rx, 7), I2C_NACK);
+    sim_signal_set(SIM_I2C_NACK, 1.0);
+    expect("ignored write", i2c_transfer(DHT20_ADDR, trigger, 3, NULL, 0), I2C_NACK);
+    expect("ignored write-then-read", i2c_transfer(DHT20_ADDR, trigger, 1, rx, 7), I2C_NACK);
+    sim_signal_set(SIM_I2C_NACK, 0.0);
+    check("model saw 4 NACKs", sim_stats.i2c_nacks - nacks == 4);
+    expect("write after NACK", i2c_transfer(DHT20_ADDR, trigger, 3, NULL, 0), I2C_OK);
+
+    //the middle one of three queued transactions is NACKed
+    txn_init(&txn[0], DHT20_ADDR, NULL, 0, rx, 1, &queue_sem_obj[0]);
+    txn_init(&txn[1], DHT20_ADDR + 1, NULL, 0, rx, 1, &queue_sem_obj[1]);
+    txn_init(&txn[2], DHT20_ADDR, NULL, 0, rx, 1, &queue_sem_obj[2]);
+    check("queue 3", i2c_submit(&txn[0]) && i2c_submit(&txn[1]) && i2c_submit(&txn[2]));
+    expect("queued first", i2c_wait(&txn[0], I2C_TIMEOUT_TICKS), I2C_OK);
+    expect("queued NACK", i2c_wait(&txn[1], I2C_TIMEOUT_TICKS), I2C_NACK);
+    expect("queued after NACK", i2c_wait(&txn[2], I2C_TIMEOUT_TICKS), I2C_OK);
+}
+
+static void check_timeout(void)
+{
+    static const UInt8 trigger[] = { 0xAC, 0x33, 0x00 };
+    UInt8 rx[7];
+    uint32_t start;
+
+    sim_signal_set(SIM_I2C_STALL, 1.0);
+    start = Clock_getTicks();
+    expect("stalled read", i2c_transfer(DHT20_ADDR, NULL, 0, rx, 7), I2C_TIMEOUT);
+    check("timeout after I2C_TIMEOUT_TICKS", Clock_getTicks() - start >= I2C_TIMEOUT_TICKS);
+    check("timeout not much later", Clock_getTicks() - start <= I2C_TIMEOUT_TICKS + 2);
+    sim_signal_set(SIM_I2C_STALL, 0.0);
+    expect("write after timeout", i2c_transfer(DHT20_ADDR, trigger, 3, NULL, 0), I2C_OK);
+    Task_sleep(DHT20_WAIT_MS);
+    expect("read after timeout", i2c_transfer(DHT20_ADDR, NULL, 0, rx, 7), I2C_OK);
+}
+
+static void check_abort(void)
+{
+    i2c_txn_t txn[I2C_QUEUE_DEPTH + 1];
+    UInt8 rx[I2C_QUEUE_DEPTH + 1][7];
+    uint16_t i;
+
+    sim_signal_set(SIM_I2C_STALL, 1.0);
+    for (i = 0; i <= I2C_QUEUE_DEPTH; i++)
+    {
+        Semaphore_reset(&queue_sem_obj[i], 0);
+        txn_init(&txn[i], DHT20_ADDR, NULL, 0, rx[i], 7, &queue_sem_obj[i]);
+    }
+    for (i = 0; i < I2C_QUEUE_DEPTH; i++)
+    {
+        check("submit to the queue", i2c_submit(&txn[i]));
+    }
+    check("fifth submit refused", !i2c_submit(&txn[I2C_QUEUE_DEPTH]));
+    expect("fifth submit", txn[I2C_QUEUE_DEPTH].status, I2C_QUEUE_FULL);
+    Task_sleep(5);
+    expect("stalled head still pending", txn[0].status, I2C_PENDING);
+    i2c_abort();
+    for (i = 0; i < I2C_QUEUE_DEPTH; i++)
+    {
+        expect("aborted", txn[i].status, I2C_TIMEOUT);
+        check("abort posts the semaphore once", Semaphore_getCount(&queue_sem_obj[i]) == 1);
+    }
+    sim_signal_set(SIM_I2C_STALL, 0.0);
+    dht20_measure();
+}
+
+//time from submit to return, interrupts and charged cycles of trigger plus data read
+static void time_reads(void)
+{
+    uint64_t bus = 0;
+    unsigned long ints = 0;
+    uint64_t cpu = 0;
+    long n;
+
+    for (n = 0; n < reads; n++)
+    {
+        unsigned long runs = i2c_hwi.stat.runs + fifo_hwi.stat.runs;
+        uint64_t cycles = i2c_hwi.stat.cycles + fifo_hwi.stat.cycles;
+
+        bus += dht20_measure();
+        ints += i2c_hwi.stat.runs + fifo_hwi.stat.runs - runs;
+        cpu += i2c_hwi.stat.cycles + fifo_hwi.stat.cycles - cycles;
+    }
+    printf("DHT20 read (trigger + 7 bytes): %.0f cycles on the bus (%.1f us), %.1f I2C interrupts, %.0f CPU cycles in them"
+           " at %u per kernel call\n", (double)bus / reads, (double)bus / reads / (SHIM_CPU_HZ / 1e6),
+           (double)ints / reads, (double)cpu / reads, (unsigned)CALL_CYCLES);
+}
+
+static Void test_task(UArg arg0, UArg arg1)
+{
+    start_i2c();
+    check_transfers();
+    check_nack();
+    check_timeout();
+    check_abort();
+    time_reads();
+    finished = 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        reads = strtol(argv[1], NULL, 0);
+    }
+    if ((argc > 2) || (reads < 1))
+    {
+        fprintf(stderr, "usage: %s [reads]\n", argv[0]);
+        return 2;
+    }
+    shim_config.call_cycles = CALL_CYCLES;
+    shim_config.run_cycles = (uint64_t)(2 + reads / 10) * SHIM_CPU_HZ;
+    sim_signal_set(SIM_HUMIDITY, HUMIDITY);
+    sim_signal_set(SIM_TEMPERATURE, TEMPERATURE);
+    sim_i2c_init();
+    BIOS_start();
+
+    if (!finished)
+    {
+        printf("FAIL the test task did not finish\n");
+        failures++;
+    }
+    sim_report(stdout);
+    if (failures != 0)
+    {
+        printf("%lu failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
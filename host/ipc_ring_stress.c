@@ -0,0 +1,170 @@
+// Thie file contains a two-thread host stress test of the CPU1 -> CPU2 sample ring (ipc_ring.h).
+//
+// build: make ipc_ring_stress
+// usage: ipc_ring_stress [seconds]     default 2 s
+//
+// The producer thread stands in for CPU1 and pushes messages numbered 0, 1, 2, ..., retrying a
+// push the ring refused. The consumer thread stands in for CPU2 and pops them. Every field of a
+// message is derived from its number, so the consumer checks each message it gets for a field
+// that does not match the others (a torn slot) and for a number other than the next one (a lost,
+// repeated or reordered message). The run is made twice: with the counts starting at 0, and with
+// them starting just below 2^32 so the free running counts wrap within the first messages.
+// Reported: messages, refused pushes, torn and out of sequence messages. Exits 1 on any error.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../ipc_ring.h"
+
+#define WRAP_START (0xFFFFFFFFUL - 3UL * IPC_RING_DEPTH)
+
+static ipc_ring_tx_t tx;
+static ipc_ring_rx_t rx;
+static volatile int running;   //producer keeps pushing
+static volatile int draining;  //consumer empties the ring and stops
+
+typedef struct
+{
+    unsigned long messages;
+    unsigned long torn;
+    unsigned long sequence;
+} consumer_result_t;
+
+static void make_msg(ipc_msg_t *m, uint32_t n)
+{
+    uint32_t h = n * 2654435761U;
+
+    memset(m, 0, sizeof(*m));
+    m->type = IPC_MSG_SAMPLE;
+    m->reserved = (uint16_t)(n >> 16);
+    m->sample.seq = (uint16_t)n;
+    m->sample.time_ms = h;
+    m->sample.temperature_centi = (int16_t)(h >> 16);
+    m->sample.humidity_centi = (uint16_t)(h ^ 0x5A5AU);
+    m->sample.moisture_centi = (int16_t)~h;
+    m->sample.water_level_mm = (uint16_t)(h >> 8);
+    m->sample.flags = (uint16_t)(n & 0x7);
+}
+
+//number the message carries, and whether the rest of it agrees
+static uint32_t msg_number(const ipc_msg_t *m, int *torn)
+{
+    uint32_t n = ((uint32_t)m->reserved << 16) | m->sample.seq;
+    ipc_msg_t expected;
+
+    make_msg(&expected, n);
+    *torn = (m->type != expected.type) || (m->sample.time_ms != expected.sample.time_ms) ||
+            (m->sample.temperature_centi != expected.sample.temperature_centi) ||
+            (m->sample.humidity_centi != expected.sample.humidity_centi) ||
+            (m->sample.moisture_centi != expected.sample.moisture_centi) ||
+            (m->sample.water_level_mm != expected.sample.water_level_mm) || (m->sample.flags != expected.sample.flags);
+    return n;
+}
+
+static void *producer(void *arg)
+{
+    uint32_t n = 0;
+    ipc_msg_t m;
+
+    (void)arg;
+    while (running)
+    {
+        make_msg(&m, n);
+        if (ipc_ring_push(&tx, &rx, &m))
+        {
+            n++;
+        }
+        else
+        {
+            sched_yield(); //on a single core the consumer only runs when we let it
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    consumer_result_t *res = arg;
+    uint32_t next = 0;
+    ipc_msg_t m;
+
+    for (;;)
+    {
+        int torn;
+        uint32_t n;
+
+        if (!ipc_ring_pop(&tx, &rx, &m))
+        {
+            if (draining)
+            {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        n = msg_number(&m, &torn);
+        res->torn += torn;
+        res->sequence += (n != next);
+        next = n + 1U;
+        res->messages++;
+    }
+    return NULL;
+}
+
+//returns the torn plus out of sequence messages
+static unsigned long run(uint32_t start, double seconds)
+{
+    pthread_t p;
+    pthread_t c;
+    consumer_result_t res;
+    struct timespec pause;
+
+    memset(&res, 0, sizeof(res));
+    ipc_ring_tx_init(&tx);
+    ipc_ring_rx_init(&rx);
+    tx.write_count = start; //the counts only ever differ, where they start does not matter
+    rx.read_count = start;
+    running = 1;
+    draining = 0;
+    pthread_create(&c, NULL, consumer, &res);
+    pthread_create(&p, NULL, producer, NULL);
+    pause.tv_sec = (time_t)seconds;
+    pause.tv_nsec = (long)((seconds - (double)pause.tv_sec) * 1e9);
+    nanosleep(&pause, NULL);
+    running = 0;
+    pthread_join(p, NULL);
+    while (ipc_ring_count(&tx, &rx) != 0)
+    {
+        sched_yield();
+    }
+    draining = 1;
+    pthread_join(c, NULL);
+
+    printf("counts from 0x%08lx: %lu messages (%.1f M/s), %lu pushes refused, %lu torn, %lu out of sequence,"
+           " counts now 0x%08lx\n", (unsigned long)start, res.messages, res.messages / seconds / 1e6,
+           (unsigned long)tx.dropped, res.torn, res.sequence, (unsigned long)rx.read_count);
+    if (res.messages != tx.write_count - start)
+    {
+        printf("  %lu messages pushed but not received\n", (unsigned long)(tx.write_count - start) - res.messages);
+        res.sequence++;
+    }
+    return res.torn + res.sequence;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = (argc >= 2) ? atof(argv[1]) : 2.0;
+    unsigned long errors;
+
+    if ((argc > 2) || (seconds <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+        return 2;
+    }
+    errors = run(0, seconds / 2);
+    errors += run((uint32_t)WRAP_START, seconds / 2);
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// Thie file contains a host tool that replays ADC codes through the CLA moisture filter/hysteresis
+// (moisture_ctrl.h), the same integer code CLA task 1 and the CPU path (Swi0) run, to tune the
+// thresholds off target and to check a recorded trace against it.
+//
+// build: make moisture_replay
+// usage: moisture_replay [on_percent off_percent shift] < codes.txt > replay.csv
+//        moisture_replay -c recorded.csv [on_percent off_percent shift]
+//        codes.txt holds one averaged ADC code per line, defaults match moisture_ctrl.h.
+//        Output: count,code,filtered,water_content,pump_on
+//
+// Every step is also checked against the thresholds in %: the pump must be on once the water
+// content of the filtered code is below on_percent, off once it is above off_percent, and keep
+// its state in between. The water content here is the datasheet formula in double, so this
+// checks the code thresholds of moisture_ctrl_params_init and the compare in moisture_ctrl_step.
+// With -c the input is a trace in the output format above (header line optional, e.g.
+// scenarios/moisture_replay.csv): its codes are replayed and count, filtered and pump_on must
+// match the recorded ones. Mismatches are printed, the exit status is 1 if there was any.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../sensor_math.h"
+#include "../moisture_ctrl.h"
+
+#define MAX_REPORTED 10 //mismatches printed, the rest are only counted
+
+static unsigned long mismatches;
+
+static void mismatch(unsigned long line, const char *what, unsigned long got, unsigned long expected)
+{
+    if (mismatches++ < MAX_REPORTED)
+    {
+        fprintf(stderr, "line %lu: %s %lu, expected %lu\n", line, what, got, expected);
+    }
+}
+
+static double exact_water(uint32_t code)
+{
+    return (MOISTURE_SLOPE / (VREFHI * code / ADC_FULL_SCALE) - MOISTURE_OFFSET) * 100.0;
+}
+
+//pump state the % thresholds give for this filtered code, after the previous state
+static uint32_t reference_pump(uint32_t code, uint32_t previous, double on, double off)
+{
+    double water = exact_water(code);
+
+    if (water < on)
+    {
+        return 1;
+    }
+    if (water > off)
+    {
+        return 0;
+    }
+    return previous;
+}
+
+int main(int argc, char **argv)
+{
+    moisture_ctrl_params_t params;
+    moisture_ctrl_state_t state;
+    moisture_ctrl_out_t out;
+    double on = MOISTURE_PUMP_ON;
+    double off = MOISTURE_PUMP_OFF;
+    unsigned long shift = MOISTURE_FILTER_SHIFT;
+    FILE *recorded = NULL;
+    char text[128];
+    unsigned long line = 0;
+    unsigned long steps = 0;
+    uint32_t reference = 0;
+    int first = 1;
+
+    if ((argc >= 3) && (strcmp(argv[1], "-c") == 0))
+    {
+        recorded = fopen(argv[2], "r");
+        if (recorded == NULL)
+        {
+            perror(argv[2]);
+            return 2;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc == 4)
+    {
+        on = atof(argv[1]);
+        off = atof(argv[2]);
+        shift = strtoul(argv[3], NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: moisture_replay [-c recorded.csv] [on_percent off_percent shift] < codes.txt\n");
+        return 2;
+    }
+    if (shift > 16)
+    {
+        fprintf(stderr, "shift must be 0..16\n");
+        return 2;
+    }
+
+    moisture_ctrl_params_init(&params, on, off, (uint32_t)shift);
+    moisture_ctrl_reset(&state);
+    fprintf(stderr, "pump on at code >= %ld, off at code <= %ld\n", (long)params.on_code, (long)params.off_code);
+
+    if (recorded == NULL)
+    {
+        printf("count,code,filtered,water_content,pump_on\n");
+    }
+    while (fgets(text, sizeof(text), (recorded != NULL) ? recorded : stdin) != NULL)
+    {
+        unsigned long count = 0;
+        unsigned long code;
+        unsigned long filtered = 0;
+        double water;
+        unsigned long pump_on = 0;
+
+        line++;
+        if (recorded != NULL)
+        {
+            if (sscanf(text, "%lu,%lu,%lu,%lf,%lu", &count, &code, &filtered, &water, &pump_on) != 5)
+            {
+                if (!first || (strncmp(text, "count,", 6) != 0))
+                {
+                    fprintf(stderr, "line %lu: not a replay record\n", line);
+                    mismatches++;
+                }
+                first = 0;
+                continue;
+            }
+        }
+        else if (sscanf(text, "%lu", &code) != 1)
+        {
+            continue;
+        }
+        first = 0;
+        if (code > 4095)
+        {
+            fprintf(stderr, "line %lu: skipping code %lu, not a 12-bit value\n", line, code);
+            continue;
+        }
+        moisture_ctrl_step(&state, &params, (uint32_t)code, &out);
+        steps++;
+        reference = reference_pump(out.code, reference, on, off);
+        if (out.pump_on != reference)
+        {
+            mismatch(line, "pump_on against the % thresholds", out.pump_on, reference);
+        }
+        if (recorded != NULL)
+        {
+            if (out.count != count)
+            {
+                mismatch(line, "count", out.count, count);
+            }
+            if (out.code != filtered)
+            {
+                mismatch(line, "filtered", out.code, filtered);
+            }
+            if (out.pump_on != pump_on)
+            {
+                mismatch(line, "pump_on", out.pump_on, pump_on);
+            }
+        }
+        else
+        {
+            printf("%lu,%lu,%lu,%.2f,%lu\n", (unsigned long)out.count, code, (unsigned long)out.code,
+                   SENSOR_TO_FLOAT(sensor_water_content((uint16_t)out.code)), (unsigned long)out.pump_on);
+        }
+    }
+    if (recorded != NULL)
+    {
+        fclose(recorded);
+        fprintf(stderr, "%lu steps, %lu mismatches\n", steps, mismatches);
+    }
+    return (mismatches != 0) ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+// Thie file contains the host checks and the per-probe overhead benchmark of the profiler (profile.h).
+//
+// build: cc -O2 -o profile_bench profile_bench.c profile_decode.c ../profile.c ../telemetry.c
+//        add -DPROFILE_NO_CLZ to check the shift loop the C28x uses for the bucket instead of clz
+// usage: profile_bench [records]     records for the timed runs, default 100000000
+//
+// Checks, each printed ok/FAIL (non-zero exit on any failure):
+//   bucket     profile_bucket() against a bit scan for every power of two, its neighbours and random values
+//   stats      count, min, max, sum and histogram after a known sequence
+//   frames     every probe (empty, one bucket, all 32 buckets) encodes within PROFILE_FRAME_MAX and
+//              decodes back identically from a stream that also carries telemetry frames and noise
+// Then times profile_record() against the single store of the old elapsedTime globals.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "profile_decode.h"
+#include "../telemetry.h"
+
+static int failures = 0;
+static volatile uint32_t elapsed_store; //stands in for an elapsedTime global
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void result(const char *name, int ok)
+{
+    failures |= !ok;
+    printf("%-10s %s\n", name, ok ? "ok" : "FAIL");
+}
+
+static uint32_t rng = 2463534242U;
+
+static uint32_t next_random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int bucket_reference(uint32_t v)
+{
+    int b = 0;
+
+    while ((v >> 1) != 0)
+    {
+        v >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static void check_bucket(void)
+{
+    int ok = 1;
+    int i;
+
+    for (i = 0; i < 32; i++)
+    {
+        uint32_t v = 1UL << i;
+        ok &= (profile_bucket(v) == bucket_reference(v)) && (profile_bucket(v - 1) == bucket_reference(v - 1)) &&
+              (profile_bucket(v + 1) == bucket_reference(v + 1));
+    }
+    ok &= (profile_bucket(0) == 0) && (profile_bucket(0xFFFFFFFFUL) == 31);
+    for (i = 0; i < 1000000; i++)
+    {
+        uint32_t v = next_random() >> (next_random() & 31);
+        ok &= profile_bucket(v) == bucket_reference(v);
+    }
+    result("bucket", ok);
+}
+
+static void check_stats(void)
+{
+    static const uint32_t durations[] = { 0, 1, 2, 3, 1000, 1023, 1024, 200000, 0xFFFFFFFFUL };
+    const profile_probe_t *p = &profile_probes[PROFILE_SWI];
+    uint64_t sum = 0;
+    int ok = 1;
+    unsigned i;
+
+    profile_init();
+    for (i = 0; i < sizeof(durations) / sizeof(durations[0]); i++)
+    {
+        profile_record(PROFILE_SWI, durations[i]);
+        sum += durations[i];
+    }
+    ok &= (p->count == 9) && (p->min == 0) && (p->max == 0xFFFFFFFFUL) && (p->sum == sum);
+    ok &= (p->hist[0] == 2) && (p->hist[1] == 2) && (p->hist[9] == 2) && (p->hist[10] == 1) &&
+          (p->hist[17] == 1) && (p->hist[31] == 1);
+    ok &= (profile_probes[PROFILE_SWI + 1].count == 0) && (profile_probes[PROFILE_SWI + 1].min == 0xFFFFFFFFUL);
+    result("stats", ok);
+}
+
+static void check_frames(void)
+{
+    static unsigned char stream[PROFILE_PROBES * 4 * PROFILE_FRAME_MAX * 2];
+    static profile_decoder_t dec;
+    size_t length = 0;
+    int ok = 1;
+    int probe;
+    size_t i;
+
+    profile_init();
+    //probe 0 stays empty, probe 1 gets one bucket, the rest spread over all 32
+    profile_record(1, 12345);
+    for (probe = 2; probe < PROFILE_PROBES; probe++)
+    {
+        for (i = 0; i < 5000; i++)
+        {
+            profile_record((uint16_t)probe, next_random() >> (next_random() & 31));
+        }
+        profile_record((uint16_t)probe, 0xFFFFFFFFUL);
+        profile_record((uint16_t)probe, 0);
+    }
+    for (probe = 0; probe < PROFILE_PROBES; probe++)
+    {
+        uint16_t frames = profile_frames(&profile_probes[probe]);
+        uint16_t part;
+        telemetry_sample_t sample = { 1, 2, 3, 4, 5, 6, 7 };
+
+        length += telemetry_encode(stream + length, &sample); //other traffic on the line
+        stream[length++] = PROFILE_SYNC0;                     //and a false start
+        for (part = 0; part < frames; part++)
+        {
+            uint16_t n = profile_encode(stream + length, (uint16_t)probe, &profile_probes[probe], part);
+            ok &= n <= PROFILE_FRAME_MAX;
+            length += n;
+        }
+    }
+
+    profile_decoder_init(&dec);
+    for (i = 0; i < length; i++)
+    {
+        profile_decoder_push(&dec, stream[i]);
+    }
+    for (probe = 0; probe < PROFILE_PROBES; probe++)
+    {
+        ok &= dec.seen[probe] && (memcmp(&dec.probe[probe], &profile_probes[probe], sizeof(profile_probe_t)) == 0);
+    }
+    printf("           %lu bytes, %lu profile frames, %lu bad\n", (unsigned long)length, dec.frames, dec.crc_errors);
+    result("frames", ok);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long records = (argc == 2) ? strtoul(argv[1], NULL, 0) : 100000000UL;
+    uint32_t *durations;
+    unsigned long n;
+    double t0;
+    double t_store;
+    double t_record;
+
+    if ((argc > 2) || (records == 0))
+    {
+        fprintf(stderr, "usage: %s [records]\n", argv[0]);
+        return 1;
+    }
+    check_bucket();
+    check_stats();
+    check_frames();
+
+    //durations spread like a real probe, over a handful of buckets
+    durations = malloc(4096 * sizeof(uint32_t));
+    for (n = 0; n < 4096; n++)
+    {
+        durations[n] = 2000 + (next_random() & 0x3FFF);
+    }
+    t0 = now_ns();
+    for (n = 0; n < records; n++)
+    {
+        elapsed_store = durations[n & 4095];
+    }
+    t_store = (now_ns() - t0) / records;
+    profile_init();
+    t0 = now_ns();
+    for (n = 0; n < records; n++)
+    {
+        profile_record(PROFILE_TSK1, durations[n & 4095]);
+    }
+    t_record = (now_ns() - t0) / records;
+    printf("store      %.2f ns\nrecord     %.2f ns (%.2f ns over the plain store)\n", t_store, t_record, t_record - t_store);
+    free(durations);
+    return failures || (profile_probes[PROFILE_TSK1].count != records);
+}
@@ -0,0 +1,128 @@
+// Thie file contains the host side decoder for the profile frames (see profile.h)
+
+#include <string.h>
+#include "profile_decode.h"
+#include "../telemetry.h"
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+void profile_decoder_init(profile_decoder_t *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+}
+
+//checks and applies a whole frame in dec->buf, returns the probe or -1
+static int profile_apply(profile_decoder_t *dec)
+{
+    const uint8_t *p = dec->buf + PROFILE_HEADER_SIZE;
+    size_t payload = dec->buf[3];
+    profile_probe_t *probe;
+    unsigned first;
+    unsigned n;
+    unsigned b;
+
+    if (telemetry_crc16(dec->buf + 2, (uint16_t)(PROFILE_HEADER_SIZE - 2 + payload)) !=
+        get_u16(dec->buf + PROFILE_HEADER_SIZE + payload))
+    {
+        return -1;
+    }
+    if ((payload < 2) || (p[0] >= PROFILE_PROBES))
+    {
+        return -1;
+    }
+    probe = &dec->probe[p[0]];
+    if (p[1] == PROFILE_KIND_STATS)
+    {
+        if (payload != PROFILE_STATS_PAYLOAD)
+        {
+            return -1;
+        }
+        memset(probe, 0, sizeof(*probe)); //a new dump of this probe starts here
+        probe->count = get_u32(p + 2);
+        probe->min = get_u32(p + 6);
+        probe->max = get_u32(p + 10);
+        probe->sum = get_u32(p + 14) | ((uint64_t)get_u32(p + 18) << 32);
+        dec->seen[p[0]] = 1;
+        return p[0];
+    }
+    if (p[1] != PROFILE_KIND_HIST)
+    {
+        return -1;
+    }
+    first = p[2];
+    n = p[3];
+    if ((payload != 4 + 4 * n) || (first + n > PROFILE_BUCKETS))
+    {
+        return -1;
+    }
+    for (b = 0; b < n; b++)
+    {
+        probe->hist[first + b] = get_u32(p + 4 + 4 * b);
+    }
+    return p[0];
+}
+
+int profile_decoder_push(profile_decoder_t *dec, uint8_t byte)
+{
+    int probe;
+
+    dec->buf[dec->fill++] = byte;
+
+    //hunt for the sync word, anything else on the line (telemetry frames) is skipped
+    if ((dec->fill == 1) && (byte != PROFILE_SYNC0))
+    {
+        dec->fill = 0;
+        return -1;
+    }
+    if ((dec->fill == 2) && (byte != PROFILE_SYNC1))
+    {
+        dec->fill = (byte == PROFILE_SYNC0) ? 1 : 0;
+        return -1;
+    }
+    if ((dec->fill == 4) && ((dec->buf[2] != PROFILE_VERSION) ||
+        (dec->buf[3] + PROFILE_HEADER_SIZE + PROFILE_CRC_SIZE > PROFILE_FRAME_MAX)))
+    {
+        probe = -1;
+    }
+    else if ((dec->fill < 4) || (dec->fill < (size_t)dec->buf[3] + PROFILE_HEADER_SIZE + PROFILE_CRC_SIZE))
+    {
+        return -1;
+    }
+    else
+    {
+        probe = profile_apply(dec);
+    }
+
+    if (probe >= 0)
+    {
+        dec->fill = 0;
+        dec->frames++;
+        return probe;
+    }
+
+    //bad frame: restart the hunt one byte past the false sync
+    dec->crc_errors++;
+    {
+        size_t i;
+        size_t start = dec->fill;
+        for (i = 1; i < dec->fill; i++)
+        {
+            if (dec->buf[i] == PROFILE_SYNC0)
+            {
+                start = i;
+                break;
+            }
+        }
+        memmove(dec->buf, dec->buf + start, dec->fill - start);
+        dec->fill -= start;
+    }
+    return -1;
+}
@@ -0,0 +1,30 @@
+/*
+ * profile_decode.h
+ *
+ * Host side decoder for the profile frames produced by profile_encode(). Frames are fed a
+ * byte at a time from a UART capture that may interleave telemetry frames, which are skipped.
+ * Build together with ../profile.c and ../telemetry.c.
+ */
+
+#ifndef PROFILE_DECODE_H_
+#define PROFILE_DECODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../profile.h"
+
+typedef struct
+{
+    uint8_t buf[PROFILE_FRAME_MAX];
+    size_t fill;
+    unsigned long frames;     //good frames
+    unsigned long crc_errors; //frames dropped on CRC or header mismatch
+    profile_probe_t probe[PROFILE_PROBES]; //rebuilt from the frames, last dump wins
+    int seen[PROFILE_PROBES];              //a stats frame arrived for the probe
+} profile_decoder_t;
+
+void profile_decoder_init(profile_decoder_t *dec);
+//Feeds one received byte, returns the probe number when a good frame completes, else -1.
+int profile_decoder_push(profile_decoder_t *dec, uint8_t byte);
+
+#endif /* PROFILE_DECODE_H_ */
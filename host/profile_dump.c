@@ -0,0 +1,96 @@
+// Thie file contains a host tool that prints the execution-time profile dumped over the UART (profile.h)
+//
+// build: cc -O2 -o profile_dump profile_dump.c profile_decode.c ../profile.c ../telemetry.c
+// usage: profile_dump [capture.bin [counts_per_us]]   (reads stdin when no file is given, 200 counts/us)
+//
+// Send 'P' to the board to get a dump. Telemetry frames in the same capture are skipped.
+// For every probe it prints count, min, mean and max in us and the log2 histogram.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "profile_decode.h"
+
+#define BAR_WIDTH 40
+
+static void print_probe(const profile_probe_t *p, const char *name, double per_us)
+{
+    uint32_t largest = 0;
+    int b;
+
+    if (p->count == 0)
+    {
+        printf("%-6s %10d runs\n", name, 0);
+        return;
+    }
+    printf("%-6s %10lu runs  min %10.2f  mean %10.2f  max %10.2f us\n", name, (unsigned long)p->count,
+           p->min / per_us, (double)p->sum / p->count / per_us, p->max / per_us);
+    for (b = 0; b < PROFILE_BUCKETS; b++)
+    {
+        if (p->hist[b] > largest)
+        {
+            largest = p->hist[b];
+        }
+    }
+    for (b = 0; b < PROFILE_BUCKETS; b++)
+    {
+        char bar[BAR_WIDTH + 1];
+        int width;
+
+        if (p->hist[b] == 0)
+        {
+            continue;
+        }
+        width = (int)((double)p->hist[b] * BAR_WIDTH / largest + 0.5);
+        memset(bar, '#', (size_t)width);
+        bar[width] = '\0';
+        printf("  %12.2f us+ %10lu %5.1f%% %s\n", ((b == 0) ? 0.0 : (double)(1UL << b)) / per_us,
+               (unsigned long)p->hist[b], 100.0 * p->hist[b] / p->count, bar);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in = stdin;
+    static profile_decoder_t dec;
+    double per_us = (argc > 2) ? atof(argv[2]) : 200.0;
+    unsigned long bytes = 0;
+    int c;
+    int i;
+
+    if ((argc > 3) || (per_us <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [capture.bin [counts_per_us]]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 1)
+    {
+        in = fopen(argv[1], "rb");
+        if (in == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    profile_decoder_init(&dec);
+    while ((c = fgetc(in)) != EOF)
+    {
+        bytes++;
+        profile_decoder_push(&dec, (uint8_t)c);
+    }
+    for (i = 0; i < PROFILE_PROBES; i++)
+    {
+        if (dec.seen[i])
+        {
+            print_probe(&dec.probe[i], profile_probe_names[i], per_us);
+        }
+    }
+    fprintf(stderr, "%lu bytes, %lu profile frames, %lu bad frames\n", bytes, dec.frames, dec.crc_errors);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    return 0;
+}
@@ -0,0 +1,554 @@
+// Thie file contains the response time analysis of the whole app.cfg thread set against a profile dump
+//
+// build: make rta_report
+// usage: rta_report [-g app.cfg] [-a hz] [-o cycles] [-c fxn=cycles]... [capture.bin]
+//   -g  app.cfg to analyse, default ../app.cfg
+//   -a  Timer1 (ADC trigger) rate to analyse instead of the app.cfg period, Hz
+//   -o  C28x cycles the dispatcher adds to every run of a thread, default 120
+//   -c  execution time of a thread function in cycles, replaces its probe; repeat for more.
+//       myTickFxn has no probe (it runs at 100 kHz): take it from wcet_harness, -c myTickFxn=810
+//   capture.bin: profile dump of the target ('P' on SCIB) or of firmware_host -u
+//
+// Priorities, the Hwi, Swi and task functions, the semaphores and the timer periods come from
+// app.cfg. Who posts what, and how often, is SoilMonitor_main.c's and is written down in main():
+//   myTickFxn    Timer0 Hwi, every Timer0 period
+//   Clock        Timer2 Hwi and the top priority Swi, every Clock tick
+//   myHwi, Swi0  every Timer1 period
+//   ECAP_ISR     every two ranging periods (4-event capture), posts mySem1
+//   Tsk0         mySem, from myTickFxn every TICK_POSTS ticks and from itself at the end of
+//                every loop, so it runs back to back and its Task_sleep sets the period
+//   Tsk1         mySem1 from ECAP_ISR, or the ULTRASONIC_TIMEOUT_TICKS timeout
+//   Tsk2         mySem2, from Tsk0 every loop
+// A thread's execution time is the maximum of its probe plus -o. Probes are wall time, with
+// preemption in them, so this is pessimistic. A task's Task_sleep less one tick is taken out of
+// its probe and comes back as self-suspension: the task's response is the sleep plus the
+// response of its run, which the sleep cuts in two, each part open to a release of every thread
+// above; to the tasks below the sleep is release jitter. c28 Hwis nest (maskSetting SELF),
+// Swis and tasks preempt by priority, tasks of equal priority count as preempting each other.
+// Hwi_disable sections, I2C timeouts, the DHT20 re-init path, the I2C-B and SCIB interrupts and
+// the dumps of Tsk2 are left out.
+//
+// Prints per thread the period, deadline, execution time, utilisation, the utilisation of the
+// thread and everything that preempts it, the response time and MISS (past the deadline) or
+// STARVED (that utilisation reaches 100 %: the thread may never run). Then the rate monotonic
+// order of the tasks and, when app.cfg differs from it, the response times under that order.
+// Exits 1 on a miss or a starved thread with the app.cfg priorities. A thread with neither a
+// probe in the capture nor -c counts the dispatch only; the figures are then printed but are
+// not an analysis, and the exit status is 2 whatever they say.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cfg_parse.h"
+#include "profile_decode.h"
+#include "../ultrasonic.h"
+
+#define USAGE "usage: %s [-g app.cfg] [-a hz] [-o cycles] [-c fxn=cycles]... [capture.bin]\n"
+
+#define DEFAULT_DISPATCH_CYCLES 120
+#define THREADS 12
+#define TICK_POSTS 10000         //myTickFxn posts mySem when tickCount % 10000 == 0
+#define TSK0_SLEEP_TICKS 80      //Task_sleep(80) for the DHT20 measurement
+
+typedef enum
+{
+    LEVEL_HWI,
+    LEVEL_SWI,
+    LEVEL_TASK
+} level_t;
+
+typedef struct
+{
+    const char *name;
+    const char *fxn;
+    level_t level;
+    long priority;               //Swi or task priority
+    int probe;                   //PROFILE_ probe, -1 if none
+    const char *released;        //what posts it
+    double period;               //cycles, shortest time between two releases
+    double deadline;
+    double sleep;                //self-suspension per run
+    uint16_t segments;           //parts the sleeps cut a run into
+    double cycles;               //execution time
+    const char *source;
+    double utilisation;          //of the thread and every thread that preempts it
+    double response;
+} thread_t;
+
+typedef struct
+{
+    char fxn[CFG_NAME_SIZE];
+    double cycles;
+    int used;
+} override_t;
+
+static uint32_t dispatch_cycles = DEFAULT_DISPATCH_CYCLES;
+static override_t overrides[THREADS];
+static uint16_t override_count;
+
+static const char *const level_names[] = { "hwi", "swi", "task" };
+
+/* ======== threads ======== */
+static thread_t *find_thread(thread_t *threads, uint16_t count, const char *fxn)
+{
+    uint16_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (strcmp(threads[i].fxn, fxn) == 0)
+        {
+            return &threads[i];
+        }
+    }
+    return NULL;
+}
+
+static int add_thread(thread_t *t, const cfg_t *cfg, cfg_kind_t kind, const char *fxn, int probe, const char *released)
+{
+    const cfg_object_t *o = cfg_find_fxn(cfg, kind, fxn);
+
+    if (o == NULL)
+    {
+        fprintf(stderr, "app.cfg has no %s for %s\n", (kind == CFG_TASK) ? "Task" : (kind == CFG_SWI) ? "Swi" : "Hwi",
+                fxn);
+        return -1;
+    }
+    memset(t, 0, sizeof(*t));
+    t->name = o->name;
+    t->fxn = fxn;
+    t->level = (kind == CFG_TASK) ? LEVEL_TASK : (kind == CFG_SWI) ? LEVEL_SWI : LEVEL_HWI;
+    t->priority = (kind == CFG_HWI) ? 0 : cfg_priority(cfg, o);
+    t->probe = probe;
+    t->released = released;
+    t->segments = 1;
+    t->cycles = dispatch_cycles;
+    t->source = "none";
+    return 0;
+}
+
+//the semaphore a task pends on must be in app.cfg; a counting one queues the posts up
+static int check_semaphore(const cfg_t *cfg, const thread_t *t, const char *sem)
+{
+    const cfg_object_t *o = cfg_find(cfg, CFG_SEMAPHORE, sem);
+
+    if (o == NULL)
+    {
+        fprintf(stderr, "app.cfg has no semaphore %s for %s\n", sem, t->name);
+        return -1;
+    }
+    if (!o->binary)
+    {
+        printf("note: %s is a counting semaphore, posts while %s runs queue up and the period below is optimistic\n",
+               sem, t->name);
+    }
+    return 0;
+}
+
+//probe maxima of the capture, the idle probe's count in idle_runs (-1 if it has none)
+static int apply_capture(const char *path, thread_t *threads, uint16_t count, long *idle_runs)
+{
+    static profile_decoder_t dec;
+    FILE *in = fopen(path, "rb");
+    uint16_t i;
+    int c;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    profile_decoder_init(&dec);
+    while ((c = fgetc(in)) != EOF)
+    {
+        profile_decoder_push(&dec, (uint8_t)c);
+    }
+    fclose(in);
+    if (dec.crc_errors != 0)
+    {
+        fprintf(stderr, "%s: %lu profile frames with a bad CRC\n", path, dec.crc_errors);
+    }
+    for (i = 0; i < count; i++)
+    {
+        thread_t *t = &threads[i];
+
+        if (t->probe < 0)
+        {
+            continue;
+        }
+        if (!dec.seen[t->probe] || (dec.probe[t->probe].count == 0))
+        {
+            fprintf(stderr, "%s: no %s probe, %s counts the dispatch only\n", path, profile_probe_names[t->probe],
+                    t->fxn);
+            continue;
+        }
+        t->cycles = (double)dec.probe[t->probe].max - t->sleep + dispatch_cycles;
+        t->cycles = (t->cycles < dispatch_cycles) ? dispatch_cycles : t->cycles;
+        t->source = "probe";
+    }
+    *idle_runs = dec.seen[PROFILE_IDLE] ? (long)dec.probe[PROFILE_IDLE].count : -1;
+    return 0;
+}
+
+static void apply_overrides(thread_t *threads, uint16_t count)
+{
+    uint16_t i;
+
+    for (i = 0; i < override_count; i++)
+    {
+        thread_t *t = find_thread(threads, count, overrides[i].fxn);
+
+        if (t != NULL)
+        {
+            t->cycles = overrides[i].cycles;
+            t->source = "-c";
+            overrides[i].used = 1;
+        }
+    }
+}
+
+/* ======== analysis ======== */
+//o can run while t is released and not finished
+static int preempts(const thread_t *o, const thread_t *t)
+{
+    if (o == t)
+    {
+        return 0;
+    }
+    if (o->level != t->level)
+    {
+        return o->level < t->level;
+    }
+    if (o->level == LEVEL_HWI)
+    {
+        return 1;
+    }
+    return (o->level == LEVEL_TASK) ? (o->priority >= t->priority) : (o->priority > t->priority);
+}
+
+//response of t: its sleep, its run and every release of the threads above, a sleeping one released late
+static double response_time(const thread_t *threads, uint16_t count, const thread_t *t)
+{
+    double r = t->cycles;
+    double last = 0.0;
+
+    while ((r != last) && (r <= 1e3 * t->deadline))
+    {
+        uint16_t j;
+        last = r;
+        r = t->cycles;
+        for (j = 0; j < count; j++)
+        {
+            const thread_t *o = &threads[j];
+            if (preempts(o, t))
+            {
+                r += (ceil((last + o->sleep) / o->period) + t->segments - 1) * o->cycles;
+            }
+        }
+    }
+    return r + t->sleep;
+}
+
+//fills in utilisation and response, returns the misses and starved threads
+static int analyse(thread_t *threads, uint16_t count)
+{
+    int failed = 0;
+    uint16_t i;
+    uint16_t j;
+
+    for (i = 0; i < count; i++)
+    {
+        thread_t *t = &threads[i];
+
+        t->utilisation = t->cycles / t->period;
+        for (j = 0; j < count; j++)
+        {
+            if (preempts(&threads[j], t))
+            {
+                t->utilisation += threads[j].cycles / threads[j].period;
+            }
+        }
+        t->response = (t->utilisation < 1.0) ? response_time(threads, count, t) : HUGE_VAL;
+        failed += t->response > t->deadline;
+    }
+    return failed;
+}
+
+static const char *verdict(const thread_t *t)
+{
+    if (t->utilisation >= 1.0)
+    {
+        return "STARVED";
+    }
+    return (t->response <= t->deadline) ? "ok" : "MISS";
+}
+
+static void print_threads(const thread_t *threads, uint16_t count, double us)
+{
+    uint16_t i;
+
+    printf("%-9s %-10s %-8s %12s %12s %10s %10s %7s %7s %12s %-7s %s\n", "thread", "fxn", "level", "period us",
+           "deadline us", "exec cyc", "exec us", "U %", "U+hp %", "response us", "", "released by");
+    for (i = 0; i < count; i++)
+    {
+        const thread_t *t = &threads[i];
+        char level[16];
+
+        if (t->level == LEVEL_HWI)
+        {
+            strcpy(level, level_names[t->level]);
+        }
+        else
+        {
+            snprintf(level, sizeof(level), "%s %ld", level_names[t->level], t->priority);
+        }
+        printf("%-9s %-10s %-8s %12.1f %12.1f %10.0f %10.2f %7.3f %7.2f %12.2f %-7s %s (%s)\n", t->name, t->fxn, level,
+               t->period / us, t->deadline / us, t->cycles, t->cycles / us, 100.0 * t->cycles / t->period,
+               100.0 * t->utilisation, t->response / us, verdict(t), t->released, t->source);
+    }
+}
+
+static int by_period(const void *a, const void *b)
+{
+    const thread_t *x = *(const thread_t *const *)a;
+    const thread_t *y = *(const thread_t *const *)b;
+
+    if (x->period != y->period)
+    {
+        return (x->period < y->period) ? -1 : 1;
+    }
+    return (x->priority > y->priority) ? -1 : (x->priority < y->priority); //ties keep the app.cfg order
+}
+
+//task priorities by period, shortest highest, over the priorities app.cfg already uses
+static void rate_monotonic(const thread_t *threads, uint16_t count, double us)
+{
+    thread_t rm[THREADS];
+    const thread_t *order[THREADS];
+    long priorities[THREADS];
+    uint16_t tasks = 0;
+    int differs = 0;
+    uint16_t i;
+    uint16_t j;
+
+    for (i = 0; i < count; i++)
+    {
+        if (threads[i].level == LEVEL_TASK)
+        {
+            order[tasks] = &threads[i];
+            priorities[tasks++] = threads[i].priority;
+        }
+    }
+    qsort(order, tasks, sizeof(order[0]), by_period);
+    for (i = 1; i < tasks; i++) //priorities highest first, for handing out in order
+    {
+        for (j = i; (j > 0) && (priorities[j] > priorities[j - 1]); j--)
+        {
+            long p = priorities[j];
+            priorities[j] = priorities[j - 1];
+            priorities[j - 1] = p;
+        }
+    }
+    printf("rate monotonic task order:");
+    for (i = 0; i < tasks; i++)
+    {
+        printf(" %s (%.1f ms)", order[i]->name, order[i]->period / us / 1e3);
+        differs |= order[i]->priority != priorities[i];
+    }
+    printf("; app.cfg %s\n", differs ? "differs" : "follows it");
+    if (!differs)
+    {
+        return;
+    }
+
+    memcpy(rm, threads, count * sizeof(thread_t));
+    for (i = 0; i < tasks; i++)
+    {
+        rm[order[i] - threads].priority = priorities[i];
+    }
+    analyse(rm, count);
+    for (i = 0; i < tasks; i++)
+    {
+        const thread_t *t = &rm[order[i] - threads];
+        printf("  %-9s task %-3ld (app.cfg %ld)  U+hp %7.2f %%  response %12.2f us  %s\n", t->name, t->priority,
+               order[i]->priority, 100.0 * t->utilisation, t->response / us, verdict(t));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static cfg_t cfg;
+    thread_t threads[THREADS];
+    const char *cfg_path = "../app.cfg";
+    const cfg_object_t *timer0;
+    const cfg_object_t *timer1;
+    thread_t *tsk0;
+    double adc_hz = 0.0;
+    double adc_period;
+    double tick_period;
+    double clock_period;
+    double ranging;
+    double us;
+    double total = 0.0;
+    long idle_runs = -1;
+    uint16_t count = 0;
+    uint16_t tasks = 0;
+    uint16_t missing = 0;
+    int failed;
+    uint16_t i;
+    int c;
+
+    while ((c = getopt(argc, argv, "g:a:o:c:")) != -1)
+    {
+        char *eq;
+
+        switch (c)
+        {
+        case 'g':
+            cfg_path = optarg;
+            break;
+        case 'a':
+            adc_hz = atof(optarg);
+            break;
+        case 'o':
+            dispatch_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'c':
+            eq = strchr(optarg, '=');
+            if ((eq == NULL) || (eq - optarg >= CFG_NAME_SIZE) || (override_count >= THREADS))
+            {
+                fprintf(stderr, USAGE, argv[0]);
+                return 2;
+            }
+            memcpy(overrides[override_count].fxn, optarg, (size_t)(eq - optarg));
+            overrides[override_count].fxn[eq - optarg] = '\0';
+            overrides[override_count++].cycles = atof(eq + 1);
+            break;
+        default:
+            fprintf(stderr, USAGE, argv[0]);
+            return 2;
+        }
+    }
+    if ((adc_hz < 0.0) || (argc - optind > 1))
+    {
+        fprintf(stderr, USAGE, argv[0]);
+        return 2;
+    }
+    if (cfg_load(cfg_path, &cfg) != 0)
+    {
+        return 2;
+    }
+    timer0 = cfg_find_fxn(&cfg, CFG_TIMER, "myTickFxn");
+    timer1 = cfg_find_timer(&cfg, 1);
+    if ((timer0 == NULL) || (timer1 == NULL))
+    {
+        fprintf(stderr, "%s: no myTickFxn timer or no Timer1\n", cfg_path);
+        return 2;
+    }
+    us = cfg.cpu_hz / 1e6;
+    tick_period = cfg_timer_cycles(&cfg, timer0);
+    adc_period = (adc_hz > 0.0) ? cfg.cpu_hz / adc_hz : cfg_timer_cycles(&cfg, timer1);
+    clock_period = (double)cfg.clock_tick_us * us;
+    ranging = (double)cfg.cpu_hz / ULTRASONIC_RATE_HZ;
+
+    //Timer0 is a BIOS Timer Hwi, the Clock a Timer2 Hwi and the top priority Swi
+    threads[count++] = (thread_t){ timer0->name, "myTickFxn", LEVEL_HWI, 0, -1, "Timer0", tick_period, tick_period,
+                                   0.0, 1, dispatch_cycles, "none", 0.0, 0.0 };
+    threads[count++] = (thread_t){ "Clock", "(tick)", LEVEL_HWI, 0, -1, "Timer2", clock_period, clock_period, 0.0,
+                                   1, dispatch_cycles, "-o", 0.0, 0.0 };
+    threads[count++] = (thread_t){ "Clock", "(swi)", LEVEL_SWI, cfg.swi_priorities - 1, -1, "Clock Hwi", clock_period,
+                                   clock_period, 0.0, 1, dispatch_cycles, "-o", 0.0, 0.0 };
+    if ((add_thread(&threads[count++], &cfg, CFG_HWI, "myHwi", PROFILE_HWI, "Timer1 ADC burst") != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_HWI, "ECAP_ISR", PROFILE_ECAP, "eCAP1 event 4") != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_SWI, "mySwiFxn", PROFILE_SWI, "myHwi") != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_TASK, "myTskFxn", PROFILE_TSK0, "mySem: myTickFxn, itself") != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_TASK, "myTskFxn1", PROFILE_TSK1, "mySem1: ECAP_ISR, timeout") != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_TASK, "myTskFxn2", PROFILE_TSK2, "mySem2: Tsk0") != 0))
+    {
+        return 2;
+    }
+    find_thread(threads, count, "myHwi")->period = adc_period;
+    find_thread(threads, count, "mySwiFxn")->period = adc_period;
+    find_thread(threads, count, "ECAP_ISR")->period = 2.0 * ranging;
+    find_thread(threads, count, "ECAP_ISR")->deadline = ranging; //CAP2 and CAP4 are rewritten a period later
+    find_thread(threads, count, "myTskFxn1")->period = 2.0 * ranging;
+    tsk0 = find_thread(threads, count, "myTskFxn");
+    tsk0->sleep = (TSK0_SLEEP_TICKS - 1) * clock_period; //Task_sleep(n) blocks n - 1 to n ticks
+    if ((check_semaphore(&cfg, tsk0, "mySem") != 0) ||
+        (check_semaphore(&cfg, find_thread(threads, count, "myTskFxn1"), "mySem1") != 0) ||
+        (check_semaphore(&cfg, find_thread(threads, count, "myTskFxn2"), "mySem2") != 0))
+    {
+        return 2;
+    }
+
+    if (optind < argc)
+    {
+        if (apply_capture(argv[optind], threads, count, &idle_runs) != 0)
+        {
+            return 2;
+        }
+    }
+    apply_overrides(threads, count);
+    for (i = 0; i < override_count; i++)
+    {
+        if (!overrides[i].used)
+        {
+            fprintf(stderr, "-c %s: no such thread function\n", overrides[i].fxn);
+            return 2;
+        }
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (strcmp(threads[i].source, "none") == 0)
+        {
+            missing++;
+            fprintf(stderr, "no execution time for %s, it counts the dispatch only (-c %s=cycles)\n", threads[i].fxn,
+                    threads[i].fxn);
+        }
+    }
+
+    //Tsk0 posts mySem itself: the next loop starts once the last one is done, the tick's posts
+    //only ask for a reading it already does. Tsk2 follows every loop.
+    tsk0->deadline = TICK_POSTS * tick_period;
+    tsk0->period = tsk0->sleep + tsk0->cycles;
+    tsk0->period = (tsk0->period < tsk0->deadline) ? tsk0->period : tsk0->deadline;
+    tsk0->sleep += clock_period;
+    tsk0->segments = 2;
+    find_thread(threads, count, "myTskFxn2")->period = tsk0->period;
+    for (i = 0; i < count; i++)
+    {
+        if (threads[i].deadline == 0.0)
+        {
+            threads[i].deadline = threads[i].period;
+        }
+    }
+
+    failed = analyse(threads, count);
+    printf("%s: %.0f MHz, Timer1 %.3f Hz, Timer0 %.1f kHz, Clock %lu us, ranging %u Hz\n", cfg_path, cfg.cpu_hz / 1e6,
+           cfg.cpu_hz / adc_period, cfg.cpu_hz / tick_period / 1e3, cfg.clock_tick_us, (unsigned)ULTRASONIC_RATE_HZ);
+    print_threads(threads, count, us);
+    for (i = 0; i < count; i++)
+    {
+        total += threads[i].cycles / threads[i].period;
+        tasks += threads[i].level == LEVEL_TASK;
+    }
+    printf("CPU utilisation %.2f %% (Liu-Layland bound %.2f %% for %u threads), idle %s %.2f %%\n", 100.0 * total,
+           100.0 * count * (pow(2.0, 1.0 / count) - 1.0), count, (cfg.idle_count > 0) ? cfg.idle_fxns[0] : "loop",
+           (total < 1.0) ? 100.0 * (1.0 - total) : 0.0);
+    printf("note: %s posts its own semaphore, it runs back to back every %.1f ms instead of every %.1f ms of "
+           "myTickFxn\n", tsk0->name, tsk0->period / us / 1e3, tsk0->deadline / us / 1e3);
+    if ((idle_runs == 0) && (tasks > 0))
+    {
+        printf("STARVED: the capture has no idle run, a thread above idle never blocks\n");
+        failed++;
+    }
+    rate_monotonic(threads, count, us);
+    if (missing != 0)
+    {
+        printf("NOT AN ANALYSIS: %u threads have no execution time, see above\n", missing);
+        return 2;
+    }
+    printf("%s\n", (failed == 0) ? "every deadline met, no thread starved" : "DEADLINE MISSED OR THREAD STARVED");
+    return (failed != 0) ? 1 : 0;
+}
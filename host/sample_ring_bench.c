@@ -0,0 +1,290 @@
+// Thie file contains the host checks and throughput benchmark of the timestamped sample ring (sample_ring.h).
+//
+// build: cc -O2 -pthread -o sample_ring_bench sample_ring_bench.c ../sample_ring.c
+// usage: sample_ring_bench [records]     records for the timed runs, default 10000000
+//
+// Checks, each printed ok/FAIL (non-zero exit on any failure):
+//   order      records come back in order with every field intact
+//   cursors    two cursors read the same records independently
+//   overrun    a cursor that falls behind gets the newest SAMPLE_RING_DEPTH records and counts the rest lost
+//   wrap       the 32-bit sequence number wraps without losing or repeating a record
+//   threads    one producer and two consumer threads: no corrupt record, no record twice,
+//              read + lost adds up to what was appended
+// Then times append and read per record.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../sample_ring.h"
+
+static sample_ring_t ring;
+static int failures = 0;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//every field derived from n, so a torn record shows
+static void make_record(sample_record_t *r, uint32_t n)
+{
+    r->time = ((uint64_t)n << 20) | 0x5A5A5ULL;
+    r->value = (int32_t)(n * 2654435761U);
+    r->channel = (uint16_t)(n % SAMPLE_CHANNELS);
+    r->quality = (uint16_t)(n & 0x0F);
+}
+
+static int record_matches(const sample_record_t *r, uint32_t n)
+{
+    sample_record_t expected;
+
+    make_record(&expected, n);
+    return (r->time == expected.time) && (r->value == expected.value) &&
+           (r->channel == expected.channel) && (r->quality == expected.quality);
+}
+
+static void result(const char *name, int ok)
+{
+    failures |= !ok;
+    printf("%-10s %s\n", name, ok ? "ok" : "FAIL");
+}
+
+static void append(uint32_t n)
+{
+    sample_record_t r;
+
+    make_record(&r, n);
+    sample_ring_append(&ring, &r);
+}
+
+static void check_order(void)
+{
+    sample_cursor_t c;
+    sample_record_t r;
+    uint32_t n;
+    int ok = 1;
+
+    sample_ring_init(&ring);
+    sample_cursor_init(&ring, &c, 1);
+    for (n = 0; n < 10; n++)
+    {
+        append(n);
+    }
+    for (n = 0; n < 10; n++)
+    {
+        ok &= sample_ring_read(&ring, &c, &r) && record_matches(&r, n);
+    }
+    ok &= !sample_ring_read(&ring, &c, &r) && (c.lost == 0);
+    result("order", ok);
+}
+
+static void check_cursors(void)
+{
+    sample_cursor_t a;
+    sample_cursor_t b;
+    sample_record_t r;
+    uint32_t n;
+    int ok = 1;
+
+    sample_ring_init(&ring);
+    sample_cursor_init(&ring, &a, 0);
+    for (n = 0; n < 5; n++)
+    {
+        append(n);
+    }
+    sample_cursor_init(&ring, &b, 0); //starts after the first five
+    for (n = 5; n < 8; n++)
+    {
+        append(n);
+    }
+    for (n = 0; n < 8; n++)
+    {
+        ok &= sample_ring_read(&ring, &a, &r) && record_matches(&r, n);
+    }
+    for (n = 5; n < 8; n++)
+    {
+        ok &= sample_ring_read(&ring, &b, &r) && record_matches(&r, n);
+    }
+    ok &= !sample_ring_read(&ring, &a, &r) && !sample_ring_read(&ring, &b, &r);
+    result("cursors", ok);
+}
+
+static void check_overrun(void)
+{
+    sample_cursor_t c;
+    sample_record_t r;
+    uint32_t n;
+    int ok = 1;
+
+    sample_ring_init(&ring);
+    sample_cursor_init(&ring, &c, 0);
+    for (n = 0; n < 3 * SAMPLE_RING_DEPTH + 5; n++)
+    {
+        append(n);
+    }
+    for (n = 2 * SAMPLE_RING_DEPTH + 5; n < 3 * SAMPLE_RING_DEPTH + 5; n++)
+    {
+        ok &= sample_ring_read(&ring, &c, &r) && record_matches(&r, n);
+    }
+    ok &= !sample_ring_read(&ring, &c, &r) && (c.lost == 2 * SAMPLE_RING_DEPTH + 5);
+    result("overrun", ok);
+}
+
+static void check_wrap(void)
+{
+    sample_cursor_t c;
+    sample_record_t r;
+    uint32_t n;
+    int ok = 1;
+
+    sample_ring_init(&ring);
+    ring.write_count = 0xFFFFFFF0UL;
+    sample_cursor_init(&ring, &c, 0);
+    for (n = 0; n < 40; n++)
+    {
+        append(n);
+    }
+    for (n = 0; n < 40; n++)
+    {
+        ok &= sample_ring_read(&ring, &c, &r) && record_matches(&r, n);
+    }
+    ok &= !sample_ring_read(&ring, &c, &r) && (c.lost == 0) && (ring.write_count == 0x18);
+    result("wrap", ok);
+}
+
+//concurrent run: every record is made from its sequence number
+#define THREAD_RECORDS 2000000UL
+
+static volatile int producing;
+
+typedef struct
+{
+    unsigned long read;
+    unsigned long lost;
+    unsigned long bad;
+} consumer_t;
+
+static void *producer(void *arg)
+{
+    uint32_t n;
+
+    (void)arg;
+    for (n = 0; n < THREAD_RECORDS; n++)
+    {
+        append(n);
+        if ((n & 31) == 31)
+        {
+            sched_yield(); //lets the consumers in on a single CPU host
+        }
+    }
+    producing = 0;
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    consumer_t *res = arg;
+    sample_cursor_t c;
+    sample_record_t r;
+    uint32_t expected_min = 0;
+
+    sample_cursor_init(&ring, &c, 1);
+    while (1)
+    {
+        int done = !producing;
+        while (sample_ring_read(&ring, &c, &r))
+        {
+            //the sequence number this record must have is c.next - 1
+            uint32_t n = c.next - 1;
+            if (!record_matches(&r, n) || (n < expected_min))
+            {
+                res->bad++;
+            }
+            expected_min = n + 1;
+            res->read++;
+        }
+        if (done)
+        {
+            break;
+        }
+    }
+    res->lost = c.lost;
+    return NULL;
+}
+
+static void check_threads(void)
+{
+    pthread_t p;
+    pthread_t c[2];
+    consumer_t res[2] = { { 0, 0, 0 }, { 0, 0, 0 } };
+    int ok = 1;
+    int i;
+
+    sample_ring_init(&ring);
+    producing = 1;
+    for (i = 0; i < 2; i++)
+    {
+        pthread_create(&c[i], NULL, consumer, &res[i]);
+    }
+    pthread_create(&p, NULL, producer, NULL);
+    pthread_join(p, NULL);
+    for (i = 0; i < 2; i++)
+    {
+        pthread_join(c[i], NULL);
+        ok &= (res[i].bad == 0) && (res[i].read + res[i].lost == THREAD_RECORDS);
+        printf("           consumer %d: %lu read, %lu lost, %lu bad\n", i, res[i].read, res[i].lost, res[i].bad);
+    }
+    result("threads", ok);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long records = (argc == 2) ? strtoul(argv[1], NULL, 0) : 10000000UL;
+    sample_cursor_t c;
+    sample_record_t r;
+    volatile int64_t sink = 0;
+    unsigned long n;
+    double t0;
+
+    if ((argc > 2) || (records == 0))
+    {
+        fprintf(stderr, "usage: %s [records]\n", argv[0]);
+        return 1;
+    }
+    printf("depth %d, record %u bytes\n", SAMPLE_RING_DEPTH, (unsigned)sizeof(sample_slot_t));
+    check_order();
+    check_cursors();
+    check_overrun();
+    check_wrap();
+    check_threads();
+
+    //append alone, then append + read in batches of half the ring as a consumer would
+    sample_ring_init(&ring);
+    t0 = now_ns();
+    for (n = 0; n < records; n++)
+    {
+        append((uint32_t)n);
+    }
+    printf("append     %.2f ns/record\n", (now_ns() - t0) / records);
+
+    sample_ring_init(&ring);
+    sample_cursor_init(&ring, &c, 0);
+    t0 = now_ns();
+    for (n = 0; n < records; n++)
+    {
+        append((uint32_t)n);
+        if ((n & (SAMPLE_RING_DEPTH / 2 - 1)) == SAMPLE_RING_DEPTH / 2 - 1)
+        {
+            while (sample_ring_read(&ring, &c, &r))
+            {
+                sink += r.value;
+            }
+        }
+    }
+    printf("append+read %.2f ns/record (%lu lost)\n", (now_ns() - t0) / records, (unsigned long)c.lost);
+    return failures;
+}
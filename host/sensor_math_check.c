@@ -0,0 +1,305 @@
+// Thie file contains a host check of the Q16.16 and float paths of sensor_math.c against the exact
+// conversions, over the whole input range of each sensor.
+//
+// build: make sensor_math_check      (sensor_math.c is built four times, see the Makefile)
+// usage: sensor_math_check
+//
+// Inputs: every ADC code (0..4095) for volts and water content, every eCAP width up to the 38 ms
+// no-echo pulse for distance, and every raw DHT20 value (0..2^20-1) for humidity and temperature.
+// Both paths are built with MOISTURE_LUT=0 for water_content, the evaluated formula, and again with
+// MOISTURE_LUT=1 for water_content_lut, the moisture_lut.c table, so the lookup and the evaluation
+// it replaced are compared on error and time. The reference is the datasheet formula in double.
+//
+// Reported per conversion and path: max absolute error, max relative error where |exact| >= 1,
+// and host ns per conversion. Q16.16 has a fixed step, so its limit is absolute; float has a
+// relative step, so its limit is relative to max(|exact|, 1). Exits 1 if a limit is exceeded.
+// Water content codes below the Q16.16 range saturate (the fixed path, and both table builds) and
+// are counted, not checked.
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include "../sensor_math.h"
+
+//the SENSOR_MATH_FIXED=1 build of sensor_math.c, renamed by the Makefile
+q16_t q16_adc_to_volts(uint16_t code);
+q16_t q16_water_content(uint16_t code);
+q16_t q16_echo_to_cm(uint32_t counts);
+q16_t q16_dht20_humidity(const unsigned char *data);
+q16_t q16_dht20_temperature(const unsigned char *data);
+//the MOISTURE_LUT=1 builds, float and Q16.16
+float lut_water_content(uint16_t code);
+q16_t q16lut_water_content(uint16_t code);
+
+#define Q16_LSB (1.0 / 65536.0)
+#define SATURATED 32767.0 //water content the table and the Q16.16 path clamp to (32767 to 32768)
+#define ECHO_MAX_COUNTS 7600000UL //38 ms no-echo pulse at 200 MHz
+#define DHT20_MAX_RAW 0xFFFFFUL
+
+typedef struct
+{
+    const char *name;
+    const char *unit;
+    uint32_t first;
+    uint32_t last;
+    double (*exact)(uint32_t in);
+    float (*f32)(uint32_t in);
+    q16_t (*q16)(uint32_t in);
+    double q16_limit;  //absolute, in the unit
+    double f32_limit;  //relative to max(|exact|, 1)
+} conversion_t;
+
+typedef struct
+{
+    double max_abs;
+    double max_rel;
+    uint32_t worst;
+    unsigned long saturated;
+    double ns;
+} result_t;
+
+static volatile double sink; //keeps the timed loops from being optimised out
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+//DHT20 bytes data[1..5] with the raw value in the humidity (20 MSBs) or temperature (20 LSBs) field
+static void dht20_bytes(unsigned char *data, uint32_t raw, int temperature)
+{
+    data[0] = 0x1C;
+    if (temperature)
+    {
+        data[1] = 0x80;
+        data[2] = 0x00;
+        data[3] = (unsigned char)(0x80 | (raw >> 16));
+        data[4] = (unsigned char)(raw >> 8);
+        data[5] = (unsigned char)raw;
+    }
+    else
+    {
+        data[1] = (unsigned char)(raw >> 12);
+        data[2] = (unsigned char)(raw >> 4);
+        data[3] = (unsigned char)((raw << 4) | 0x08);
+        data[4] = 0x00;
+        data[5] = 0x00;
+    }
+}
+
+static double exact_volts(uint32_t code)
+{
+    return VREFHI * code / ADC_FULL_SCALE;
+}
+
+static double exact_water(uint32_t code)
+{
+    return (MOISTURE_SLOPE / exact_volts(code) - MOISTURE_OFFSET) * 100.0;
+}
+
+static double exact_echo(uint32_t counts)
+{
+    return counts / ECHO_COUNTS_PER_CM;
+}
+
+static double exact_humidity(uint32_t raw)
+{
+    return raw / DHT20_FULL_SCALE * 100.0;
+}
+
+static double exact_temperature(uint32_t raw)
+{
+    return raw / DHT20_FULL_SCALE * 200.0 - 50.0;
+}
+
+static float f32_volts(uint32_t code)
+{
+    return sensor_adc_to_volts((uint16_t)code);
+}
+
+static float f32_water(uint32_t code)
+{
+    return sensor_water_content((uint16_t)code);
+}
+
+static float f32_water_lut(uint32_t code)
+{
+    return lut_water_content((uint16_t)code);
+}
+
+static float f32_echo(uint32_t counts)
+{
+    return sensor_echo_to_cm(counts);
+}
+
+static float f32_humidity(uint32_t raw)
+{
+    unsigned char data[6];
+    dht20_bytes(data, raw, 0);
+    return sensor_dht20_humidity(data);
+}
+
+static float f32_temperature(uint32_t raw)
+{
+    unsigned char data[6];
+    dht20_bytes(data, raw, 1);
+    return sensor_dht20_temperature(data);
+}
+
+static q16_t fixed_volts(uint32_t code)
+{
+    return q16_adc_to_volts((uint16_t)code);
+}
+
+static q16_t fixed_water(uint32_t code)
+{
+    return q16_water_content((uint16_t)code);
+}
+
+static q16_t fixed_water_lut(uint32_t code)
+{
+    return q16lut_water_content((uint16_t)code);
+}
+
+static q16_t fixed_echo(uint32_t counts)
+{
+    return q16_echo_to_cm(counts);
+}
+
+static q16_t fixed_humidity(uint32_t raw)
+{
+    unsigned char data[6];
+    dht20_bytes(data, raw, 0);
+    return q16_dht20_humidity(data);
+}
+
+static q16_t fixed_temperature(uint32_t raw)
+{
+    unsigned char data[6];
+    dht20_bytes(data, raw, 1);
+    return q16_dht20_temperature(data);
+}
+
+//Q16 limits: the truncation of one shift (1 LSB) plus the rounding of the reciprocal constant
+//times the largest input; float limits: a few float steps after the cancellation in water content.
+//The table entries are the exact values printed with six decimals by gen_moisture_lut, then rounded
+//to the type: 5e-7 plus half a step.
+static const conversion_t conversions[] = {
+    { "adc_to_volts", "V", 0, 4095, exact_volts, f32_volts, fixed_volts, 2 * Q16_LSB, 2e-7 },
+    { "water_content", "%", 1, 4095, exact_water, f32_water, fixed_water, 2 * Q16_LSB, 2e-6 },
+    { "water_content_lut", "%", 0, 4095, exact_water, f32_water_lut, fixed_water_lut, Q16_LSB / 2 + 5e-7, 1.2e-7 },
+    { "echo_to_cm", "cm", 0, ECHO_MAX_COUNTS, exact_echo, f32_echo, fixed_echo, 1e-3, 2e-7 },
+    { "dht20_humidity", "%RH", 0, DHT20_MAX_RAW, exact_humidity, f32_humidity, fixed_humidity, Q16_LSB, 2e-7 },
+    { "dht20_temperature", "C", 0, DHT20_MAX_RAW, exact_temperature, f32_temperature, fixed_temperature, Q16_LSB,
+      5e-7 },
+};
+
+static void account(result_t *r, double exact, double got, uint32_t in)
+{
+    double err = fabs(got - exact);
+
+    if (err > r->max_abs)
+    {
+        r->max_abs = err;
+        r->worst = in;
+    }
+    if ((fabs(exact) >= 1.0) && (err / fabs(exact) > r->max_rel))
+    {
+        r->max_rel = err / fabs(exact);
+    }
+}
+
+//error of both paths over the conversion's input range, then the time of each
+static int check(const conversion_t *c)
+{
+    result_t fixed = { 0 };
+    result_t flt = { 0 };
+    double f32_worst = 0.0;
+    double t0;
+    double acc;
+    uint32_t in;
+    int failed = 0;
+
+    for (in = c->first; in <= c->last; in++)
+    {
+        double exact = c->exact(in);
+        float f = c->f32(in);
+        q16_t q = c->q16(in);
+
+        if ((exact >= SATURATED) && (f >= SATURATED) && (f <= SATURATED + 1.0))
+        {
+            flt.saturated++;
+        }
+        else
+        {
+            account(&flt, exact, f, in);
+            if (fabs(f - exact) / fmax(fabs(exact), 1.0) > f32_worst)
+            {
+                f32_worst = fabs(f - exact) / fmax(fabs(exact), 1.0);
+            }
+        }
+        if ((q == Q16_MAX) && (exact >= SATURATED))
+        {
+            fixed.saturated++;
+        }
+        else
+        {
+            account(&fixed, exact, q * Q16_LSB, in);
+        }
+    }
+
+    acc = 0.0;
+    t0 = now_ns();
+    for (in = c->first; in <= c->last; in++)
+    {
+        acc += c->f32(in);
+    }
+    flt.ns = (now_ns() - t0) / (c->last - c->first + 1);
+    sink = acc;
+    acc = 0.0;
+    t0 = now_ns();
+    for (in = c->first; in <= c->last; in++)
+    {
+        acc += c->q16(in);
+    }
+    fixed.ns = (now_ns() - t0) / (c->last - c->first + 1);
+    sink = acc;
+
+    printf("%s,float,%lu,%.3g,%.3g,%lu,%lu,%.2f,%s\n", c->name, (unsigned long)(c->last - c->first + 1), flt.max_abs,
+           flt.max_rel, (unsigned long)flt.worst, flt.saturated, flt.ns, c->unit);
+    printf("%s,q16,%lu,%.3g,%.3g,%lu,%lu,%.2f,%s\n", c->name, (unsigned long)(c->last - c->first + 1), fixed.max_abs,
+           fixed.max_rel, (unsigned long)fixed.worst, fixed.saturated, fixed.ns, c->unit);
+    if (f32_worst > c->f32_limit)
+    {
+        fprintf(stderr, "%s: float error %.3g of max(|exact|, 1) above the limit %.3g\n", c->name, f32_worst,
+                c->f32_limit);
+        failed = 1;
+    }
+    if (fixed.max_abs > c->q16_limit)
+    {
+        fprintf(stderr, "%s: Q16.16 error %.3g %s at input %lu above the limit %.3g\n", c->name, fixed.max_abs, c->unit,
+                (unsigned long)fixed.worst, c->q16_limit);
+        failed = 1;
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned i;
+    int failed = 0;
+
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return 2;
+    }
+    printf("conversion,path,inputs,max_abs_err,max_rel_err,worst_input,saturated,ns_per_conversion,unit\n");
+    for (i = 0; i < sizeof(conversions) / sizeof(conversions[0]); i++)
+    {
+        failed |= check(&conversions[i]);
+    }
+    return failed;
+}
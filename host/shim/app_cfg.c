@@ -0,0 +1,270 @@
+// Thie file contains the SYS/BIOS objects of app.cfg for the host build (shim.h)
+// Keep it in step with app.cfg: names, priorities, interrupt numbers, timers, idle function and hooks.
+// shim_app_check() compares it with app.cfg (host/cfg_parse.c) at startup, apart from the hooks.
+
+#include <string.h>
+#include "shim.h"
+#include "../cfg_parse.h"
+#include "adc_config.h"
+
+//the host tools run, time and analyse the firmware's default build, and there is no DMA model
+#if ADC_USE_DMA
+#error "the shim has no DMA model: the host build needs ADC_USE_DMA=0, the myHwi path"
+#endif
+
+//firmware functions app.cfg refers to, cast the way the generated configuration does
+extern Void myTskFxn(Void);
+extern Void myTskFxn1(Void);
+extern Void myTskFxn2(Void);
+extern Void mySwiFxn(Void);
+extern Void myTickFxn(UArg arg);
+extern Void myIdleFxn(Void);
+extern Void myHwi(Void);
+extern Void ECAP_ISR(UArg arg);
+extern Void I2CB_ISR(UArg arg);
+extern Void I2CB_FIFO_ISR(UArg arg);
+extern Void SCIB_TX_ISR(UArg arg);
+extern Void ADC_DMA_ISR(UArg arg);
+extern Void MOISTURE_CLA_ISR(UArg arg);
+extern Void trace_task_switch(Task_Handle prev, Task_Handle next);
+extern Void trace_swi_begin(Swi_Handle swi);
+extern Void trace_swi_end(Swi_Handle swi);
+extern Void trace_hwi_begin(Hwi_Handle hwi);
+extern Void trace_hwi_end(Hwi_Handle hwi);
+
+static struct Task_Object task0 = { "Tsk0", (Task_FuncPtr)myTskFxn, 0, 0, 9 };
+static struct Task_Object task1 = { "Tsk1", (Task_FuncPtr)myTskFxn1, 0, 0, 10 };
+static struct Task_Object task2 = { "Tsk2", (Task_FuncPtr)myTskFxn2, 0, 0, 11 };
+const Task_Handle Tsk0 = &task0;
+const Task_Handle Tsk1 = &task1;
+const Task_Handle Tsk2 = &task2;
+
+static struct Swi_Object swi0 = { "Swi0", (Swi_FuncPtr)mySwiFxn, 0, 0, 6 };
+const Swi_Handle Swi0 = &swi0;
+
+static struct Semaphore_Object semaphore0 = { "mySem", Semaphore_Mode_BINARY, 0 };
+static struct Semaphore_Object semaphore1 = { "mySem1", Semaphore_Mode_BINARY, 0 };
+static struct Semaphore_Object semaphore2 = { "mySem2", Semaphore_Mode_BINARY, 0 };
+static struct Semaphore_Object semaphore3 = { "i2cSem", Semaphore_Mode_BINARY, 0 };
+const Semaphore_Handle mySem = &semaphore0;
+const Semaphore_Handle mySem1 = &semaphore1;
+const Semaphore_Handle mySem2 = &semaphore2;
+const Semaphore_Handle i2cSem = &semaphore3;
+static const Semaphore_Handle semaphores[] = { &semaphore0, &semaphore1, &semaphore2, &semaphore3 };
+
+static struct Hwi_Object hwi0_obj = { "hwi0", 32, (Hwi_FuncPtr)myHwi, 0 };
+static struct Hwi_Object hwi1_obj = { "hwi1", 56, ECAP_ISR, 0 };
+static struct Hwi_Object hwi2_obj = { "hwi2", 90, I2CB_ISR, 0 };
+static struct Hwi_Object hwi3_obj = { "hwi3", 91, I2CB_FIFO_ISR, 0 };
+static struct Hwi_Object hwi4_obj = { "hwi4", 99, SCIB_TX_ISR, 0 };
+static struct Hwi_Object hwi5_obj = { "hwi5", 80, ADC_DMA_ISR, 0 };
+static struct Hwi_Object hwi6_obj = { "hwi6", 112, MOISTURE_CLA_ISR, 0 };
+const Hwi_Handle hwi0 = &hwi0_obj;
+const Hwi_Handle hwi1 = &hwi1_obj;
+const Hwi_Handle hwi2 = &hwi2_obj;
+const Hwi_Handle hwi3 = &hwi3_obj;
+const Hwi_Handle hwi4 = &hwi4_obj;
+const Hwi_Handle hwi5 = &hwi5_obj;
+const Hwi_Handle hwi6 = &hwi6_obj;
+
+static const Task_Handle tasks[] = { &task0, &task1, &task2 };
+static const Swi_Handle swis[] = { &swi0 };
+static const Hwi_Handle hwis[] = { &hwi0_obj, &hwi1_obj, &hwi2_obj, &hwi3_obj, &hwi4_obj, &hwi5_obj, &hwi6_obj };
+static const shim_timer_cfg_t timers[] = {
+    { "myTimer0", 0, 2000, myTickFxn, 0 },
+    { "myTimer1", 1, 100000000UL, NULL, 0 } //ADC SOC trigger only
+};
+static Void (*const idle_fxns[])(Void) = { myIdleFxn };
+static const Task_HookSet task_hooks[] = { { trace_task_switch } };
+static const Swi_HookSet swi_hooks[] = { { trace_swi_begin, trace_swi_end } };
+static const Hwi_HookSet hwi_hooks[] = { { trace_hwi_begin, trace_hwi_end } };
+
+#define COUNT(a) (uint16_t)(sizeof(a) / sizeof((a)[0]))
+
+const shim_app_t shim_app = {
+    tasks, COUNT(tasks),
+    swis, COUNT(swis),
+    hwis, COUNT(hwis),
+    timers, COUNT(timers),
+    idle_fxns, COUNT(idle_fxns),
+    task_hooks, COUNT(task_hooks),
+    swi_hooks, COUNT(swi_hooks),
+    hwi_hooks, COUNT(hwi_hooks)
+};
+
+/* ======== check against app.cfg ======== */
+#define FXN(f) { (void (*)(void))f, #f }
+
+static const struct
+{
+    void (*fxn)(void);
+    const char *name;
+} fxn_names[] = {
+    FXN(myTskFxn), FXN(myTskFxn1), FXN(myTskFxn2), FXN(mySwiFxn), FXN(myTickFxn), FXN(myIdleFxn), FXN(myHwi),
+    FXN(ECAP_ISR), FXN(I2CB_ISR), FXN(I2CB_FIFO_ISR), FXN(SCIB_TX_ISR), FXN(ADC_DMA_ISR), FXN(MOISTURE_CLA_ISR)
+};
+
+static unsigned differences;
+
+static void differ(const char *name, const char *what, long shim, long cfg)
+{
+    fprintf(stderr, "app_cfg.c differs from %s: %s %s is %ld, app.cfg has %ld\n", SHIM_APP_CFG, name, what, shim, cfg);
+    differences++;
+}
+
+//name of the firmware function, "" for NULL
+static const char *fxn_name(void (*fxn)(void))
+{
+    uint16_t i;
+
+    for (i = 0; i < COUNT(fxn_names); i++)
+    {
+        if (fxn_names[i].fxn == fxn)
+        {
+            return fxn_names[i].name;
+        }
+    }
+    return (fxn == NULL) ? "" : "?";
+}
+
+static const cfg_object_t *check_object(const cfg_t *cfg, cfg_kind_t kind, const char *name, void (*fxn)(void))
+{
+    const cfg_object_t *object = cfg_find(cfg, kind, name);
+
+    if (object == NULL)
+    {
+        fprintf(stderr, "app_cfg.c differs from %s: %s is not in app.cfg\n", SHIM_APP_CFG, name);
+        differences++;
+    }
+    else if (strcmp(object->fxn, fxn_name(fxn)) != 0)
+    {
+        fprintf(stderr, "app_cfg.c differs from %s: %s runs %s, app.cfg has %s\n", SHIM_APP_CFG, name, fxn_name(fxn),
+                object->fxn);
+        differences++;
+    }
+    return object;
+}
+
+static void check_count(const cfg_t *cfg, cfg_kind_t kind, const char *what, uint16_t count)
+{
+    uint16_t n = 0;
+    uint16_t i;
+
+    for (i = 0; i < cfg->count; i++)
+    {
+        n += (cfg->objects[i].kind == kind);
+    }
+    if (n != count)
+    {
+        differ("the number of", what, count, n);
+    }
+}
+
+int shim_app_check(void)
+{
+    static cfg_t cfg;
+    const cfg_object_t *object;
+    uint16_t i;
+    uint16_t n;
+
+    if (cfg_load(SHIM_APP_CFG, &cfg) != 0)
+    {
+        return -1;
+    }
+    differences = 0;
+    if (cfg.cpu_hz != SHIM_CPU_HZ)
+    {
+        differ("BIOS", "cpuFreq", (long)SHIM_CPU_HZ, (long)cfg.cpu_hz);
+    }
+    if (cfg.clock_tick_us * (SHIM_CPU_HZ / 1000000UL) != SHIM_CLOCK_CYCLES)
+    {
+        differ("Clock", "tickPeriod", (long)(SHIM_CLOCK_CYCLES / (SHIM_CPU_HZ / 1000000UL)), (long)cfg.clock_tick_us);
+    }
+    if (cfg.swi_priorities != SHIM_SWI_PRIORITIES)
+    {
+        differ("Swi", "numPriorities", SHIM_SWI_PRIORITIES, cfg.swi_priorities);
+    }
+    check_count(&cfg, CFG_TASK, "tasks", shim_app.task_count);
+    for (i = 0; i < shim_app.task_count; i++)
+    {
+        const struct Task_Object *task = shim_app.tasks[i];
+
+        object = check_object(&cfg, CFG_TASK, task->name, (void (*)(void))task->fxn);
+        if ((object != NULL) && (cfg_priority(&cfg, object) != task->priority))
+        {
+            differ(task->name, "priority", task->priority, cfg_priority(&cfg, object));
+        }
+    }
+    check_count(&cfg, CFG_SWI, "swis", shim_app.swi_count);
+    for (i = 0; i < shim_app.swi_count; i++)
+    {
+        const struct Swi_Object *swi = shim_app.swis[i];
+
+        object = check_object(&cfg, CFG_SWI, swi->name, (void (*)(void))swi->fxn);
+        if ((object != NULL) && (cfg_priority(&cfg, object) != (long)swi->priority))
+        {
+            differ(swi->name, "priority", (long)swi->priority, cfg_priority(&cfg, object));
+        }
+    }
+    check_count(&cfg, CFG_SEMAPHORE, "semaphores", COUNT(semaphores));
+    for (i = 0; i < COUNT(semaphores); i++)
+    {
+        const struct Semaphore_Object *sem = semaphores[i];
+
+        object = check_object(&cfg, CFG_SEMAPHORE, sem->name, NULL);
+        if ((object != NULL) && (object->binary != (sem->mode == Semaphore_Mode_BINARY)))
+        {
+            differ(sem->name, "binary", sem->mode == Semaphore_Mode_BINARY, object->binary);
+        }
+        if ((object != NULL) && (((object->count == CFG_UNSET) ? 0 : object->count) != sem->count))
+        {
+            differ(sem->name, "count", sem->count, object->count);
+        }
+    }
+    check_count(&cfg, CFG_HWI, "hwis", shim_app.hwi_count);
+    for (i = 0; i < shim_app.hwi_count; i++)
+    {
+        const struct Hwi_Object *hwi = shim_app.hwis[i];
+
+        object = check_object(&cfg, CFG_HWI, hwi->name, (void (*)(void))hwi->fxn);
+        if ((object != NULL) && (object->number != (long)hwi->intNum))
+        {
+            differ(hwi->name, "intNum", (long)hwi->intNum, object->number);
+        }
+    }
+    check_count(&cfg, CFG_TIMER, "timers", shim_app.timer_count);
+    for (i = 0; i < shim_app.timer_count; i++)
+    {
+        const shim_timer_cfg_t *timer = &shim_app.timers[i];
+
+        object = check_object(&cfg, CFG_TIMER, timer->name, (void (*)(void))timer->fxn);
+        if ((object != NULL) && (object->number != CFG_UNSET) && (object->number != timer->id))
+        {
+            differ(timer->name, "id", timer->id, object->number); //CFG_UNSET takes any, the shim gives it id
+        }
+        if ((object != NULL) && (cfg_timer_cycles(&cfg, object) != (double)timer->period))
+        {
+            differ(timer->name, "period in cycles", (long)timer->period, (long)cfg_timer_cycles(&cfg, object));
+        }
+    }
+    for (i = 0, n = 0; i < cfg.idle_count; i++)
+    {
+        if (cfg.idle_fxns[i][0] == '\0')
+        {
+            continue; //null slot
+        }
+        if ((n >= shim_app.idle_count) || (strcmp(cfg.idle_fxns[i], fxn_name((void (*)(void))shim_app.idle_fxns[n])) != 0))
+        {
+            fprintf(stderr, "app_cfg.c differs from %s: idle function %u is %s, app.cfg has %s\n", SHIM_APP_CFG, n,
+                    (n < shim_app.idle_count) ? fxn_name((void (*)(void))shim_app.idle_fxns[n]) : "missing",
+                    cfg.idle_fxns[i]);
+            differences++;
+        }
+        n++;
+    }
+    if (n < shim_app.idle_count)
+    {
+        differ("the number of", "idle functions", shim_app.idle_count, n);
+    }
+    return (int)differences;
+}
@@ -0,0 +1,992 @@
+// Thie file contains the host SYS/BIOS kernel of shim.h: virtual CPU, scheduler and kernel calls
+// Only the thread holding the virtual CPU touches the state below, the hand-over is under shim_lock.
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include <xdc/runtime/System.h>
+#include <xdc/runtime/Timestamp.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Clock.h>
+#include "shim.h"
+
+#define SHIM_EVENTS 64
+#define SHIM_POLLS 8
+#define SHIM_TASKS 16
+#define SHIM_SWIS 16
+#define SHIM_CONTEXTS (SHIM_SWI_PRIORITIES + 2) //task, every Swi level and one Hwi
+
+enum
+{
+    SHIM_READY,
+    SHIM_BLOCKED,
+    SHIM_TERMINATED
+};
+
+typedef struct
+{
+    uint64_t at;
+    uint64_t period;
+    uint64_t seq;                //events due together run in the order they were set
+    shim_event_fxn fxn;
+    void *arg;
+} shim_event_t;
+
+typedef struct
+{
+    shim_event_fxn fxn;
+    void *arg;
+} shim_model_t;
+
+shim_config_t shim_config = { 10ULL * SHIM_CPU_HZ, 0, 0 };
+const UInt32 Clock_tickPeriod = 1000;
+
+static Void shim_clock_hwi(UArg arg);
+static Void shim_clock_swi(UArg arg0, UArg arg1);
+
+static struct Task_Object idle_task = { "ti.sysbios.knl.Task.IdleTask", NULL, 0, 0, 0 };
+static struct Swi_Object clock_swi = { "ti.sysbios.knl.Clock", shim_clock_swi, 0, 0, SHIM_SWI_PRIORITIES - 1 };
+static struct Hwi_Object timer_hwis[SHIM_TIMERS];
+static const UInt timer_int[SHIM_TIMERS] = { 38, 13, 14 }; //TINT0 (PIE 1.7), INT13, INT14
+static uint64_t timer_period[SHIM_TIMERS]; //0 = timer not created
+
+static pthread_mutex_t shim_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static struct
+{
+    int setup;
+    int started;
+    uint64_t now;                //virtual SYSCLK cycles
+    uint32_t ticks;              //Clock ticks
+    UInt intm;                   //1 = interrupts disabled
+    int in_hwi;
+    int in_kernel;               //scheduler, hook or peripheral model running: no preemption
+    int swi_level;               //priority of the running Swi, -1 at task level
+    UInt swi_disabled;
+    Task_Handle current;
+    uint64_t seq;
+    Task_Handle tasks[SHIM_TASKS + 1]; //the idle task last
+    uint16_t task_count;
+    Swi_Handle swis[SHIM_SWIS + 1];
+    uint16_t swi_count;
+    Hwi_Handle vector[SHIM_INTERRUPTS];
+    UInt order[SHIM_INTERRUPTS]; //installed interrupt numbers, PIE order
+    uint16_t vector_count;
+    uint8_t pending[SHIM_INTERRUPTS];
+    uint8_t enabled[SHIM_INTERRUPTS];
+    uint16_t pending_count;
+    shim_event_t events[SHIM_EVENTS]; //sorted, next due first
+    uint16_t event_count;
+    shim_model_t polls[SHIM_POLLS];
+    uint16_t poll_count;
+    shim_model_t timer_models[SHIM_TIMERS];
+    shim_stat_t *account[SHIM_CONTEXTS]; //innermost running context last
+    int account_depth;
+    uint64_t account_host;
+    uint64_t account_cycles;
+    uint32_t digest;
+} shim;
+
+static void shim_fatal(const char *what)
+{
+    fprintf(stderr, "shim: %s (%s, cycle %llu)\n", what, (shim.current != NULL) ? shim.current->name : "main",
+            (unsigned long long)shim.now);
+    exit(2);
+}
+
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* ======== accounting and digest ======== */
+//FNV-1a over the virtual time and name of every context entered
+static void digest_add(const char *name)
+{
+    uint64_t now = shim.now;
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        shim.digest = (shim.digest ^ (uint8_t)(now >> (8 * i))) * 16777619U;
+    }
+    while (*name != '\0')
+    {
+        shim.digest = (shim.digest ^ (uint8_t)*name++) * 16777619U;
+    }
+}
+
+//time since the last mark goes to the innermost context
+static void account_mark(void)
+{
+    uint64_t host = host_ns();
+
+    if (shim.account_depth > 0)
+    {
+        shim_stat_t *stat = shim.account[shim.account_depth - 1];
+        stat->host_ns += host - shim.account_host;
+        stat->cycles += shim.now - shim.account_cycles;
+    }
+    shim.account_host = host;
+    shim.account_cycles = shim.now;
+}
+
+static void account_enter(shim_stat_t *stat, const char *name)
+{
+    account_mark();
+    if (shim.account_depth == SHIM_CONTEXTS)
+    {
+        shim_fatal("contexts nested too deep");
+    }
+    shim.account[shim.account_depth++] = stat;
+    stat->runs++;
+    digest_add(name);
+}
+
+static void account_leave(void)
+{
+    account_mark();
+    shim.account_depth--;
+}
+
+/* ======== set-up ======== */
+//PIE order: CPU interrupt (group) first, then the vector within the group
+static unsigned shim_int_rank(UInt intNum)
+{
+    if (intNum < 32)
+    {
+        return intNum * 16U;
+    }
+    if (intNum < 128)
+    {
+        return ((intNum - 32) / 8 + 1) * 16U + (intNum - 32) % 8;
+    }
+    return ((intNum - 128) / 8 + 1) * 16U + (intNum - 128) % 8 + 8;
+}
+
+static void shim_install(Hwi_Handle hwi)
+{
+    uint16_t i = shim.vector_count;
+
+    if ((hwi->intNum >= SHIM_INTERRUPTS) || (shim.vector[hwi->intNum] != NULL))
+    {
+        shim_fatal("bad or shared interrupt number");
+    }
+    shim.vector[hwi->intNum] = hwi;
+    while ((i > 0) && (shim_int_rank(shim.order[i - 1]) > shim_int_rank(hwi->intNum)))
+    {
+        shim.order[i] = shim.order[i - 1];
+        i--;
+    }
+    shim.order[i] = hwi->intNum;
+    shim.vector_count++;
+    shim.enabled[hwi->intNum] = 1; //Hwi.create enables the interrupt by default
+}
+
+//builds the tables from app_cfg.c, on the first call into the shim
+static void shim_init(void)
+{
+    uint16_t i;
+
+    if (shim.setup)
+    {
+        return;
+    }
+    shim.setup = 1;
+    shim.intm = 1; //BIOS_start enables interrupts
+    shim.swi_level = -1;
+    shim.digest = 2166136261U;
+    if ((shim_app.task_count > SHIM_TASKS) || (shim_app.swi_count > SHIM_SWIS))
+    {
+        shim_fatal("too many tasks or Swis");
+    }
+    for (i = 0; i < shim_app.task_count; i++)
+    {
+        shim.tasks[shim.task_count++] = shim_app.tasks[i];
+    }
+    shim.tasks[shim.task_count++] = &idle_task;
+    shim.current = &idle_task;
+    for (i = 0; i < shim_app.swi_count; i++)
+    {
+        shim.swis[shim.swi_count++] = shim_app.swis[i];
+    }
+    shim.swis[shim.swi_count++] = &clock_swi;
+    for (i = 0; i < shim_app.hwi_count; i++)
+    {
+        shim_install(shim_app.hwis[i]);
+    }
+    for (i = 0; i < shim_app.timer_count; i++)
+    {
+        const shim_timer_cfg_t *timer = &shim_app.timers[i];
+        if ((timer->id >= SHIM_TIMERS - 1) || (timer_period[timer->id] != 0))
+        {
+            shim_fatal("bad timer id, Timer2 belongs to the Clock");
+        }
+        timer_hwis[timer->id].name = timer->name;
+        timer_hwis[timer->id].intNum = timer_int[timer->id];
+        timer_hwis[timer->id].fxn = timer->fxn;
+        timer_hwis[timer->id].arg = timer->arg;
+        timer_period[timer->id] = timer->period;
+        if (timer->fxn != NULL)
+        {
+            shim_install(&timer_hwis[timer->id]);
+        }
+    }
+    timer_hwis[2].name = "ti.sysbios.knl.Clock";
+    timer_hwis[2].intNum = timer_int[2];
+    timer_hwis[2].fxn = shim_clock_hwi;
+    timer_period[2] = SHIM_CLOCK_CYCLES;
+    shim_install(&timer_hwis[2]);
+}
+
+/* ======== peripherals and events ======== */
+static void shim_insert(shim_event_t *event)
+{
+    uint16_t i = shim.event_count;
+
+    if (shim.event_count == SHIM_EVENTS)
+    {
+        shim_fatal("event queue full");
+    }
+    while ((i > 0) && ((shim.events[i - 1].at > event->at) ||
+                       ((shim.events[i - 1].at == event->at) && (shim.events[i - 1].seq > event->seq))))
+    {
+        shim.events[i] = shim.events[i - 1];
+        i--;
+    }
+    shim.events[i] = *event;
+    shim.event_count++;
+}
+
+//due events and the poll functions, with the kernel locked
+static void shim_peripherals(void)
+{
+    uint16_t i;
+
+    shim.in_kernel++;
+    while ((shim.event_count > 0) && (shim.events[0].at <= shim.now))
+    {
+        shim_event_t event = shim.events[0];
+        for (i = 1; i < shim.event_count; i++)
+        {
+            shim.events[i - 1] = shim.events[i];
+        }
+        shim.event_count--;
+        if (event.period != 0)
+        {
+            event.at += event.period;
+            shim_insert(&event);
+        }
+        event.fxn(event.arg);
+    }
+    for (i = 0; i < shim.poll_count; i++)
+    {
+        shim.polls[i].fxn(shim.polls[i].arg);
+    }
+    shim.in_kernel--;
+}
+
+//CPU timer expiry: the peripheral it triggers, then its interrupt
+static void shim_timer_expire(void *arg)
+{
+    uint16_t id = (uint16_t)(uintptr_t)arg;
+
+    if (shim.timer_models[id].fxn != NULL)
+    {
+        shim.timer_models[id].fxn(shim.timer_models[id].arg);
+    }
+    if (shim.vector[timer_int[id]] == &timer_hwis[id])
+    {
+        shim_hwi_raise(timer_int[id]);
+    }
+}
+
+uint64_t shim_now(void)
+{
+    return shim.now;
+}
+
+void shim_at(uint64_t cycle, uint64_t period, shim_event_fxn fxn, void *arg)
+{
+    shim_event_t event;
+
+    shim_init();
+    event.at = cycle;
+    event.period = period;
+    event.seq = ++shim.seq;
+    event.fxn = fxn;
+    event.arg = arg;
+    shim_insert(&event);
+}
+
+void shim_on_timer(uint16_t id, shim_event_fxn fxn, void *arg)
+{
+    if (id >= SHIM_TIMERS)
+    {
+        shim_fatal("bad timer id");
+    }
+    shim.timer_models[id].fxn = fxn;
+    shim.timer_models[id].arg = arg;
+}
+
+void shim_poll(shim_event_fxn fxn, void *arg)
+{
+    if (shim.poll_count == SHIM_POLLS)
+    {
+        shim_fatal("too many poll functions");
+    }
+    shim.polls[shim.poll_count].fxn = fxn;
+    shim.polls[shim.poll_count].arg = arg;
+    shim.poll_count++;
+}
+
+void shim_hwi_raise(UInt intNum)
+{
+    shim_init();
+    if ((intNum < SHIM_INTERRUPTS) && (shim.vector[intNum] != NULL) && !shim.pending[intNum])
+    {
+        shim.pending[intNum] = 1; //latched like PIEIFR, taken once enabled
+        shim.pending_count++;
+    }
+}
+
+/* ======== scheduler ======== */
+//the pending and enabled interrupt first in PIE order, -1 if none
+static int shim_next_interrupt(void)
+{
+    uint16_t i;
+
+    if (shim.pending_count == 0)
+    {
+        return -1;
+    }
+    for (i = 0; i < shim.vector_count; i++)
+    {
+        UInt n = shim.order[i];
+        if (shim.pending[n] && shim.enabled[n])
+        {
+            return (int)n;
+        }
+    }
+    return -1;
+}
+
+static void shim_run_hwi(UInt intNum)
+{
+    Hwi_Handle hwi = shim.vector[intNum];
+    uint16_t i;
+
+    shim.pending[intNum] = 0;
+    shim.pending_count--;
+    shim.in_hwi = 1;
+    shim.intm = 1;
+    account_enter(&hwi->stat, hwi->name);
+    shim.in_kernel++;
+    for (i = 0; i < shim_app.hwi_hook_count; i++)
+    {
+        shim_app.hwi_hooks[i].beginFxn(hwi);
+    }
+    shim.in_kernel--;
+    hwi->fxn(hwi->arg);
+    shim.in_kernel++;
+    for (i = 0; i < shim_app.hwi_hook_count; i++)
+    {
+        shim_app.hwi_hooks[i].endFxn(hwi);
+    }
+    shim.in_kernel--;
+    account_leave();
+    shim.in_hwi = 0;
+    shim.intm = 0;
+}
+
+//runs the highest posted Swi above the current level, returns 0 if there is none
+static int shim_run_swi(void)
+{
+    Swi_Handle swi = NULL;
+    int level = shim.swi_level;
+    uint16_t i;
+
+    if (shim.swi_disabled)
+    {
+        return 0;
+    }
+    for (i = 0; i < shim.swi_count; i++)
+    {
+        Swi_Handle s = shim.swis[i];
+        if (s->posted && ((int)s->priority > level) &&
+            ((swi == NULL) || (s->priority > swi->priority) ||
+             ((s->priority == swi->priority) && (s->post_seq < swi->post_seq))))
+        {
+            swi = s;
+        }
+    }
+    if (swi == NULL)
+    {
+        return 0;
+    }
+    swi->posted = 0;
+    shim.swi_level = (int)swi->priority;
+    account_enter(&swi->stat, swi->name);
+    shim.in_kernel++;
+    for (i = 0; i < shim_app.swi_hook_count; i++)
+    {
+        shim_app.swi_hooks[i].beginFxn(swi);
+    }
+    shim.in_kernel--;
+    swi->fxn(swi->arg0, swi->arg1);
+    shim.in_kernel++;
+    for (i = 0; i < shim_app.swi_hook_count; i++)
+    {
+        shim_app.swi_hooks[i].endFxn(swi);
+    }
+    shim.in_kernel--;
+    account_leave();
+    shim.swi_level = level;
+    return 1;
+}
+
+static Task_Handle shim_pick(void)
+{
+    Task_Handle best = NULL;
+    uint16_t i;
+
+    for (i = 0; i < shim.task_count; i++)
+    {
+        Task_Handle t = shim.tasks[i];
+        if ((t->state == SHIM_READY) &&
+            ((best == NULL) || (t->priority > best->priority) ||
+             ((t->priority == best->priority) && (t->ready_seq < best->ready_seq))))
+        {
+            best = t;
+        }
+    }
+    return best; //never NULL, the idle task is always ready
+}
+
+//hands the CPU to next and waits until it comes back, unless prev is done
+static void shim_switch(Task_Handle next)
+{
+    Task_Handle prev = shim.current;
+    uint16_t i;
+
+    shim.in_kernel++;
+    for (i = 0; i < shim_app.task_hook_count; i++)
+    {
+        shim_app.task_hooks[i].switchFxn(prev, next);
+    }
+    shim.in_kernel--;
+    account_mark();
+    shim.account[0] = &next->stat;
+    next->stat.runs++;
+    digest_add(next->name);
+
+    pthread_mutex_lock(&shim_lock);
+    shim.current = next;
+    pthread_cond_signal(&next->wake);
+    if (prev->state != SHIM_TERMINATED)
+    {
+        while (shim.current != prev)
+        {
+            pthread_cond_wait(&prev->wake, &shim_lock);
+        }
+    }
+    pthread_mutex_unlock(&shim_lock);
+}
+
+//at task level: switches if the running task blocked or a higher priority one is ready
+static void shim_schedule(void)
+{
+    Task_Handle next = shim_pick();
+
+    if ((next != shim.current) && ((shim.current->state != SHIM_READY) || (next->priority > shim.current->priority)))
+    {
+        shim_switch(next);
+    }
+}
+
+static void shim_ready(Task_Handle task)
+{
+    task->state = SHIM_READY;
+    task->ready_seq = ++shim.seq;
+    task->timed = 0;
+}
+
+//preemption point, every kernel call ends here
+static void shim_point(void)
+{
+    int n;
+
+    if (!shim.started || shim.in_kernel)
+    {
+        return;
+    }
+    shim_peripherals();
+    if (shim.intm || shim.in_hwi)
+    {
+        return;
+    }
+    do
+    {
+        while ((n = shim_next_interrupt()) >= 0)
+        {
+            shim_run_hwi((UInt)n);
+            shim_peripherals(); //the Hwi took time too
+        }
+    } while (shim_run_swi());
+    if (shim.swi_level < 0)
+    {
+        shim_schedule();
+    }
+}
+
+//every kernel call from the firmware costs call_cycles
+static void shim_charge(void)
+{
+    shim.now += shim_config.call_cycles;
+    if (shim.started && (shim.now > shim_config.run_cycles + SHIM_CPU_HZ))
+    {
+        shim_fatal("no idle time for a second past the end of the run, is a thread spinning?");
+    }
+}
+
+static void shim_block(const char *call)
+{
+    Task_Handle self = shim.current;
+
+    if (!shim.started || shim.in_hwi || shim.in_kernel || (shim.swi_level >= 0) || (self == &idle_task))
+    {
+        shim_fatal(call);
+    }
+    if (shim.intm)
+    {
+        shim_fatal("blocking with interrupts disabled");
+    }
+    self->state = SHIM_BLOCKED;
+    shim_schedule();
+}
+
+/* ======== Clock ======== */
+static Void shim_clock_hwi(UArg arg)
+{
+    Swi_post(&clock_swi);
+}
+
+static Void shim_clock_swi(UArg arg0, UArg arg1)
+{
+    uint16_t i;
+
+    shim.ticks++;
+    for (i = 0; i < shim.task_count; i++)
+    {
+        Task_Handle t = shim.tasks[i];
+        if ((t->state == SHIM_BLOCKED) && t->timed && ((int32_t)(shim.ticks - t->deadline) >= 0))
+        {
+            t->timed_out = (t->pend != NULL);
+            t->pend = NULL;
+            shim_ready(t);
+        }
+    }
+}
+
+UInt32 Clock_getTicks(Void)
+{
+    shim_charge();
+    shim_point();
+    return shim.ticks;
+}
+
+/* ======== Timestamp ======== */
+UInt32 Timestamp_get32(Void)
+{
+    shim_charge();
+    shim_point();
+    return shim_config.timestamp_start + (UInt32)shim.now;
+}
+
+Void Timestamp_get64(Types_Timestamp64 *result)
+{
+    uint64_t now;
+
+    shim_charge();
+    shim_point();
+    now = shim_config.timestamp_start + shim.now;
+    result->hi = (Int32)(now >> 32);
+    result->lo = (UInt32)now;
+}
+
+Void Timestamp_getFreq(Types_FreqHz *freq)
+{
+    freq->hi = 0;
+    freq->lo = SHIM_CPU_HZ;
+}
+
+/* ======== Hwi ======== */
+UInt Hwi_disable(Void)
+{
+    UInt key = shim.intm;
+
+    shim_charge();
+    shim.intm = 1;
+    return key;
+}
+
+UInt Hwi_enable(Void)
+{
+    UInt key = shim.intm;
+
+    shim_charge();
+    shim.intm = 0;
+    shim_point();
+    return key;
+}
+
+Void Hwi_restore(UInt key)
+{
+    shim_charge();
+    shim.intm = key;
+    if (!key)
+    {
+        shim_point();
+    }
+}
+
+UInt Hwi_disableInterrupt(UInt intNum)
+{
+    UInt key;
+
+    shim_init();
+    if (intNum >= SHIM_INTERRUPTS)
+    {
+        return 0;
+    }
+    key = shim.enabled[intNum];
+    shim.enabled[intNum] = 0;
+    return key;
+}
+
+UInt Hwi_enableInterrupt(UInt intNum)
+{
+    UInt key;
+
+    shim_init();
+    if (intNum >= SHIM_INTERRUPTS)
+    {
+        return 0;
+    }
+    key = shim.enabled[intNum];
+    shim.enabled[intNum] = 1;
+    shim_point();
+    return key;
+}
+
+Void Hwi_restoreInterrupt(UInt intNum, UInt key)
+{
+    if (key)
+    {
+        Hwi_enableInterrupt(intNum);
+    }
+    else
+    {
+        Hwi_disableInterrupt(intNum);
+    }
+}
+
+Void Hwi_clearInterrupt(UInt intNum)
+{
+    shim_init();
+    if ((intNum < SHIM_INTERRUPTS) && shim.pending[intNum])
+    {
+        shim.pending[intNum] = 0;
+        shim.pending_count--;
+    }
+}
+
+/* ======== Swi ======== */
+Void Swi_post(Swi_Handle handle)
+{
+    shim_charge();
+    if (!handle->posted)
+    {
+        handle->posted = 1;
+        handle->post_seq = ++shim.seq;
+    }
+    shim_point();
+}
+
+UInt Swi_disable(Void)
+{
+    UInt key = shim.swi_disabled;
+
+    shim_charge();
+    shim.swi_disabled = 1;
+    return key;
+}
+
+Void Swi_restore(UInt key)
+{
+    shim_charge();
+    shim.swi_disabled = key;
+    if (!key)
+    {
+        shim_point();
+    }
+}
+
+/* ======== Semaphore ======== */
+Void Semaphore_post(Semaphore_Handle handle)
+{
+    Task_Handle waiter = NULL;
+    uint16_t i;
+
+    shim_charge();
+    for (i = 0; i < shim.task_count; i++)
+    {
+        Task_Handle t = shim.tasks[i];
+        if ((t->state == SHIM_BLOCKED) && (t->pend == handle) && ((waiter == NULL) || (t->pend_seq < waiter->pend_seq)))
+        {
+            waiter = t;
+        }
+    }
+    if (waiter != NULL)
+    {
+        waiter->pend = NULL;
+        waiter->timed_out = 0;
+        shim_ready(waiter);
+    }
+    else if (handle->mode == Semaphore_Mode_BINARY)
+    {
+        handle->count = 1;
+    }
+    else
+    {
+        handle->count++;
+    }
+    shim_point();
+}
+
+Bool Semaphore_pend(Semaphore_Handle handle, UInt32 timeout)
+{
+    Task_Handle self = shim.current;
+
+    shim_charge();
+    if (handle->count > 0)
+    {
+        handle->count--;
+        shim_point();
+        return TRUE;
+    }
+    if (timeout == BIOS_NO_WAIT)
+    {
+        shim_point();
+        return FALSE;
+    }
+    self->pend = handle;
+    self->pend_seq = ++shim.seq;
+    self->timed = (timeout != BIOS_WAIT_FOREVER);
+    self->deadline = shim.ticks + timeout;
+    self->timed_out = 0;
+    shim_block("Semaphore_pend outside a task");
+    return self->timed_out ? FALSE : TRUE;
+}
+
+Int Semaphore_getCount(Semaphore_Handle handle)
+{
+    return handle->count;
+}
+
+Void Semaphore_reset(Semaphore_Handle handle, Int count)
+{
+    handle->count = count;
+}
+
+/* ======== Task ======== */
+Void Task_sleep(UInt32 nticks)
+{
+    Task_Handle self = shim.current;
+
+    shim_charge();
+    if (nticks == 0)
+    {
+        shim_point();
+        return;
+    }
+    self->pend = NULL;
+    self->timed = (nticks != BIOS_WAIT_FOREVER);
+    self->deadline = shim.ticks + nticks;
+    shim_block("Task_sleep outside a task");
+}
+
+Void Task_yield(Void)
+{
+    Task_Handle next;
+
+    shim_charge();
+    if (!shim.started || shim.in_hwi || (shim.swi_level >= 0))
+    {
+        return;
+    }
+    shim.current->ready_seq = ++shim.seq; //behind the others of its priority
+    next = shim_pick();
+    if (next != shim.current)
+    {
+        shim_switch(next);
+    }
+}
+
+Task_Handle Task_self(Void)
+{
+    return shim.current;
+}
+
+Task_Handle Task_getIdleTask(Void)
+{
+    return &idle_task;
+}
+
+Int Task_getPri(Task_Handle handle)
+{
+    return handle->priority;
+}
+
+static void *shim_task_main(void *arg)
+{
+    Task_Handle self = (Task_Handle)arg;
+
+    pthread_mutex_lock(&shim_lock);
+    while (shim.current != self)
+    {
+        pthread_cond_wait(&self->wake, &shim_lock);
+    }
+    pthread_mutex_unlock(&shim_lock);
+    self->fxn(self->arg0, self->arg1);
+    self->state = SHIM_TERMINATED; //returned, as Task_exit
+    shim_schedule();
+    return NULL;
+}
+
+/* ======== BIOS ======== */
+//The calling thread becomes the idle task. Returns at shim_config.run_cycles.
+Void BIOS_start(Void)
+{
+    uint16_t i;
+
+    shim_init();
+    for (i = 0; i < SHIM_TIMERS; i++)
+    {
+        if (timer_period[i] != 0)
+        {
+            shim_at(shim.now + timer_period[i], timer_period[i], shim_timer_expire, (void *)(uintptr_t)i);
+        }
+    }
+    pthread_cond_init(&idle_task.wake, NULL);
+    shim_ready(&idle_task);
+    for (i = 0; i + 1 < shim.task_count; i++)
+    {
+        Task_Handle t = shim.tasks[i];
+        pthread_cond_init(&t->wake, NULL);
+        shim_ready(t);
+        if (pthread_create(&t->thread, NULL, shim_task_main, t) != 0)
+        {
+            shim_fatal("pthread_create failed");
+        }
+    }
+    shim.account_depth = 0;
+    account_enter(&idle_task.stat, idle_task.name);
+    shim.started = 1;
+    shim.intm = 0;
+    shim_point(); //the highest priority task runs first
+
+    while (shim.now < shim_config.run_cycles)
+    {
+        uint64_t next = shim_config.run_cycles;
+        for (i = 0; i < shim_app.idle_count; i++)
+        {
+            shim_app.idle_fxns[i]();
+        }
+        shim_point();
+        //nothing ready: idle until the next event
+        if ((shim.event_count > 0) && (shim.events[0].at < next))
+        {
+            next = shim.events[0].at;
+        }
+        if (next > shim.now)
+        {
+            shim.now = next;
+        }
+        shim_point();
+    }
+    account_mark();
+    shim.started = 0;
+}
+
+/* ======== System ======== */
+Int System_printf(String fmt, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, fmt);
+    n = vprintf(fmt, args);
+    va_end(args);
+    return n;
+}
+
+Void System_flush(Void)
+{
+    fflush(stdout);
+}
+
+Void System_abort(String str)
+{
+    shim_fatal(str);
+}
+
+/* ======== DelayUs.asm ======== */
+//busy wait on the target, so only virtual time moves
+void DelayUs(unsigned int us)
+{
+    shim.now += (uint64_t)us * (SHIM_CPU_HZ / 1000000UL);
+}
+
+/* ======== results ======== */
+uint32_t shim_digest(void)
+{
+    return shim.digest;
+}
+
+static void report_line(FILE *out, const char *kind, const char *name, const shim_stat_t *stat)
+{
+    if (stat->runs == 0)
+    {
+        return;
+    }
+    fprintf(out, "%-5s %-30s %10lu %8.3f %% %10.0f\n", kind, name, stat->runs,
+            (shim.now != 0) ? 100.0 * (double)stat->cycles / (double)shim.now : 0.0,
+            (double)stat->host_ns / (double)stat->runs);
+}
+
+void shim_report(FILE *out)
+{
+    uint16_t i;
+
+    fprintf(out, "%.3f s virtual, %lu Clock ticks, %u cycles per kernel call\n", (double)shim.now / SHIM_CPU_HZ,
+            (unsigned long)shim.ticks, (unsigned)shim_config.call_cycles);
+    fprintf(out, "%-5s %-30s %10s %10s %10s\n", "kind", "thread", "runs", "CPU", "host ns/run");
+    for (i = 0; i < SHIM_INTERRUPTS; i++)
+    {
+        if (shim.vector[i] != NULL)
+        {
+            report_line(out, "Hwi", shim.vector[i]->name, &shim.vector[i]->stat);
+        }
+    }
+    for (i = 0; i < shim.swi_count; i++)
+    {
+        report_line(out, "Swi", shim.swis[i]->name, &shim.swis[i]->stat);
+    }
+    for (i = 0; i < shim.task_count; i++)
+    {
+        report_line(out, "Task", shim.tasks[i]->name, &shim.tasks[i]->stat);
+    }
+}
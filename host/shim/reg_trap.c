@@ -0,0 +1,166 @@
+// Thie file contains the register blocks of shim.h whose every access calls a peripheral model
+// The firmware's view is a PROT_NONE mapping: an access faults, the handler runs the model (before
+// a read), opens the page and single steps the instruction, then closes it again (after a write).
+// The model's view is a second mapping of the same memory and never faults.
+// Under gdb: handle SIGSEGV SIGTRAP nostop noprint pass
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include "shim.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#define TRAP_SUPPORTED 1
+#define EFLAGS_TF 0x100UL        //single step
+#define PF_WRITE 0x2UL           //page fault error code: the access was a write
+#else
+#define TRAP_SUPPORTED 0
+#endif
+
+typedef struct
+{
+    uint8_t *firmware;
+    uint8_t *model;
+    size_t size;
+    size_t mapped;               //whole pages
+    shim_access_fxn fxn;
+    void *arg;
+} trap_block_t;
+
+static trap_block_t blocks[SHIM_REG_BLOCKS];
+static uint16_t block_count;
+
+//the instruction being stepped, only one CPU runs firmware at a time
+static trap_block_t *step_block;
+static size_t step_offset;
+static int step_write;
+
+static void trap_fatal(const char *what)
+{
+    fprintf(stderr, "shim: %s\n", what);
+    exit(2);
+}
+
+#if TRAP_SUPPORTED
+//not one of ours: back to the default action, the access faults again and the process dies as it should
+static void trap_pass(int sig)
+{
+    signal(sig, SIG_DFL);
+}
+
+static void trap_fault(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uint8_t *addr = (uint8_t *)info->si_addr;
+    uint16_t i;
+
+    for (i = 0; i < block_count; i++)
+    {
+        trap_block_t *b = &blocks[i];
+        if ((addr >= b->firmware) && (addr < b->firmware + b->mapped))
+        {
+            step_block = b;
+            step_offset = (size_t)(addr - b->firmware);
+            step_write = (uc->uc_mcontext.gregs[REG_ERR] & PF_WRITE) != 0;
+            if (!step_write && (step_offset < b->size))
+            {
+                b->fxn(b->arg, step_offset, SHIM_REG_READ);
+            }
+            mprotect(b->firmware, b->mapped, PROT_READ | PROT_WRITE);
+            uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+            return;
+        }
+    }
+    trap_pass(sig);
+}
+
+static void trap_step(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    trap_block_t *b = step_block;
+
+    if (b == NULL)
+    {
+        trap_pass(sig); //a breakpoint that is not ours
+        return;
+    }
+    uc->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+    step_block = NULL;
+    mprotect(b->firmware, b->mapped, PROT_NONE);
+    if (step_write && (step_offset < b->size))
+    {
+        b->fxn(b->arg, step_offset, SHIM_REG_WRITTEN);
+    }
+}
+
+static void trap_install(void)
+{
+    struct sigaction sa;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_sigaction = trap_fault;
+    if (sigaction(SIGSEGV, &sa, NULL) != 0)
+    {
+        trap_fatal("cannot install the register trap");
+    }
+    sa.sa_sigaction = trap_step;
+    if (sigaction(SIGTRAP, &sa, NULL) != 0)
+    {
+        trap_fatal("cannot install the register trap");
+    }
+}
+#endif
+
+shim_regs_t shim_regs_map(size_t size, shim_access_fxn fxn, void *arg)
+{
+    shim_regs_t regs = { NULL, NULL };
+#if TRAP_SUPPORTED
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    trap_block_t *b;
+    void *view;
+    int fd;
+
+    if (block_count == SHIM_REG_BLOCKS)
+    {
+        trap_fatal("too many trapped register blocks");
+    }
+    b = &blocks[block_count];
+    b->size = size;
+    b->mapped = (size + page - 1) / page * page;
+    b->fxn = fxn;
+    b->arg = arg;
+    fd = memfd_create("shim_regs", 0);
+    if ((fd < 0) || (ftruncate(fd, (off_t)b->mapped) != 0))
+    {
+        trap_fatal("cannot create the register memory");
+    }
+    view = mmap(NULL, b->mapped, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    b->model = (view == MAP_FAILED) ? NULL : (uint8_t *)view;
+    view = mmap(NULL, b->mapped, PROT_NONE, MAP_SHARED, fd, 0);
+    b->firmware = (view == MAP_FAILED) ? NULL : (uint8_t *)view;
+    close(fd);
+    if ((b->model == NULL) || (b->firmware == NULL))
+    {
+        trap_fatal("cannot map the register memory");
+    }
+    if (block_count == 0)
+    {
+        trap_install();
+    }
+    block_count++;
+    regs.firmware = b->firmware;
+    regs.model = b->model;
+#else
+    (void)size;
+    (void)fxn;
+    (void)arg;
+    trap_fatal("trapped registers need x86-64 Linux");
+#endif
+    return regs;
+}
@@ -0,0 +1,193 @@
+/*
+ * shim.h
+ *
+ * Host (Linux) stand-in for the SYS/BIOS kernel, so the firmware sources build and run
+ * unchanged on a PC (make -C host firmware_host). One virtual C28x CPU runs in virtual time:
+ *
+ * - Task: every task is a POSIX thread, but only the thread holding the virtual CPU runs.
+ *   The switch hands the CPU over with a condition variable, so the schedule is the one the
+ *   kernel decided and never the host's.
+ * - Hwi: peripheral models raise interrupts (shim_hwi_raise). A raised interrupt is taken at
+ *   the next kernel call made with interrupts enabled, or when the CPU idles. Hwis do not nest
+ *   and run on the thread of whatever they interrupted.
+ * - Swi: run above every task, highest priority first, when the last Hwi returns or when
+ *   posted from a lower level.
+ * - Timestamp: counts virtual SYSCLK cycles at SHIM_CPU_HZ. Firmware code takes no virtual
+ *   time of its own; every kernel call charges shim_config.call_cycles, which is also what
+ *   lets an interrupt land in the middle of a task.
+ * - Clock: 1 ms tick from Timer2 through the Clock Swi, for Task_sleep and pend timeouts.
+ *
+ * The same firmware and the same scenario always give the same schedule (shim_digest).
+ * The register structs are the plain RAM of F2837xD_GlobalVariableDefs.c: a peripheral model
+ * reads what the firmware wrote and writes what it should find, from events (shim_at,
+ * shim_on_timer) or from a poll function (shim_poll) run at every kernel call.
+ * Registers whose access itself has an effect (FIFO data, status read-to-clear) are mapped
+ * with shim_regs_map instead, see reg_trap.c.
+ * app_cfg.c holds the objects of app.cfg.
+ */
+
+#ifndef SHIM_H_
+#define SHIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <xdc/std.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/family/c28/Hwi.h>
+
+#define SHIM_CPU_HZ 200000000UL             //SYSCLK, BIOS.cpuFreq
+#define SHIM_CLOCK_CYCLES (SHIM_CPU_HZ / 1000UL) //Clock tick, 1 ms
+#define SHIM_INTERRUPTS 224                 //c28 Hwi intNum 0..223 (PIE vectors from 32)
+#define SHIM_TIMERS 3                       //CPU timers 0..2, Timer2 drives the Clock
+#define SHIM_SWI_PRIORITIES 16              //Swi.numPriorities, the Clock Swi takes the top one
+#define SHIM_REG_BLOCKS 4                   //register blocks shim_regs_map can trap
+
+//run time accounting of one thread, exclusive of whatever preempted it
+typedef struct
+{
+    unsigned long runs;
+    uint64_t cycles;             //virtual
+    uint64_t host_ns;
+} shim_stat_t;
+
+/* ======== objects, defined statically in app_cfg.c ======== */
+struct Task_Object
+{
+    const char *name;
+    Task_FuncPtr fxn;
+    UArg arg0;
+    UArg arg1;
+    Int priority;
+    //run time state, owned by the thread holding the CPU
+    int state;
+    uint64_t ready_seq;          //FIFO order among equal priorities
+    Semaphore_Handle pend;       //blocked on this one
+    uint64_t pend_seq;
+    int timed;                   //deadline valid
+    uint32_t deadline;           //Clock tick that ends the sleep or pend
+    int timed_out;
+    pthread_t thread;
+    pthread_cond_t wake;
+    shim_stat_t stat;
+};
+
+struct Swi_Object
+{
+    const char *name;
+    Swi_FuncPtr fxn;
+    UArg arg0;
+    UArg arg1;
+    UInt priority;
+    int posted;
+    uint64_t post_seq;
+    shim_stat_t stat;
+};
+
+struct Semaphore_Object
+{
+    const char *name;
+    Semaphore_Mode mode;
+    Int count;
+};
+
+struct Hwi_Object
+{
+    const char *name;
+    UInt intNum;
+    Hwi_FuncPtr fxn;
+    UArg arg;
+    shim_stat_t stat;
+};
+
+//CPU timer created in app.cfg, fxn may be NULL (timer only triggers a peripheral)
+typedef struct
+{
+    const char *name;
+    uint16_t id;
+    uint32_t period;             //SYSCLK counts
+    Hwi_FuncPtr fxn;
+    UArg arg;
+} shim_timer_cfg_t;
+
+//everything the firmware's app.cfg creates and installs
+typedef struct
+{
+    const Task_Handle *tasks;
+    uint16_t task_count;
+    const Swi_Handle *swis;
+    uint16_t swi_count;
+    const Hwi_Handle *hwis;
+    uint16_t hwi_count;
+    const shim_timer_cfg_t *timers;
+    uint16_t timer_count;
+    Void (*const *idle_fxns)(Void);
+    uint16_t idle_count;
+    const Task_HookSet *task_hooks;
+    uint16_t task_hook_count;
+    const Swi_HookSet *swi_hooks;
+    uint16_t swi_hook_count;
+    const Hwi_HookSet *hwi_hooks;
+    uint16_t hwi_hook_count;
+} shim_app_t;
+
+extern const shim_app_t shim_app; //app_cfg.c
+
+//Compares shim_app with the app.cfg it was built from (SHIM_APP_CFG), apart from the hooks.
+//Prints every difference and returns their number, -1 if app.cfg cannot be read.
+int shim_app_check(void);
+
+/* ======== scenario ======== */
+typedef struct
+{
+    uint64_t run_cycles;         //BIOS_start returns when virtual time reaches this
+    uint32_t call_cycles;        //virtual cycles every kernel call from the firmware costs
+    uint32_t timestamp_start;    //Timestamp_get32 at reset, to put a counter wrap where wanted
+} shim_config_t;
+
+extern shim_config_t shim_config; //set before the firmware's main runs
+
+typedef void (*shim_event_fxn)(void *arg);
+
+//Virtual SYSCLK cycles since reset
+uint64_t shim_now(void);
+//Runs fxn in peripheral context once at the given cycle, or every period cycles from then (period 0 = once)
+void shim_at(uint64_t cycle, uint64_t period, shim_event_fxn fxn, void *arg);
+//Runs fxn in peripheral context every time CPU timer id expires, before its interrupt
+void shim_on_timer(uint16_t id, shim_event_fxn fxn, void *arg);
+//Runs fxn in peripheral context at every kernel call and every event, for models that react to register writes
+void shim_poll(shim_event_fxn fxn, void *arg);
+//Flags interrupt intNum, taken when enabled
+void shim_hwi_raise(UInt intNum);
+
+/* ======== register blocks with access side effects (reg_trap.c) ======== */
+typedef enum
+{
+    SHIM_REG_READ,               //before the firmware reads: leave the value it should see
+    SHIM_REG_WRITTEN             //after the firmware wrote: act on it, fix up read-only bits
+} shim_access_t;
+
+//offset is the byte the faulting instruction touched, inside the register
+typedef void (*shim_access_fxn)(void *arg, size_t offset, shim_access_t access);
+
+//two views of the same registers
+typedef struct
+{
+    volatile void *firmware;     //every access traps into the model
+    volatile void *model;        //plain memory, for the model only
+} shim_regs_t;
+
+//Maps size bytes of zeroed registers. fxn runs in the context of the firmware code that made
+//the access, so it may only touch the model view and call shim_now, shim_at and shim_hwi_raise.
+//Needs x86-64 Linux (page protection plus single step).
+shim_regs_t shim_regs_map(size_t size, shim_access_fxn fxn, void *arg);
+
+//Schedule digest: every Hwi, Swi and task switch with its virtual time, same run gives the same value
+uint32_t shim_digest(void);
+//Prints runs and host time per thread, and the virtual time spent in each kind of context
+void shim_report(FILE *out);
+
+#endif /* SHIM_H_ */
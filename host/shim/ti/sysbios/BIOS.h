@@ -0,0 +1,18 @@
+/*
+ * ti/sysbios/BIOS.h
+ *
+ * Host build (host/shim): BIOS_start runs the virtual CPU until the end of the scenario
+ * (shim_config.run_cycles) and returns, unlike on the target.
+ */
+
+#ifndef TI_SYSBIOS_BIOS_H_
+#define TI_SYSBIOS_BIOS_H_
+
+#include <xdc/std.h>
+
+#define BIOS_WAIT_FOREVER (~(UInt32)0)
+#define BIOS_NO_WAIT ((UInt32)0)
+
+Void BIOS_start(Void);
+
+#endif /* TI_SYSBIOS_BIOS_H_ */
@@ -0,0 +1,30 @@
+/*
+ * ti/sysbios/family/c28/Hwi.h
+ *
+ * Host build (host/shim): interrupts are raised by the peripheral models (shim_hwi_raise) and
+ * taken at the next kernel call made with interrupts enabled. Hwis do not nest.
+ */
+
+#ifndef TI_SYSBIOS_FAMILY_C28_HWI_H_
+#define TI_SYSBIOS_FAMILY_C28_HWI_H_
+
+#include <xdc/std.h>
+
+typedef struct Hwi_Object *Hwi_Handle;
+typedef Void (*Hwi_FuncPtr)(UArg arg);
+
+typedef struct
+{
+    Void (*beginFxn)(Hwi_Handle hwi);
+    Void (*endFxn)(Hwi_Handle hwi);
+} Hwi_HookSet;
+
+UInt Hwi_disable(Void);
+UInt Hwi_enable(Void);
+Void Hwi_restore(UInt key);
+UInt Hwi_disableInterrupt(UInt intNum);
+UInt Hwi_enableInterrupt(UInt intNum);
+Void Hwi_restoreInterrupt(UInt intNum, UInt key);
+Void Hwi_clearInterrupt(UInt intNum);
+
+#endif /* TI_SYSBIOS_FAMILY_C28_HWI_H_ */
@@ -0,0 +1,12 @@
+/*
+ * ti/sysbios/hal/Hwi.h
+ *
+ * Host build (host/shim): the hal Hwi is the c28 family Hwi.
+ */
+
+#ifndef TI_SYSBIOS_HAL_HWI_H_
+#define TI_SYSBIOS_HAL_HWI_H_
+
+#include <ti/sysbios/family/c28/Hwi.h>
+
+#endif /* TI_SYSBIOS_HAL_HWI_H_ */
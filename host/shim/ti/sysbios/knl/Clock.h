@@ -0,0 +1,16 @@
+/*
+ * ti/sysbios/knl/Clock.h
+ *
+ * Host build (host/shim): the 1 ms Clock tick, driven by Timer2 as on the target.
+ */
+
+#ifndef TI_SYSBIOS_KNL_CLOCK_H_
+#define TI_SYSBIOS_KNL_CLOCK_H_
+
+#include <xdc/std.h>
+
+extern const UInt32 Clock_tickPeriod; //us
+
+UInt32 Clock_getTicks(Void);
+
+#endif /* TI_SYSBIOS_KNL_CLOCK_H_ */
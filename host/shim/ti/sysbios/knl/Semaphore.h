@@ -0,0 +1,25 @@
+/*
+ * ti/sysbios/knl/Semaphore.h
+ *
+ * Host build (host/shim): binary and counting semaphores, waiters are woken in pend order.
+ */
+
+#ifndef TI_SYSBIOS_KNL_SEMAPHORE_H_
+#define TI_SYSBIOS_KNL_SEMAPHORE_H_
+
+#include <xdc/std.h>
+
+typedef struct Semaphore_Object *Semaphore_Handle;
+
+typedef enum
+{
+    Semaphore_Mode_COUNTING = 0,
+    Semaphore_Mode_BINARY = 2
+} Semaphore_Mode;
+
+Void Semaphore_post(Semaphore_Handle handle);
+Bool Semaphore_pend(Semaphore_Handle handle, UInt32 timeout);
+Int Semaphore_getCount(Semaphore_Handle handle);
+Void Semaphore_reset(Semaphore_Handle handle, Int count);
+
+#endif /* TI_SYSBIOS_KNL_SEMAPHORE_H_ */
@@ -0,0 +1,25 @@
+/*
+ * ti/sysbios/knl/Swi.h
+ *
+ * Host build (host/shim): Swis run on the thread that holds the virtual CPU, above every task.
+ */
+
+#ifndef TI_SYSBIOS_KNL_SWI_H_
+#define TI_SYSBIOS_KNL_SWI_H_
+
+#include <xdc/std.h>
+
+typedef struct Swi_Object *Swi_Handle;
+typedef Void (*Swi_FuncPtr)(UArg arg0, UArg arg1);
+
+typedef struct
+{
+    Void (*beginFxn)(Swi_Handle swi);
+    Void (*endFxn)(Swi_Handle swi);
+} Swi_HookSet;
+
+Void Swi_post(Swi_Handle handle);
+UInt Swi_disable(Void);
+Void Swi_restore(UInt key);
+
+#endif /* TI_SYSBIOS_KNL_SWI_H_ */
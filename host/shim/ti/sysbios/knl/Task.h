@@ -0,0 +1,27 @@
+/*
+ * ti/sysbios/knl/Task.h
+ *
+ * Host build (host/shim): every task is a POSIX thread, but only the one holding the virtual
+ * CPU runs. Preemption happens at kernel calls, see host/shim/shim.h.
+ */
+
+#ifndef TI_SYSBIOS_KNL_TASK_H_
+#define TI_SYSBIOS_KNL_TASK_H_
+
+#include <xdc/std.h>
+
+typedef struct Task_Object *Task_Handle;
+typedef Void (*Task_FuncPtr)(UArg arg0, UArg arg1);
+
+typedef struct
+{
+    Void (*switchFxn)(Task_Handle prev, Task_Handle next);
+} Task_HookSet;
+
+Void Task_sleep(UInt32 nticks);
+Void Task_yield(Void);
+Task_Handle Task_self(Void);
+Task_Handle Task_getIdleTask(Void);
+Int Task_getPri(Task_Handle handle);
+
+#endif /* TI_SYSBIOS_KNL_TASK_H_ */
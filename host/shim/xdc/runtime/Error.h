@@ -0,0 +1,19 @@
+/*
+ * xdc/runtime/Error.h
+ *
+ * Host build (host/shim): nothing in the firmware raises errors, the block is only declared.
+ */
+
+#ifndef XDC_RUNTIME_ERROR_H_
+#define XDC_RUNTIME_ERROR_H_
+
+#include <xdc/std.h>
+
+typedef struct
+{
+    UInt16 unused;
+} Error_Block;
+
+#define Error_init(eb) ((void)(eb))
+
+#endif /* XDC_RUNTIME_ERROR_H_ */
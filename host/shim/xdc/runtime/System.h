@@ -0,0 +1,16 @@
+/*
+ * xdc/runtime/System.h
+ *
+ * Host build (host/shim): System_printf goes to stdout.
+ */
+
+#ifndef XDC_RUNTIME_SYSTEM_H_
+#define XDC_RUNTIME_SYSTEM_H_
+
+#include <xdc/std.h>
+
+Int System_printf(String fmt, ...);
+Void System_flush(Void);
+Void System_abort(String str);
+
+#endif /* XDC_RUNTIME_SYSTEM_H_ */
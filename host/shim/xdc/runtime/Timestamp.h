@@ -0,0 +1,17 @@
+/*
+ * xdc/runtime/Timestamp.h
+ *
+ * Host build (host/shim): the CPU timestamp counter, counting virtual SYSCLK cycles.
+ */
+
+#ifndef XDC_RUNTIME_TIMESTAMP_H_
+#define XDC_RUNTIME_TIMESTAMP_H_
+
+#include <xdc/std.h>
+#include <xdc/runtime/Types.h>
+
+UInt32 Timestamp_get32(Void);
+Void Timestamp_get64(Types_Timestamp64 *result);
+Void Timestamp_getFreq(Types_FreqHz *freq);
+
+#endif /* XDC_RUNTIME_TIMESTAMP_H_ */
@@ -0,0 +1,24 @@
+/*
+ * xdc/runtime/Types.h
+ *
+ * Host build (host/shim): the Types structs returned by Timestamp.
+ */
+
+#ifndef XDC_RUNTIME_TYPES_H_
+#define XDC_RUNTIME_TYPES_H_
+
+#include <xdc/std.h>
+
+typedef struct
+{
+    Int32 hi;
+    UInt32 lo;
+} Types_FreqHz;
+
+typedef struct
+{
+    Int32 hi;
+    UInt32 lo;
+} Types_Timestamp64;
+
+#endif /* XDC_RUNTIME_TYPES_H_ */
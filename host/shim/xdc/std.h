@@ -0,0 +1,46 @@
+/*
+ * xdc/std.h
+ *
+ * Host build (host/shim): the XDCtools base types the firmware uses, sized for a 64-bit
+ * Linux host. UArg holds a pointer as on the target.
+ */
+
+#ifndef XDC_STD_H_
+#define XDC_STD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef char Char;
+typedef unsigned char UChar;
+typedef short Short;
+typedef unsigned short UShort;
+typedef int Int;
+typedef unsigned int UInt;
+typedef long Long;
+typedef unsigned long ULong;
+typedef float Float;
+typedef double Double;
+typedef void Void;
+typedef void *Ptr;
+typedef const char *String;
+typedef uintptr_t UArg;
+typedef unsigned short Bool;
+typedef int8_t Int8;
+typedef int16_t Int16;
+typedef int32_t Int32;
+typedef uint8_t UInt8;
+typedef uint16_t UInt16;
+typedef uint32_t UInt32;
+typedef int64_t Int64;
+typedef uint64_t UInt64;
+typedef int (*Fxn)();
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#endif /* XDC_STD_H_ */
@@ -0,0 +1,72 @@
+// Thie file contains the ADC-A model of sim.h with the capacitive moisture probe on A5
+// ADC-A stays the plain register RAM: every Timer1 expiry converts the SOCs triggered by it,
+// straight into ADCRESULTx, and ADCINT1 follows INT1SEL, INT1E and INT1CONT.
+
+#include "sim.h"
+
+#define ADC_INT 32                //PIE 1.1 ADCA1
+#define ADC_SOCS 16
+#define ADC_MAX_CODE 4095.0
+#define TRIGSEL_TIMER1 2
+#define PROBE_CHANNEL 5           //A5
+
+static uint16_t adc_sample(uint16_t channel)
+{
+    double code = 0.0;            //nothing else is wired
+
+    if (channel == PROBE_CHANNEL)
+    {
+        double noise = sim_signal(SIM_A5_NOISE);
+        code = sim_signal(SIM_A5);
+        if (noise > 0.0)
+        {
+            code += (2.0 * sim_random() - 1.0) * noise;
+        }
+    }
+    code = (code < 0.0) ? 0.0 : (code > ADC_MAX_CODE) ? ADC_MAX_CODE : code;
+    return (uint16_t)(code + 0.5);
+}
+
+//Timer1 expired: the whole burst converts at once, in SOC order
+static void adc_convert(void *arg)
+{
+    volatile Uint32 *socctl = &AdcaRegs.ADCSOC0CTL.all;
+    volatile Uint16 *result = &AdcaResultRegs.ADCRESULT0;
+    int eoc1 = 0;
+    uint16_t i;
+
+    if (!AdcaRegs.ADCCTL1.bit.ADCPWDNZ)
+    {
+        return;
+    }
+    for (i = 0; i < ADC_SOCS; i++)
+    {
+        if (((socctl[i] >> 20) & 0x1F) == TRIGSEL_TIMER1)
+        {
+            result[i] = adc_sample((uint16_t)((socctl[i] >> 15) & 0x0F));
+            eoc1 |= (i == AdcaRegs.ADCINTSEL1N2.bit.INT1SEL);
+            sim_stats.adc_conversions++;
+        }
+    }
+
+    AdcaRegs.ADCINTFLG.all &= ~AdcaRegs.ADCINTFLGCLR.all; //write-1-to-clear, reads as 0
+    AdcaRegs.ADCINTFLGCLR.all = 0;
+    AdcaRegs.ADCINTOVF.all &= ~AdcaRegs.ADCINTOVFCLR.all;
+    AdcaRegs.ADCINTOVFCLR.all = 0;
+    if (!eoc1 || !AdcaRegs.ADCINTSEL1N2.bit.INT1E)
+    {
+        return;
+    }
+    if (AdcaRegs.ADCINTFLG.bit.ADCINT1 && !AdcaRegs.ADCINTSEL1N2.bit.INT1CONT)
+    {
+        AdcaRegs.ADCINTOVF.bit.ADCINT1 = 1; //no pulse until the flag is cleared
+        return;
+    }
+    AdcaRegs.ADCINTFLG.bit.ADCINT1 = 1;
+    shim_hwi_raise(ADC_INT);
+}
+
+void sim_adc_init(void)
+{
+    shim_on_timer(1, adc_convert, NULL);
+}
@@ -0,0 +1,102 @@
+// Thie file contains the HC-SR04 ranging model of sim.h: ePWM2 trigger, echo pulse, eCAP1 capture
+// ePWM2 and eCAP1 stay the plain register RAM: the model reads the configuration at every trigger
+// and applies the ECCLR the firmware wrote since the last capture event.
+
+#include "sim.h"
+#include "../../water_level.h"
+
+#define ECAP_INT 56               //PIE 4.1 ECAP1
+#define ECHO_DELAY_US 460         //trigger falling edge to ECHO high: the 8-cycle 40 kHz burst and settling
+#define ECHO_TIMEOUT_US 38000     //ECHO pulse of a ranging that heard nothing
+#define ECHO_MAX_MM 4000.0        //beyond this the echo is too weak
+#define ECHO_MIN_MM 20.0
+
+static uint16_t ecap_event;       //mod-4 counter, next event 0..3
+static uint64_t ecap_last;        //cycle of the previous capture event
+static uint64_t echo_width;       //of the pulse in flight
+
+//SYSCLK cycles per TBCLK: EPWMCLK = SYSCLK / 2, TBCLK = EPWMCLK / (HSPCLKDIV * CLKDIV)
+static uint64_t epwm2_tbclk_cycles(void)
+{
+    uint16_t hsp = EPwm2Regs.TBCTL.bit.HSPCLKDIV;
+
+    return 2ULL * ((hsp == 0) ? 1U : 2U * hsp) * (1ULL << EPwm2Regs.TBCTL.bit.CLKDIV);
+}
+
+//one edge on ECAP1: CTRRSTx makes every capture the time since the event before
+static void ecap_capture(void)
+{
+    volatile Uint32 *cap = &ECap1Regs.CAP1;
+    uint64_t now = shim_now();
+    uint16_t event = ecap_event;
+
+    ECap1Regs.ECFLG.all &= ~ECap1Regs.ECCLR.all; //write-1-to-clear, reads as 0
+    ECap1Regs.ECCLR.all = 0;
+    if (!ECap1Regs.ECCTL2.bit.TSCTRSTOP || !ECap1Regs.ECCTL1.bit.CAPLDEN)
+    {
+        ecap_last = now;
+        return;
+    }
+    cap[event] = (Uint32)(now - ecap_last);
+    ecap_last = now;
+    ecap_event = (event + 1) % 4;
+    ECap1Regs.ECFLG.all |= 1U << (event + 1); //CEVT1..4
+    if (ECap1Regs.ECEINT.all & (1U << (event + 1)))
+    {
+        if (ECap1Regs.ECFLG.bit.INT)
+        {
+            sim_stats.ecap_overruns++; //no new interrupt until the firmware clears INT
+            return;
+        }
+        ECap1Regs.ECFLG.bit.INT = 1;
+        shim_hwi_raise(ECAP_INT);
+    }
+}
+
+static void echo_fall(void *arg)
+{
+    ecap_capture();
+}
+
+static void echo_rise(void *arg)
+{
+    ecap_capture();
+    shim_at(shim_now() + echo_width, 0, echo_fall, NULL);
+}
+
+//ePWM2 counter zero: TRIG goes high for CMPA counts, the sensor answers after it falls
+static void hcsr04_trigger(void *arg)
+{
+    uint64_t tbclk = epwm2_tbclk_cycles();
+    double mm = sim_signal(SIM_DISTANCE);
+    double speed = SOUND_SPEED_0C + SOUND_SPEED_PER_C * sim_signal(SIM_TEMPERATURE);
+    uint64_t trig = tbclk * EPwm2Regs.CMPA.bit.CMPA;
+
+    if (!CpuSysRegs.PCLKCR0.bit.TBCLKSYNC || (EPwm2Regs.TBCTL.bit.CTRMODE != 0) || (EPwm2Regs.TBPRD == 0))
+    {
+        shim_at(shim_now() + SIM_CYCLES_MS, 0, hcsr04_trigger, NULL); //not counting yet, look again later
+        return;
+    }
+    shim_at(shim_now() + ((uint64_t)EPwm2Regs.TBPRD + 1U) * tbclk, 0, hcsr04_trigger, NULL);
+
+    if (mm < ECHO_MIN_MM)
+    {
+        mm = ECHO_MIN_MM;
+    }
+    if ((mm > ECHO_MAX_MM) || sim_chance(sim_signal(SIM_ECHO_LOSS)))
+    {
+        echo_width = (uint64_t)ECHO_TIMEOUT_US * (SHIM_CPU_HZ / 1000000UL);
+        sim_stats.echoes_lost++;
+    }
+    else
+    {
+        echo_width = (uint64_t)(2.0 * mm / 1000.0 / speed * SHIM_CPU_HZ + 0.5);
+        sim_stats.echoes++;
+    }
+    shim_at(shim_now() + trig + (uint64_t)ECHO_DELAY_US * (SHIM_CPU_HZ / 1000000UL), 0, echo_rise, NULL);
+}
+
+void sim_hcsr04_init(void)
+{
+    shim_at(0, 0, hcsr04_trigger, NULL);
+}
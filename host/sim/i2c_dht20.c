@@ -0,0 +1,585 @@
+// Thie file contains the I2C-B controller and the DHT20 behind it (sim.h)
+// The controller runs one bus phase per event: address, each byte, STOP, timed from the clock
+// dividers. Only the DHT20 answers (DHT20_ADDR); a NACK holds the bus until the firmware sets STP.
+
+#include <stddef.h>
+#include "sim.h"
+#include "../../i2c_driver.h"
+
+#define I2C_INT 90                //PIE 8.3 I2CB
+#define I2C_FIFO_INT 91           //PIE 8.4 I2CB_FIFO
+
+//I2CSTR bits
+#define STR_ARBL 0x0001
+#define STR_NACK 0x0002
+#define STR_ARDY 0x0004
+#define STR_RRDY 0x0008
+#define STR_XRDY 0x0010
+#define STR_SCD 0x0020
+#define STR_FLAGS 0x003F          //write 1 to clear
+#define STR_XSMT 0x0400
+#define STR_BB 0x1000
+
+//DHT20 status byte
+#define DHT20_BUSY 0x80
+#define DHT20_CAL_ENABLE 0x08
+#define DHT20_CAL_OK 0x10         //the calibration registers hold their values
+#define DHT20_DATA 7              //status, 20-bit humidity and temperature, CRC
+#define DHT20_REGS 3              //0x1B 0x1C 0x1E
+
+typedef enum
+{
+    BUS_IDLE,
+    BUS_ADDRESS,                  //START and the address byte on the wire
+    BUS_TX,
+    BUS_RX,
+    BUS_HOLD,                     //clock held low after NACK or ARDY until STT or STP
+    BUS_STOP
+} bus_state_t;
+
+static volatile struct I2C_REGS *regs; //model view
+
+static struct
+{
+    bus_state_t state;
+    uint32_t gen;                 //the step event that is still valid
+    int stalled;                  //waiting for the FIFO before the next byte
+    int read;
+    uint16_t count;               //bytes left of I2CCNT
+    uint8_t shift;                //byte on the wire
+    uint16_t str;
+    uint8_t tx_fifo[I2C_FIFO_DEPTH];
+    uint16_t tx_head;
+    uint16_t tx_count;
+    uint8_t rx_fifo[I2C_FIFO_DEPTH];
+    uint16_t rx_head;
+    uint16_t rx_count;
+    int tx_int;
+    int rx_int;
+    int fifo_irq;                 //FIFO interrupt line as last raised
+} bus;
+
+static struct
+{
+    int addressed;
+    int restored[DHT20_REGS];
+    uint16_t reg[DHT20_REGS];
+    int reg_select;               //register read back by the next read, -1 = measurement data
+    uint8_t cmd[4];
+    uint16_t cmd_len;
+    uint16_t read_pos;
+    uint8_t data[DHT20_DATA];
+    uint64_t busy_until;
+} dht;
+
+static const uint8_t dht_reg_addr[DHT20_REGS] = { 0x1B, 0x1C, 0x1E };
+
+/* ======== DHT20 ======== */
+static uint8_t dht_crc8(const uint8_t *data, uint16_t length)
+{
+    uint8_t crc = 0xFF;
+    uint16_t i;
+    uint16_t bit;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint8_t dht_status(void)
+{
+    uint8_t status = DHT20_CAL_ENABLE;
+
+    if (dht.restored[0] && dht.restored[1] && dht.restored[2])
+    {
+        status |= DHT20_CAL_OK;
+    }
+    if (shim_now() < dht.busy_until)
+    {
+        status |= DHT20_BUSY;
+    }
+    return status;
+}
+
+static uint32_t dht_raw(double value)
+{
+    double raw = value * 1048576.0 + 0.5;
+    return (raw < 0.0) ? 0 : (raw > 1048575.0) ? 1048575UL : (uint32_t)raw;
+}
+
+//converts what the environment is now, the result shows up once the measurement time is over
+static void dht_trigger(void)
+{
+    uint32_t rh = dht_raw(sim_signal(SIM_HUMIDITY) / 100.0);
+    uint32_t t = dht_raw((sim_signal(SIM_TEMPERATURE) + 50.0) / 200.0);
+
+    if ((dht.cmd_len != 3) || (dht.cmd[1] != 0x33) || (dht.cmd[2] != 0x00))
+    {
+        sim_stats.dht20_short_triggers++;
+    }
+    dht.data[1] = (uint8_t)(rh >> 12);
+    dht.data[2] = (uint8_t)(rh >> 4);
+    dht.data[3] = (uint8_t)(((rh & 0x0F) << 4) | (t >> 16));
+    dht.data[4] = (uint8_t)(t >> 8);
+    dht.data[5] = (uint8_t)t;
+    dht.busy_until = shim_now() + (uint64_t)(sim_signal(SIM_DHT20_MEASURE) * SIM_CYCLES_MS);
+    sim_stats.dht20_measurements++;
+}
+
+//a write transfer ended: act on the command it carried
+static void dht_command(void)
+{
+    uint16_t i;
+
+    if (dht.cmd_len == 0)
+    {
+        return;
+    }
+    dht.reg_select = -1;
+    if (dht.cmd[0] == 0xAC)
+    {
+        dht_trigger();
+    }
+    else if (dht.cmd[0] == 0xBA)
+    {
+        sim_dht20_reset(); //soft reset
+    }
+    for (i = 0; i < DHT20_REGS; i++)
+    {
+        if ((dht.cmd[0] == dht_reg_addr[i]) && (dht.cmd_len == 3))
+        {
+            dht.reg_select = i;
+        }
+        else if ((dht.cmd[0] == (0xB0 | dht_reg_addr[i])) && (dht.cmd_len == 3))
+        {
+            dht.reg[i] = (uint16_t)((dht.cmd[1] << 8) | dht.cmd[2]);
+            dht.restored[i] = 1;
+            sim_stats.dht20_register_writes++;
+        }
+    }
+}
+
+static int dht_address(uint16_t address, int read)
+{
+    if ((address != DHT20_ADDR) || sim_chance(sim_signal(SIM_I2C_NACK)))
+    {
+        return 0;
+    }
+    if (dht.addressed)
+    {
+        dht_command(); //repeated START ends the write before it
+    }
+    dht.addressed = 1;
+    dht.cmd_len = 0;
+    dht.read_pos = 0;
+    if (read && (dht.reg_select < 0) && (dht_status() & DHT20_BUSY))
+    {
+        sim_stats.dht20_busy_reads++;
+    }
+    if (read && (dht.reg_select < 0) && !(dht_status() & DHT20_CAL_OK))
+    {
+        sim_stats.dht20_uncalibrated_reads++;
+    }
+    return 1;
+}
+
+static int dht_write(uint8_t byte)
+{
+    if (dht.cmd_len < sizeof(dht.cmd))
+    {
+        dht.cmd[dht.cmd_len] = byte;
+    }
+    dht.cmd_len++;
+    return 1;
+}
+
+static uint8_t dht_read(void)
+{
+    uint16_t pos = dht.read_pos++;
+
+    if (pos == 0)
+    {
+        dht.data[0] = dht_status();
+        return dht.data[0];
+    }
+    if (dht.reg_select >= 0)
+    {
+        return (pos == 1) ? (uint8_t)(dht.reg[dht.reg_select] >> 8) :
+               (pos == 2) ? (uint8_t)dht.reg[dht.reg_select] : 0xFF;
+    }
+    if (pos == DHT20_DATA - 1)
+    {
+        return dht_crc8(dht.data, DHT20_DATA - 1);
+    }
+    return (pos < DHT20_DATA) ? dht.data[pos] : 0xFF;
+}
+
+static void dht_stop(void)
+{
+    if (dht.addressed)
+    {
+        dht.addressed = 0;
+        dht_command();
+        dht.cmd_len = 0;
+    }
+}
+
+void sim_dht20_reset(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < DHT20_REGS; i++)
+    {
+        dht.restored[i] = 0;
+        dht.reg[i] = 0;
+    }
+    dht.reg_select = -1;
+    dht.busy_until = shim_now() + 20ULL * SIM_CYCLES_MS; //soft reset time
+}
+
+/* ======== I2C-B controller ======== */
+//SCL period in SYSCLK cycles: (IPSC + 1) * (ICCL + d + ICCH + d)
+static uint64_t bus_bit_cycles(void)
+{
+    uint16_t ipsc = regs->I2CPSC.bit.IPSC;
+    uint16_t d = (ipsc == 0) ? 7 : (ipsc == 1) ? 6 : 5;
+
+    return (uint64_t)(ipsc + 1) * (regs->I2CCLKL + regs->I2CCLKH + 2U * d);
+}
+
+//model state back into the registers the firmware reads
+static void bus_sync(void)
+{
+    regs->I2CSTR.all = bus.str | ((bus.state == BUS_IDLE) ? 0 : STR_BB) | (bus.tx_count == 0 ? STR_XSMT : 0);
+    regs->I2CFFTX.bit.TXFFST = bus.tx_count;
+    regs->I2CFFTX.bit.TXFFINT = bus.tx_int;
+    regs->I2CFFTX.bit.TXFFINTCLR = 0;
+    regs->I2CFFRX.bit.RXFFST = bus.rx_count;
+    regs->I2CFFRX.bit.RXFFINT = bus.rx_int;
+    regs->I2CFFRX.bit.RXFFINTCLR = 0;
+}
+
+//FIFO flags follow the levels, the interrupt is raised on every new request
+static void bus_fifo_update(int force)
+{
+    int irq;
+
+    if (bus.tx_count <= regs->I2CFFTX.bit.TXFFIL)
+    {
+        bus.tx_int = 1;
+    }
+    if (bus.rx_count >= regs->I2CFFRX.bit.RXFFIL)
+    {
+        bus.rx_int = 1;
+    }
+    irq = (bus.tx_int && regs->I2CFFTX.bit.TXFFIENA) || (bus.rx_int && regs->I2CFFRX.bit.RXFFIENA);
+    if (irq && (!bus.fifo_irq || force))
+    {
+        shim_hwi_raise(I2C_FIFO_INT);
+    }
+    bus.fifo_irq = irq;
+    bus_sync();
+}
+
+static void bus_flag(uint16_t flag)
+{
+    bus.str |= flag;
+    if (regs->I2CIER.all & flag)
+    {
+        shim_hwi_raise(I2C_INT);
+    }
+    bus_sync();
+}
+
+static void bus_step(void *arg);
+
+static void bus_schedule(uint64_t bits)
+{
+    bus.gen++;
+    if (sim_signal(SIM_I2C_STALL) != 0.0)
+    {
+        return; //SCL held low: nothing more happens until a module reset
+    }
+    shim_at(shim_now() + bits * bus_bit_cycles(), 0, bus_step, (void *)(uintptr_t)bus.gen);
+}
+
+static void bus_next_byte(void)
+{
+    bus.stalled = 0;
+    if (!bus.read)
+    {
+        if (bus.tx_count == 0)
+        {
+            bus.stalled = 1; //clock stretched until I2CDXR is written
+            return;
+        }
+        bus.shift = bus.tx_fifo[bus.tx_head];
+        bus.tx_head = (bus.tx_head + 1) % I2C_FIFO_DEPTH;
+        bus.tx_count--;
+        bus_fifo_update(0);
+    }
+    else if (bus.rx_count == I2C_FIFO_DEPTH)
+    {
+        bus.stalled = 1; //until I2CDRR is read
+        return;
+    }
+    bus_schedule(9);
+}
+
+static void bus_stop(void)
+{
+    bus.state = BUS_STOP;
+    bus_schedule(1);
+}
+
+//I2CCNT done: STOP if it was asked for, else ARDY and hold the clock for the next START
+static void bus_count_done(void)
+{
+    if (regs->I2CMDR.bit.STP)
+    {
+        bus_stop();
+    }
+    else
+    {
+        bus.state = BUS_HOLD;
+        bus_flag(STR_ARDY);
+    }
+}
+
+static void bus_nack(void)
+{
+    sim_stats.i2c_nacks++;
+    bus.state = BUS_HOLD;
+    bus_flag(STR_NACK);
+}
+
+static void bus_step(void *arg)
+{
+    if ((uint32_t)(uintptr_t)arg != bus.gen)
+    {
+        return; //superseded by a reset
+    }
+    switch (bus.state)
+    {
+    case BUS_ADDRESS:
+        if (!dht_address(regs->I2CSAR.bit.SAR, bus.read))
+        {
+            bus_nack();
+            break;
+        }
+        bus.state = bus.read ? BUS_RX : BUS_TX;
+        bus_next_byte();
+        break;
+
+    case BUS_TX:
+        if (!dht_write(bus.shift))
+        {
+            bus_nack();
+            break;
+        }
+        regs->I2CCNT = --bus.count;
+        if (bus.count == 0)
+        {
+            bus_count_done();
+            break;
+        }
+        bus_next_byte();
+        break;
+
+    case BUS_RX:
+        bus.rx_fifo[(bus.rx_head + bus.rx_count) % I2C_FIFO_DEPTH] = dht_read();
+        bus.rx_count++;
+        regs->I2CCNT = --bus.count;
+        bus_fifo_update(0);
+        if (bus.count == 0)
+        {
+            bus_count_done(); //the last byte was NACKed by us
+            break;
+        }
+        bus_next_byte();
+        break;
+
+    case BUS_STOP:
+        dht_stop();
+        bus.state = BUS_IDLE;
+        regs->I2CMDR.bit.STP = 0;
+        regs->I2CMDR.bit.MST = 0;
+        sim_stats.i2c_transfers++;
+        bus_flag(STR_SCD);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void bus_reset(void)
+{
+    bus.gen++; //drops the pending step
+    if (bus.state != BUS_IDLE)
+    {
+        dht_stop();
+    }
+    bus.state = BUS_IDLE;
+    bus.stalled = 0;
+    bus.str = 0;
+    bus_sync();
+}
+
+static void bus_mode_written(void)
+{
+    if (!regs->I2CMDR.bit.IRS)
+    {
+        bus_reset();
+        return;
+    }
+    if (regs->I2CMDR.bit.STT && ((bus.state == BUS_IDLE) || (bus.state == BUS_HOLD)))
+    {
+        regs->I2CMDR.bit.STT = 0; //cleared once the START is on the wire
+        bus.read = !regs->I2CMDR.bit.TRX;
+        bus.count = regs->I2CCNT;
+        bus.state = BUS_ADDRESS;
+        bus_sync();
+        bus_schedule(10); //START and the address byte
+    }
+    else if (regs->I2CMDR.bit.STP && (bus.state == BUS_HOLD))
+    {
+        bus_stop();
+    }
+}
+
+static void bus_fifo_written(size_t reg)
+{
+    if (reg == offsetof(struct I2C_REGS, I2CFFTX))
+    {
+        int clear = regs->I2CFFTX.bit.TXFFINTCLR;
+        if (!regs->I2CFFTX.bit.TXFFRST)
+        {
+            bus.tx_count = 0;
+            bus.tx_head = 0;
+        }
+        if (clear)
+        {
+            bus.tx_int = 0;
+        }
+        bus_fifo_update(clear);
+    }
+    else
+    {
+        int clear = regs->I2CFFRX.bit.RXFFINTCLR;
+        if (!regs->I2CFFRX.bit.RXFFRST)
+        {
+            bus.rx_count = 0;
+            bus.rx_head = 0;
+        }
+        if (clear)
+        {
+            bus.rx_int = 0;
+        }
+        bus_fifo_update(clear);
+    }
+}
+
+//highest priority flag that is enabled, reading clears it unless it is ARDY, RRDY or XRDY
+static void bus_isrc_read(void)
+{
+    uint16_t pending = bus.str & regs->I2CIER.all & STR_FLAGS;
+    uint16_t code = 0;
+
+    while ((code < 6) && !(pending & (1U << code)))
+    {
+        code++;
+    }
+    if (code == 6)
+    {
+        regs->I2CISRC.all = 0;
+        return;
+    }
+    regs->I2CISRC.all = code + 1;
+    if ((1U << code) & (STR_ARBL | STR_NACK | STR_SCD))
+    {
+        bus.str &= ~(1U << code);
+    }
+    if (bus.str & regs->I2CIER.all & STR_FLAGS)
+    {
+        shim_hwi_raise(I2C_INT); //the next one asks again
+    }
+    bus_sync();
+}
+
+static void i2c_access(void *arg, size_t offset, shim_access_t access)
+{
+    size_t reg = SIM_REG(offset);
+
+    if (access == SHIM_REG_READ)
+    {
+        if ((reg == offsetof(struct I2C_REGS, I2CDRR)) && (bus.rx_count > 0))
+        {
+            regs->I2CDRR.all = bus.rx_fifo[bus.rx_head];
+            bus.rx_head = (bus.rx_head + 1) % I2C_FIFO_DEPTH;
+            bus.rx_count--;
+            bus_fifo_update(0);
+            if (bus.stalled && (bus.state == BUS_RX))
+            {
+                bus_next_byte();
+            }
+        }
+        else if (reg == offsetof(struct I2C_REGS, I2CISRC))
+        {
+            bus_isrc_read();
+        }
+        return;
+    }
+
+    if (reg == offsetof(struct I2C_REGS, I2CMDR))
+    {
+        bus_mode_written();
+    }
+    else if (reg == offsetof(struct I2C_REGS, I2CDXR))
+    {
+        if (regs->I2CFFTX.bit.I2CFFEN && regs->I2CFFTX.bit.TXFFRST && (bus.tx_count < I2C_FIFO_DEPTH))
+        {
+            bus.tx_fifo[(bus.tx_head + bus.tx_count) % I2C_FIFO_DEPTH] = (uint8_t)regs->I2CDXR.all;
+            bus.tx_count++;
+        }
+        bus_fifo_update(0);
+        if (bus.stalled && (bus.state == BUS_TX))
+        {
+            bus_next_byte();
+        }
+    }
+    else if (reg == offsetof(struct I2C_REGS, I2CSTR))
+    {
+        bus.str &= ~(regs->I2CSTR.all & STR_FLAGS);
+        bus_sync();
+    }
+    else if ((reg == offsetof(struct I2C_REGS, I2CFFTX)) || (reg == offsetof(struct I2C_REGS, I2CFFRX)))
+    {
+        bus_fifo_written(reg);
+    }
+    else if (reg == offsetof(struct I2C_REGS, I2CISRC))
+    {
+        bus_sync(); //read-only
+    }
+}
+
+void sim_i2c_init(void)
+{
+    shim_regs_t view = shim_regs_map(sizeof(struct I2C_REGS), i2c_access, NULL);
+    uint16_t i;
+
+    I2cbRegs_host = view.firmware;
+    regs = view.model;
+    for (i = 0; i < DHT20_REGS; i++)
+    {
+        dht.restored[i] = 1; //powered up with its calibration intact
+    }
+    dht.reg_select = -1;
+    bus_sync();
+}
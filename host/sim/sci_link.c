@@ -0,0 +1,274 @@
+// Thie file contains the SCIB model of sim.h: both FIFOs, the shift register and the baud rate
+// Bytes leave one character time apart (start, 8 data, stop at LSPCLK / 8 / (BRR + 1)) and go to
+// the callback; bytes from the script arrive the same way, with RXFFOVF when nobody empties the FIFO.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include "sim.h"
+
+#define SCI_TX_INT 99             //PIE 9.4 SCIB_TX
+#define SCI_FIFO 16
+#define SCI_CHAR_CYCLES 320U      //10 bits * 8 LSPCLK * SYSCLK / LSPCLK (4)
+
+static volatile struct SCI_REGS *regs; //model view
+
+static struct
+{
+    void (*fxn)(void *arg, uint8_t byte);
+    void *arg;
+    uint32_t gen;                 //the shift event that is still valid
+    int shifting;
+    uint8_t shift;
+    uint8_t tx_fifo[SCI_FIFO];
+    uint16_t tx_head;
+    uint16_t tx_count;
+    int tx_int;
+    int tx_irq;                   //interrupt line as last raised
+    uint8_t rx_fifo[SCI_FIFO];
+    uint16_t rx_head;
+    uint16_t rx_count;
+    int rx_ovf;
+    uint8_t *line;                //on its way in from the script
+    size_t line_head;
+    size_t line_count;
+    size_t line_size;
+    int line_busy;
+} sci;
+
+static uint64_t sci_char_cycles(void)
+{
+    uint32_t brr = ((uint32_t)regs->SCIHBAUD.all << 8) | regs->SCILBAUD.all;
+
+    return (uint64_t)SCI_CHAR_CYCLES * (brr + 1U);
+}
+
+static int sci_tx_enabled(void)
+{
+    return regs->SCIFFTX.bit.SCIRST && regs->SCIFFTX.bit.SCIFFENA && regs->SCICTL1.bit.SWRESET &&
+           regs->SCICTL1.bit.TXENA;
+}
+
+static int sci_rx_enabled(void)
+{
+    return regs->SCIFFTX.bit.SCIRST && regs->SCIFFRX.bit.RXFIFORESET && regs->SCICTL1.bit.SWRESET &&
+           regs->SCICTL1.bit.RXENA;
+}
+
+//model state back into the registers the firmware reads
+static void sci_sync(void)
+{
+    regs->SCIFFTX.bit.TXFFST = sci.tx_count;
+    regs->SCIFFTX.bit.TXFFINT = sci.tx_int;
+    regs->SCIFFTX.bit.TXFFINTCLR = 0;
+    regs->SCIFFRX.bit.RXFFST = sci.rx_count;
+    regs->SCIFFRX.bit.RXFFOVF = sci.rx_ovf;
+    regs->SCIFFRX.bit.RXFFOVRCLR = 0;
+    regs->SCIFFRX.bit.RXFFINTCLR = 0;
+    regs->SCICTL2.bit.TXRDY = sci.tx_count < SCI_FIFO;
+    regs->SCICTL2.bit.TXEMPTY = !sci.shifting && (sci.tx_count == 0);
+}
+
+//TXFFINT follows the level, the interrupt is raised on every new request
+static void sci_fifo_update(int force)
+{
+    int irq;
+
+    if (regs->SCIFFTX.bit.SCIFFENA && (sci.tx_count <= regs->SCIFFTX.bit.TXFFIL))
+    {
+        sci.tx_int = 1;
+    }
+    irq = sci.tx_int && regs->SCIFFTX.bit.TXFFIENA;
+    if (irq && (!sci.tx_irq || force))
+    {
+        shim_hwi_raise(SCI_TX_INT);
+    }
+    sci.tx_irq = irq;
+    sci_sync();
+}
+
+static void sci_shifted(void *arg);
+
+//FIFO to the shift register, the byte is out one character time later
+static void sci_tx_start(void)
+{
+    if (sci.shifting || (sci.tx_count == 0) || !sci_tx_enabled())
+    {
+        return;
+    }
+    sci.shift = sci.tx_fifo[sci.tx_head];
+    sci.tx_head = (sci.tx_head + 1) % SCI_FIFO;
+    sci.tx_count--;
+    sci.shifting = 1;
+    sci.gen++;
+    shim_at(shim_now() + sci_char_cycles(), 0, sci_shifted, (void *)(uintptr_t)sci.gen);
+    sci_fifo_update(0);
+}
+
+static void sci_shifted(void *arg)
+{
+    if ((uint32_t)(uintptr_t)arg != sci.gen)
+    {
+        return; //superseded by a reset
+    }
+    sci.shifting = 0;
+    sim_stats.uart_tx_bytes++;
+    if (sci.fxn != NULL)
+    {
+        sci.fxn(sci.arg, sci.shift);
+    }
+    sci_sync();
+    sci_tx_start();
+}
+
+static void sci_received(void *arg)
+{
+    uint8_t byte = sci.line[sci.line_head];
+
+    sci.line_head++;
+    sci.line_count--;
+    if (sci_rx_enabled())
+    {
+        sim_stats.uart_rx_bytes++;
+        if (sci.rx_count == SCI_FIFO)
+        {
+            sci.rx_ovf = 1; //the byte is lost
+            sim_stats.uart_rx_overruns++;
+        }
+        else
+        {
+            sci.rx_fifo[(sci.rx_head + sci.rx_count) % SCI_FIFO] = byte;
+            sci.rx_count++;
+        }
+        sci_sync();
+    }
+    sci.line_busy = sci.line_count != 0;
+    if (sci.line_busy)
+    {
+        shim_at(shim_now() + sci_char_cycles(), 0, sci_received, NULL);
+    }
+}
+
+void sim_sci_receive(const uint8_t *data, size_t length)
+{
+    size_t i;
+
+    if (sci.line_head + sci.line_count + length > sci.line_size)
+    {
+        for (i = 0; i < sci.line_count; i++)
+        {
+            sci.line[i] = sci.line[sci.line_head + i];
+        }
+        sci.line_head = 0;
+        if (sci.line_count + length > sci.line_size)
+        {
+            sci.line_size = sci.line_count + length;
+            sci.line = realloc(sci.line, sci.line_size);
+            if (sci.line == NULL)
+            {
+                fprintf(stderr, "sim: out of memory\n");
+                exit(2);
+            }
+        }
+    }
+    for (i = 0; i < length; i++)
+    {
+        sci.line[sci.line_head + sci.line_count++] = data[i];
+    }
+    if (!sci.line_busy && (sci.line_count != 0))
+    {
+        sci.line_busy = 1;
+        shim_at(shim_now() + sci_char_cycles(), 0, sci_received, NULL);
+    }
+}
+
+static void sci_fftx_written(void)
+{
+    int clear = regs->SCIFFTX.bit.TXFFINTCLR;
+
+    if (!regs->SCIFFTX.bit.SCIRST)
+    {
+        sci.gen++; //the byte in the shift register is dropped too
+        sci.shifting = 0;
+    }
+    if (!regs->SCIFFTX.bit.SCIRST || !regs->SCIFFTX.bit.TXFIFORESET)
+    {
+        sci.tx_count = 0;
+        sci.tx_head = 0;
+    }
+    if (clear)
+    {
+        sci.tx_int = 0;
+    }
+    sci_fifo_update(clear);
+    sci_tx_start();
+}
+
+static void sci_ffrx_written(void)
+{
+    if (regs->SCIFFRX.bit.RXFFOVRCLR)
+    {
+        sci.rx_ovf = 0;
+    }
+    if (!regs->SCIFFRX.bit.RXFIFORESET)
+    {
+        sci.rx_count = 0;
+        sci.rx_head = 0;
+    }
+    sci_sync();
+}
+
+static void sci_access(void *arg, size_t offset, shim_access_t access)
+{
+    size_t reg = SIM_REG(offset);
+
+    if (access == SHIM_REG_READ)
+    {
+        if ((reg == offsetof(struct SCI_REGS, SCIRXBUF)) && (sci.rx_count > 0))
+        {
+            regs->SCIRXBUF.all = sci.rx_fifo[sci.rx_head];
+            sci.rx_head = (sci.rx_head + 1) % SCI_FIFO;
+            sci.rx_count--;
+            sci_sync();
+        }
+        return;
+    }
+
+    if (reg == offsetof(struct SCI_REGS, SCITXBUF))
+    {
+        if (sci.tx_count < SCI_FIFO)
+        {
+            sci.tx_fifo[(sci.tx_head + sci.tx_count) % SCI_FIFO] = (uint8_t)regs->SCITXBUF.all;
+            sci.tx_count++;
+        }
+        sci_fifo_update(0);
+        sci_tx_start();
+    }
+    else if (reg == offsetof(struct SCI_REGS, SCIFFTX))
+    {
+        sci_fftx_written();
+    }
+    else if (reg == offsetof(struct SCI_REGS, SCIFFRX))
+    {
+        sci_ffrx_written();
+    }
+    else if (reg == offsetof(struct SCI_REGS, SCICTL1))
+    {
+        sci_tx_start();
+        sci_sync();
+    }
+    else
+    {
+        sci_sync(); //status bits are read-only
+    }
+}
+
+void sim_sci_init(void (*fxn)(void *arg, uint8_t byte), void *arg)
+{
+    shim_regs_t view = shim_regs_map(sizeof(struct SCI_REGS), sci_access, NULL);
+
+    ScibRegs_host = view.firmware;
+    regs = view.model;
+    sci.fxn = fxn;
+    sci.arg = arg;
+    sci_sync();
+}
@@ -0,0 +1,443 @@
+// Thie file contains the scenario of sim.h: signals from constants or a script, the random source and the report
+// Signals are read with a cursor per signal, virtual time only moves forward.
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+#define SIM_LINE 256
+#define SIM_UART_TEXT 128
+#define SIM_EXPECT_VALUES 8
+
+typedef struct
+{
+    double seconds;
+    double value;
+} sim_point_t;
+
+typedef struct
+{
+    const char *name;
+    sim_point_t *points;
+    size_t count;
+    size_t capacity;
+    size_t cursor;               //last point at or before the time of the previous lookup
+    int scripted;                //the script replaced the default
+} sim_track_t;
+
+typedef struct
+{
+    size_t length;
+    uint8_t data[SIM_UART_TEXT];
+} sim_uart_text_t;
+
+typedef enum
+{
+    SIM_LT,
+    SIM_LE,
+    SIM_EQ,
+    SIM_NE,
+    SIM_GE,
+    SIM_GT
+} sim_op_t;
+
+typedef struct
+{
+    const char *path;
+    unsigned lineno;
+    char name[32];
+    sim_op_t op;
+    double value;
+} sim_expect_t;
+
+sim_stats_t sim_stats;
+
+static sim_track_t tracks[SIM_SIGNALS] = {
+    { "temperature" }, { "humidity" }, { "a5" }, { "a5_noise" }, { "distance" }, { "echo_loss" },
+    { "i2c_nack" }, { "dht20_measure" }, { "i2c_stall" }
+};
+static const double defaults[SIM_SIGNALS] = { 22.0, 45.0, 3200.0, 0.0, 100.0, 0.0, 0.0, 75.0, 0.0 };
+static int defaults_set;
+static uint32_t rng_state = 1;
+
+//what expect lines can check
+static const struct
+{
+    const char *name;
+    const unsigned long *counter;
+} stat_names[] = {
+    { "i2c_transfers", &sim_stats.i2c_transfers }, { "i2c_nacks", &sim_stats.i2c_nacks },
+    { "dht20_measurements", &sim_stats.dht20_measurements }, { "dht20_busy_reads", &sim_stats.dht20_busy_reads },
+    { "dht20_short_triggers", &sim_stats.dht20_short_triggers },
+    { "dht20_register_writes", &sim_stats.dht20_register_writes },
+    { "dht20_uncalibrated_reads", &sim_stats.dht20_uncalibrated_reads }, { "echoes", &sim_stats.echoes },
+    { "echoes_lost", &sim_stats.echoes_lost }, { "ecap_overruns", &sim_stats.ecap_overruns },
+    { "adc_conversions", &sim_stats.adc_conversions }, { "uart_tx_bytes", &sim_stats.uart_tx_bytes },
+    { "uart_rx_bytes", &sim_stats.uart_rx_bytes }, { "uart_rx_overruns", &sim_stats.uart_rx_overruns }
+};
+static struct
+{
+    const char *name;
+    double (*fxn)(void);
+} values[SIM_EXPECT_VALUES];
+static uint16_t value_count;
+static const char *const op_names[] = { "<", "<=", "==", "!=", ">=", ">" };
+static unsigned long expect_checked;
+static unsigned long expect_failures;
+
+static void sim_oom(void)
+{
+    fprintf(stderr, "sim: out of memory\n");
+    exit(2);
+}
+
+static void track_add(sim_track_t *track, double seconds, double value)
+{
+    if (track->count == track->capacity)
+    {
+        track->capacity = (track->capacity != 0) ? 2 * track->capacity : 8;
+        track->points = realloc(track->points, track->capacity * sizeof(sim_point_t));
+        if (track->points == NULL)
+        {
+            sim_oom();
+        }
+    }
+    track->points[track->count].seconds = seconds;
+    track->points[track->count].value = value;
+    track->count++;
+}
+
+static void sim_defaults(void)
+{
+    uint16_t i;
+
+    if (defaults_set)
+    {
+        return;
+    }
+    defaults_set = 1;
+    for (i = 0; i < SIM_SIGNALS; i++)
+    {
+        track_add(&tracks[i], 0.0, defaults[i]);
+    }
+}
+
+void sim_signal_set(sim_signal_t signal, double value)
+{
+    sim_defaults();
+    tracks[signal].count = 0;
+    tracks[signal].cursor = 0;
+    track_add(&tracks[signal], 0.0, value);
+}
+
+double sim_signal(sim_signal_t signal)
+{
+    sim_track_t *track = &tracks[signal];
+    double now = (double)shim_now() / SHIM_CPU_HZ;
+    const sim_point_t *a;
+    const sim_point_t *b;
+
+    sim_defaults();
+    while ((track->cursor + 1 < track->count) && (track->points[track->cursor + 1].seconds <= now))
+    {
+        track->cursor++;
+    }
+    a = &track->points[track->cursor];
+    if ((track->cursor + 1 == track->count) || (now <= a->seconds))
+    {
+        return a->value;
+    }
+    b = a + 1;
+    return a->value + (b->value - a->value) * (now - a->seconds) / (b->seconds - a->seconds);
+}
+
+/* ======== script ======== */
+static void sim_uart_event(void *arg)
+{
+    sim_uart_text_t *text = (sim_uart_text_t *)arg;
+    sim_sci_receive(text->data, text->length);
+}
+
+static void sim_dht20_event(void *arg)
+{
+    sim_dht20_reset();
+}
+
+static int script_uart(double seconds, const char *text)
+{
+    sim_uart_text_t *t = malloc(sizeof(sim_uart_text_t));
+
+    if (t == NULL)
+    {
+        sim_oom();
+    }
+    t->length = 0;
+    while ((*text != '\0') && (*text != '\n'))
+    {
+        if (t->length == SIM_UART_TEXT)
+        {
+            free(t);
+            return -1;
+        }
+        t->data[t->length++] = (uint8_t)*text++;
+    }
+    while ((t->length > 0) && isspace(t->data[t->length - 1]))
+    {
+        t->length--; //trailing blanks
+    }
+    shim_at((uint64_t)(seconds * SHIM_CPU_HZ), 0, sim_uart_event, t);
+    return 0;
+}
+
+void sim_expect_value(const char *name, double (*fxn)(void))
+{
+    if (value_count < SIM_EXPECT_VALUES)
+    {
+        values[value_count].name = name;
+        values[value_count].fxn = fxn;
+        value_count++;
+    }
+}
+
+unsigned long sim_expect_checked(void)
+{
+    return expect_checked;
+}
+
+unsigned long sim_expect_failures(void)
+{
+    return expect_failures;
+}
+
+//value of a name expect lines can check, returns 0 if there is none
+static int expect_lookup(const char *name, double *value)
+{
+    uint16_t i;
+
+    for (i = 0; i < sizeof(stat_names) / sizeof(stat_names[0]); i++)
+    {
+        if (strcmp(name, stat_names[i].name) == 0)
+        {
+            *value = (double)*stat_names[i].counter;
+            return 1;
+        }
+    }
+    for (i = 0; i < value_count; i++)
+    {
+        if (strcmp(name, values[i].name) == 0)
+        {
+            *value = values[i].fxn();
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void sim_expect_event(void *arg)
+{
+    const sim_expect_t *e = (const sim_expect_t *)arg;
+    double v = 0.0;
+    int ok;
+
+    expect_lookup(e->name, &v);
+    switch (e->op)
+    {
+    case SIM_LT:
+        ok = (v < e->value);
+        break;
+
+    case SIM_LE:
+        ok = (v <= e->value);
+        break;
+
+    case SIM_EQ:
+        ok = (v == e->value);
+        break;
+
+    case SIM_NE:
+        ok = (v != e->value);
+        break;
+
+    case SIM_GE:
+        ok = (v >= e->value);
+        break;
+
+    default:
+        ok = (v > e->value);
+        break;
+    }
+    expect_checked++;
+    if (!ok)
+    {
+        printf("FAIL %s:%u at %.3f s: %s is %g, expected %s %g\n", e->path, e->lineno,
+               (double)shim_now() / SHIM_CPU_HZ, e->name, v, op_names[e->op], e->value);
+        expect_failures++;
+    }
+}
+
+static int script_expect(const char *path, unsigned lineno, double seconds, const char *text)
+{
+    sim_expect_t *e = malloc(sizeof(sim_expect_t));
+    char op[4];
+    double v;
+    uint16_t i;
+
+    if (e == NULL)
+    {
+        sim_oom();
+    }
+    if ((sscanf(text, "%31s %3s %lf", e->name, op, &e->value) != 3) || !expect_lookup(e->name, &v))
+    {
+        free(e);
+        return -1;
+    }
+    for (i = 0; (i < sizeof(op_names) / sizeof(op_names[0])) && (strcmp(op, op_names[i]) != 0); i++)
+    {
+    }
+    if (i == sizeof(op_names) / sizeof(op_names[0]))
+    {
+        free(e);
+        return -1;
+    }
+    e->op = (sim_op_t)i;
+    e->path = path;
+    e->lineno = lineno;
+    shim_at((uint64_t)(seconds * SHIM_CPU_HZ), 0, sim_expect_event, e);
+    return 0;
+}
+
+int sim_script_load(const char *path)
+{
+    FILE *in = fopen(path, "r");
+    char line[SIM_LINE];
+    unsigned lineno = 0;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    sim_defaults();
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        char name[32];
+        double seconds;
+        double value;
+        int used = 0;
+        char *comment = strchr(line, '#');
+        sim_track_t *track = NULL;
+        uint16_t i;
+
+        lineno++;
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        if (sscanf(line, " %31s", name) != 1)
+        {
+            continue; //blank or comment line
+        }
+        if (sscanf(line, " %lf %31s %n", &seconds, name, &used) < 2)
+        {
+            fprintf(stderr, "%s:%u: expected \"seconds signal value\"\n", path, lineno);
+            fclose(in);
+            return -1;
+        }
+        if (seconds < 0.0)
+        {
+            fprintf(stderr, "%s:%u: negative time\n", path, lineno);
+            fclose(in);
+            return -1;
+        }
+        if (strcmp(name, "dht20_reset") == 0)
+        {
+            shim_at((uint64_t)(seconds * SHIM_CPU_HZ), 0, sim_dht20_event, NULL);
+            continue;
+        }
+        if (strcmp(name, "expect") == 0)
+        {
+            if (script_expect(path, lineno, seconds, line + used) != 0)
+            {
+                fprintf(stderr, "%s:%u: expected \"seconds expect name op value\" with a known name\n", path, lineno);
+                fclose(in);
+                return -1;
+            }
+            continue;
+        }
+        if (strcmp(name, "uart") == 0)
+        {
+            if (script_uart(seconds, line + used) != 0)
+            {
+                fprintf(stderr, "%s:%u: uart text longer than %d bytes\n", path, lineno, SIM_UART_TEXT);
+                fclose(in);
+                return -1;
+            }
+            continue;
+        }
+        for (i = 0; i < SIM_SIGNALS; i++)
+        {
+            if (strcmp(name, tracks[i].name) == 0)
+            {
+                track = &tracks[i];
+            }
+        }
+        if ((track == NULL) || (sscanf(line + used, "%lf", &value) != 1))
+        {
+            fprintf(stderr, "%s:%u: unknown signal \"%s\" or no value\n", path, lineno, name);
+            fclose(in);
+            return -1;
+        }
+        if (!track->scripted)
+        {
+            track->scripted = 1;
+            track->count = 0; //the script replaces the default
+        }
+        else if (seconds < track->points[track->count - 1].seconds)
+        {
+            fprintf(stderr, "%s:%u: %s goes back in time\n", path, lineno, name);
+            fclose(in);
+            return -1;
+        }
+        track_add(track, seconds, value);
+    }
+    fclose(in);
+    return 0;
+}
+
+/* ======== random ======== */
+void sim_seed(uint32_t seed)
+{
+    rng_state = (seed != 0) ? seed : 1;
+}
+
+//xorshift32, plenty for fault injection and noise
+double sim_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return (double)(rng_state >> 8) / 16777216.0;
+}
+
+int sim_chance(double probability)
+{
+    return (probability > 0.0) && (sim_random() < probability);
+}
+
+/* ======== report ======== */
+void sim_report(FILE *out)
+{
+    fprintf(out, "i2c transfers %lu, nacks %lu\n", sim_stats.i2c_transfers, sim_stats.i2c_nacks);
+    fprintf(out, "dht20 measurements %lu, busy reads %lu, triggers without parameters %lu, calibration writes %lu, "
+            "uncalibrated reads %lu\n", sim_stats.dht20_measurements, sim_stats.dht20_busy_reads,
+            sim_stats.dht20_short_triggers, sim_stats.dht20_register_writes, sim_stats.dht20_uncalibrated_reads);
+    fprintf(out, "echoes %lu, lost %lu, ecap overruns %lu, adc conversions %lu\n", sim_stats.echoes,
+            sim_stats.echoes_lost, sim_stats.ecap_overruns, sim_stats.adc_conversions);
+    fprintf(out, "uart bytes out %lu, in %lu, receive overruns %lu\n", sim_stats.uart_tx_bytes,
+            sim_stats.uart_rx_bytes, sim_stats.uart_rx_overruns);
+    if (expect_checked != 0)
+    {
+        fprintf(out, "expect lines %lu, failed %lu\n", expect_checked, expect_failures);
+    }
+}
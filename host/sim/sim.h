@@ -0,0 +1,107 @@
+/*
+ * sim.h
+ *
+ * Behavioural models of the parts around the board for the host firmware build (firmware_host),
+ * run in the shim's virtual time:
+ *
+ * - i2c_dht20.c: the I2C-B controller (FIFOs, I2CCNT, STOP/ARDY/NACK flags, bus timing from
+ *   I2CPSC/I2CCLKL/I2CCLKH) and the DHT20 behind it: status byte with busy and calibration
+ *   bits, 0xAC trigger and measurement time, calibration registers 0x1B/0x1C/0x1E, CRC.
+ * - hcsr04.c: ePWM2 fires the trigger, the echo width follows the distance and the speed of
+ *   sound at the air temperature, eCAP1 captures it in 4-event delta mode.
+ * - adc_probe.c: the capacitive probe on ADC-A A5, converted on every Timer1 trigger.
+ * - sci_link.c: SCIB at the programmed baud rate, bytes out to a capture, bytes in from the script.
+ *
+ * What the models see of the world comes from the signals below: constants, or piecewise linear
+ * in time from a scenario script (sim_script_load). Everything random draws from one seeded
+ * generator, so a scenario replays the same way every time.
+ *
+ * I2cbRegs and ScibRegs are trapped register blocks (shim_regs_map): the Makefile compiles the
+ * firmware with them redirected through I2cbRegs_host and ScibRegs_host, which the models set.
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include "../shim/shim.h"
+#include <Headers/F2837xD_device.h>
+
+//byte offset of a trapped access -> offset of the register it falls in
+#define SIM_REG(offset) ((offset) - (offset) % sizeof(Uint16))
+#define SIM_CYCLES_MS (SHIM_CPU_HZ / 1000UL)
+
+typedef enum
+{
+    SIM_TEMPERATURE,             //air temperature at the DHT20 and along the echo path, C
+    SIM_HUMIDITY,                //%RH
+    SIM_A5,                      //moisture probe, ADC code
+    SIM_A5_NOISE,                //uniform +- codes added to every conversion
+    SIM_DISTANCE,                //ultrasonic sensor to the water, mm
+    SIM_ECHO_LOSS,               //probability that a ranging gets no echo (38 ms timeout pulse)
+    SIM_I2C_NACK,                //probability that the DHT20 ignores its address
+    SIM_DHT20_MEASURE,           //DHT20 measurement time after 0xAC, ms
+    SIM_I2C_STALL,               //nonzero: the DHT20 holds SCL low, the transfer on the bus stops where it is
+    SIM_SIGNALS
+} sim_signal_t;
+
+//what happened, for the report
+typedef struct
+{
+    unsigned long i2c_transfers;
+    unsigned long i2c_nacks;
+    unsigned long dht20_measurements;
+    unsigned long dht20_busy_reads;      //data read while bit 7 was still set
+    unsigned long dht20_short_triggers;  //0xAC without its 0x33 0x00 parameters
+    unsigned long dht20_register_writes; //0xB0|reg calibration restores
+    unsigned long dht20_uncalibrated_reads; //data read while the calibration registers were lost
+    unsigned long echoes;
+    unsigned long echoes_lost;
+    unsigned long ecap_overruns;         //CEVT4 while the previous interrupt was still flagged
+    unsigned long adc_conversions;
+    unsigned long uart_tx_bytes;
+    unsigned long uart_rx_bytes;
+    unsigned long uart_rx_overruns;
+} sim_stats_t;
+
+extern sim_stats_t sim_stats;
+extern volatile struct I2C_REGS *I2cbRegs_host; //F2837xD_GlobalVariableDefs.c, see above
+extern volatile struct SCI_REGS *ScibRegs_host;
+
+/* ======== scenario (sim.c) ======== */
+//Reads a script of "seconds signal value" lines ('#' starts a comment). Points of one signal are
+//joined by straight lines, held before the first and after the last; two points at the same time
+//make a step. "seconds uart text" sends text to SCIB, "seconds dht20_reset" power cycles the DHT20.
+//"seconds expect name op value" checks a counter of sim_stats or a value from sim_expect_value
+//at that time, op is one of < <= == != >= >; a failed check is printed with its line.
+//Returns 0, or -1 after printing the error.
+int sim_script_load(const char *path);
+//Makes fxn() available to expect lines under name, call before sim_script_load
+void sim_expect_value(const char *name, double (*fxn)(void));
+//Expect lines checked so far and how many of them failed
+unsigned long sim_expect_checked(void);
+unsigned long sim_expect_failures(void);
+//Replaces whatever the signal had with a constant
+void sim_signal_set(sim_signal_t signal, double value);
+//Value at the current virtual time
+double sim_signal(sim_signal_t signal);
+void sim_seed(uint32_t seed);
+//uniform in [0, 1)
+double sim_random(void);
+//true with the given probability
+int sim_chance(double probability);
+void sim_report(FILE *out);
+
+/* ======== models, set up before the firmware's main runs ======== */
+void sim_i2c_init(void);
+//DHT20 power cycle: loses the calibration registers (status without 0x10) until they are written back
+void sim_dht20_reset(void);
+void sim_hcsr04_init(void);
+void sim_adc_init(void);
+//Bytes the firmware sends go to fxn as they leave the shift register (fxn may be NULL)
+void sim_sci_init(void (*fxn)(void *arg, uint8_t byte), void *arg);
+//Queues bytes for the SCIB receiver, one per character time
+void sim_sci_receive(const uint8_t *data, size_t length);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,231 @@
+// Thie file contains a multithreaded host stress test of the snapshot publication (snapshot.h).
+//
+// build: cc -O2 -pthread -o snapshot_stress snapshot_stress.c ../snapshot.c
+// usage: snapshot_stress [seconds [readers]]     defaults 2 s, 3 readers
+//
+// One writer thread publishes records whose fields are all derived from one counter, the
+// reader threads check every record they get for a field that does not match the others
+// (a torn read) and for the publish count going backwards. The same run is repeated with
+// a plain shared struct to show that the check does catch tearing. Reported: publishes,
+// records read, torn reads, and read/publish latency percentiles in ns.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "../snapshot.h"
+
+#define FIELDS 12          //a record about the size of the firmware ones, times two
+#define LATENCY_SAMPLES 4096
+
+typedef struct
+{
+    uint32_t field[FIELDS];
+} record_t;
+
+static snapshot_t snap;
+static record_t copies[2];
+static volatile record_t plain;  //unprotected shared record, for comparison
+static volatile int running;
+static int use_snapshot;
+
+typedef struct
+{
+    unsigned long reads;
+    unsigned long torn;
+    unsigned long backwards;
+    double latency[LATENCY_SAMPLES];
+    unsigned latency_count;
+} reader_result_t;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void make_record(record_t *r, uint32_t n)
+{
+    int i;
+
+    for (i = 0; i < FIELDS; i++)
+    {
+        r->field[i] = n * 2654435761U + (uint32_t)i;
+    }
+}
+
+static int record_torn(const record_t *r)
+{
+    uint32_t n = r->field[0] * 244002641U; //inverse of 2654435761 mod 2^32
+    record_t expected;
+
+    make_record(&expected, n);
+    return memcmp(r, &expected, sizeof(expected)) != 0;
+}
+
+static double publish_latency[LATENCY_SAMPLES];
+static unsigned publish_count;
+
+static void *writer(void *arg)
+{
+    uint32_t n = 0;
+    record_t r;
+
+    (void)arg;
+    publish_count = 0;
+    while (running)
+    {
+        make_record(&r, ++n);
+        if (use_snapshot)
+        {
+            double t0 = now_ns();
+            snapshot_publish(&snap, &r);
+            if ((n & 63) == 0)
+            {
+                publish_latency[publish_count++ % LATENCY_SAMPLES] = now_ns() - t0;
+            }
+        }
+        else
+        {
+            int i;
+            for (i = 0; i < FIELDS; i++)
+            {
+                plain.field[i] = r.field[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+static void *reader(void *arg)
+{
+    reader_result_t *res = arg;
+    uint32_t last = 0;
+    record_t r;
+
+    while (running)
+    {
+        if (use_snapshot)
+        {
+            double t0 = now_ns();
+            uint32_t seq = snapshot_read(&snap, &r);
+            if ((res->reads & 63) == 0)
+            {
+                res->latency[res->latency_count++ % LATENCY_SAMPLES] = now_ns() - t0;
+            }
+            if (seq < last)
+            {
+                res->backwards++;
+            }
+            last = seq;
+        }
+        else
+        {
+            int i;
+            for (i = 0; i < FIELDS; i++)
+            {
+                r.field[i] = plain.field[i];
+            }
+        }
+        res->torn += record_torn(&r);
+        res->reads++;
+    }
+    return NULL;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void percentiles(const char *name, double *v, unsigned n)
+{
+    if (n > LATENCY_SAMPLES)
+    {
+        n = LATENCY_SAMPLES;
+    }
+    if (n == 0)
+    {
+        return;
+    }
+    qsort(v, n, sizeof(double), compare_double);
+    printf("  %-8s latency ns  p50 %7.0f  p99 %7.0f  max %7.0f\n", name, v[n / 2], v[n * 99 / 100], v[n - 1]);
+}
+
+//returns the torn plus out of order reads
+static unsigned long run(int snapshot, double seconds, int readers)
+{
+    pthread_t w;
+    pthread_t r[16];
+    reader_result_t *res = calloc(readers, sizeof(reader_result_t));
+    static double all[16 * LATENCY_SAMPLES];
+    unsigned long reads = 0;
+    unsigned long torn = 0;
+    unsigned long backwards = 0;
+    unsigned total = 0;
+    record_t zero;
+    struct timespec pause;
+    int i;
+
+    use_snapshot = snapshot;
+    memset(&zero, 0, sizeof(zero));
+    snapshot_init(&snap, &copies[0], &copies[1], sizeof(record_t), &zero);
+    memset((void *)&plain, 0, sizeof(plain));
+    running = 1;
+    pthread_create(&w, NULL, writer, NULL);
+    for (i = 0; i < readers; i++)
+    {
+        pthread_create(&r[i], NULL, reader, &res[i]);
+    }
+    pause.tv_sec = (time_t)seconds;
+    pause.tv_nsec = (long)((seconds - (double)pause.tv_sec) * 1e9);
+    nanosleep(&pause, NULL);
+    running = 0;
+    pthread_join(w, NULL);
+    for (i = 0; i < readers; i++)
+    {
+        unsigned j;
+        pthread_join(r[i], NULL);
+        reads += res[i].reads;
+        torn += res[i].torn;
+        backwards += res[i].backwards;
+        for (j = 0; (j < res[i].latency_count) && (j < LATENCY_SAMPLES); j++)
+        {
+            all[total++] = res[i].latency[j];
+        }
+    }
+    printf("%-9s %lu reads, %lu torn, %lu out of order\n", snapshot ? "snapshot" : "plain", reads, torn, backwards);
+    if (snapshot)
+    {
+        printf("  %lu publishes\n", (unsigned long)(snap.seq >> 1));
+        percentiles("read", all, total);
+        percentiles("publish", publish_latency, publish_count);
+    }
+    free(res);
+    return torn + backwards;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = (argc >= 2) ? atof(argv[1]) : 2.0;
+    int readers = (argc >= 3) ? atoi(argv[2]) : 3;
+    unsigned long plain_torn;
+    unsigned long snapshot_errors;
+
+    if ((argc > 3) || (readers < 1) || (readers > 16) || (seconds <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [seconds [readers 1..16]]\n", argv[0]);
+        return 1;
+    }
+    plain_torn = run(0, seconds / 2, readers);
+    snapshot_errors = run(1, seconds, readers);
+    if (plain_torn == 0)
+    {
+        printf("note: the plain record never tore, the run may be too short to trust\n");
+    }
+    return (snapshot_errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+// Thie file contains a host tool that prints the windowed statistics (window_stats.h) and the moisture
+// pipeline outputs (decimator.h) dumped over the UART
+//
+// build: make stats_dump
+// usage: stats_dump [capture.bin]   (reads stdin when no file is given)
+//
+// Send 'S' to the board to get a dump. Telemetry and other dump frames in the same capture are
+// skipped by their sync word or CRC. One CSV line per channel window, in the channel's units,
+// then one per pipeline frame: each stage's ADC code and its water content.
+
+#include <math.h>
+#include <stdio.h>
+#include "../telemetry.h"
+#include "../window_stats.h"
+#include "../decimator.h"
+#include "../sensor_math.h"
+#include "../sample_ring.h"
+
+static const struct
+{
+    const char *name;
+    const char *unit;
+    double scale; //units per sample step
+} channels[SAMPLE_CHANNELS] = {
+    { "temperature", "C", 0.01 },
+    { "humidity", "%RH", 0.01 },
+    { "moisture", "%", 0.01 },
+    { "distance", "mm", 1.0 },
+    { "tank", "mL", 1.0 },
+};
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static double water_content(int32_t code)
+{
+    return (MOISTURE_SLOPE / (VREFHI * code / ADC_FULL_SCALE) - MOISTURE_OFFSET) * 100.0;
+}
+
+static void print_decim(const uint8_t *payload)
+{
+    static const char *const stages[] = { "cic", "fir", "summary" };
+    int32_t codes[5];
+    uint32_t seq[3];
+    int i;
+
+    codes[0] = (int32_t)get_u32(payload + 1);
+    seq[0] = get_u32(payload + 5);
+    codes[1] = (int32_t)get_u32(payload + 9);
+    seq[1] = get_u32(payload + 13);
+    codes[2] = (int32_t)get_u32(payload + 17); //mean
+    codes[3] = (int32_t)get_u32(payload + 21);
+    codes[4] = (int32_t)get_u32(payload + 25);
+    seq[2] = get_u32(payload + 29);
+    for (i = 0; i < 3; i++)
+    {
+        printf("%s,%lu,%ld,%.2f", stages[i], (unsigned long)seq[i], (long)codes[i],
+               (seq[i] != 0) ? water_content(codes[i]) : 0.0);
+        if (i == 2)
+        {
+            //the driest minute has the highest code
+            printf(",%ld,%ld,%.2f,%.2f", (long)codes[3], (long)codes[4], (seq[2] != 0) ? water_content(codes[4]) : 0.0,
+                   (seq[2] != 0) ? water_content(codes[3]) : 0.0);
+        }
+        printf("\n");
+    }
+}
+
+static void print_stats(const uint8_t *payload)
+{
+    uint16_t channel = payload[0];
+    uint16_t count = payload[1] | (payload[2] << 8);
+    double scale = (channel < SAMPLE_CHANNELS) ? channels[channel].scale : 1.0;
+    uint64_t variance = get_u32(payload + 25) | ((uint64_t)get_u32(payload + 29) << 32);
+
+    printf("%s,%u,%u,%lu,", (channel < SAMPLE_CHANNELS) ? channels[channel].name : "?", count,
+           payload[3] | (payload[4] << 8), (unsigned long)get_u32(payload + 5));
+    printf("%.2f,%.2f,%.2f,%.2f,%.3f,%s\n", (int32_t)get_u32(payload + 9) * scale,
+           (int32_t)get_u32(payload + 13) * scale, (int32_t)get_u32(payload + 17) * scale,
+           (int32_t)get_u32(payload + 21) * scale, sqrt((double)variance) * scale,
+           (channel < SAMPLE_CHANNELS) ? channels[channel].unit : "");
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in = stdin;
+    uint8_t buf[WINDOW_STATS_FRAME_SIZE > DECIM_FRAME_SIZE ? WINDOW_STATS_FRAME_SIZE : DECIM_FRAME_SIZE];
+    size_t fill = 0;
+    size_t size = 0;
+    unsigned long frames = 0;
+    unsigned long decim_frames = 0;
+    unsigned long bad = 0;
+    int c;
+
+    if (argc > 1)
+    {
+        in = fopen(argv[1], "rb");
+        if (in == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    printf("channel,count,window,pushed,mean,min,max,median,stddev,unit\n");
+    while ((c = fgetc(in)) != EOF)
+    {
+        buf[fill++] = (uint8_t)c;
+        if ((fill == 1) && (buf[0] != WINDOW_STATS_SYNC0))
+        {
+            fill = 0;
+        }
+        else if (fill == 2)
+        {
+            size = (buf[1] == WINDOW_STATS_SYNC1) ? WINDOW_STATS_FRAME_SIZE
+                 : (buf[1] == DECIM_SYNC1) ? DECIM_FRAME_SIZE : 0; //both headers start with 0xA5
+            if (size == 0)
+            {
+                fill = (buf[1] == WINDOW_STATS_SYNC0) ? 1 : 0;
+                buf[0] = buf[1];
+            }
+        }
+        else if ((fill == 4) && ((buf[2] != ((buf[1] == DECIM_SYNC1) ? DECIM_VERSION : WINDOW_STATS_VERSION)) ||
+                                 (buf[3] + WINDOW_STATS_HEADER_SIZE + WINDOW_STATS_CRC_SIZE != size)))
+        {
+            fill = 0;
+        }
+        else if ((fill > 4) && (fill == size))
+        {
+            uint16_t crc = buf[fill - 2] | (buf[fill - 1] << 8);
+            if (crc != telemetry_crc16(buf + 2, (uint16_t)(fill - 2 - WINDOW_STATS_CRC_SIZE)))
+            {
+                bad++;
+            }
+            else if (buf[1] == WINDOW_STATS_SYNC1)
+            {
+                print_stats(buf + WINDOW_STATS_HEADER_SIZE);
+                frames++;
+            }
+            else
+            {
+                if (decim_frames++ == 0)
+                {
+                    printf("\nstage,seq,code,water_content,min_code,max_code,min_water_content,max_water_content\n");
+                }
+                print_decim(buf + DECIM_HEADER_SIZE);
+            }
+            fill = 0;
+        }
+    }
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    if (bad != 0)
+    {
+        fprintf(stderr, "%lu statistics and pipeline frames with a bad CRC\n", bad);
+    }
+    return ((frames + decim_frames) != 0) ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+// Thie file contains a host check and benchmark of the tank volume table (tank_model.h).
+//
+// build: cc -O2 -o tank_model_bench tank_model_bench.c ../tank_model.c ../sensor_math.c ../moisture_lut.c -lm
+//        add -DTANK_SHAPE=1 (box) or -DTANK_SHAPE=2 (profile), -DTANK_STEP_LOG2=n, -DSENSOR_MATH_FIXED=1
+//        to check the other configurations.
+// usage: tank_model_bench
+//
+// Sweeps the distance from 0 to past the tank floor in 0.1 mm steps and compares the table
+// against the geometry evaluated in double: worst error in mL, monotonicity, and the
+// volume/pump seconds at the reserve. Then times both per conversion.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "../sensor_math.h"
+#include "../tank_model.h"
+
+#define SWEEP_STEPS ((TANK_DEPTH_MM + 20) * 10)
+#define TIMING_PASSES 200
+
+static volatile double sink; //keeps the timed loops from being optimised out
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#if TANK_SHAPE == TANK_SHAPE_TABLE
+//same points as tank_profile[] in tank_model.c
+static const double profile[][2] = {
+    { 20, 6000 }, { 43, 5000 }, { 67, 4000 }, { 92, 3000 }, { 118, 2000 }, { 145, 1000 }, { TANK_DEPTH_MM, 0 },
+};
+#define PROFILE_POINTS (sizeof(profile) / sizeof(profile[0]))
+#endif
+
+//reference volume in mL at distance_mm, what the firmware would compute per sample without the table
+static double reference_ml(double distance_mm)
+{
+#if TANK_SHAPE == TANK_SHAPE_TABLE
+    unsigned i;
+
+    if (distance_mm <= profile[0][0])
+    {
+        return profile[0][1];
+    }
+    for (i = 1; i < PROFILE_POINTS; i++)
+    {
+        if (distance_mm < profile[i][0])
+        {
+            double t = (distance_mm - profile[i - 1][0]) / (profile[i][0] - profile[i - 1][0]);
+            return profile[i - 1][1] - t * (profile[i - 1][1] - profile[i][1]);
+        }
+    }
+    return 0.0;
+#else
+#if TANK_SHAPE == TANK_SHAPE_CYLINDER
+    double area = 3.14159265358979 * TANK_DIAMETER_MM * TANK_DIAMETER_MM / 4.0;
+#else
+    double area = (double)TANK_LENGTH_MM * TANK_WIDTH_MM;
+#endif
+    if (distance_mm >= TANK_DEPTH_MM)
+    {
+        return 0.0;
+    }
+    if (distance_mm < 0.0)
+    {
+        distance_mm = 0.0;
+    }
+    return area * (TANK_DEPTH_MM - distance_mm) / 1000.0;
+#endif
+}
+
+int main(void)
+{
+    static sensor_t cm[SWEEP_STEPS];
+    static double cm_ref[SWEEP_STEPS];
+    double worst = 0.0;
+    double worst_at = 0.0;
+    uint32_t previous = 0xFFFFFFFFUL;
+    unsigned long non_monotonic = 0;
+    unsigned long i;
+    unsigned long pass;
+    double t0;
+    double t_table;
+    double t_ref;
+
+    tank_model_init();
+    for (i = 0; i < SWEEP_STEPS; i++)
+    {
+        cm_ref[i] = i / 100.0;
+        cm[i] = SENSOR(cm_ref[i]);
+    }
+
+    for (i = 0; i < SWEEP_STEPS; i++)
+    {
+        uint32_t ml = tank_volume_ml(cm[i]);
+        //the firmware truncates to whole mm first (about 31 mL in the default cylinder), compare the
+        //table against the geometry at that same mm so only the interpolation error is left
+        double e = fabs(ml - reference_ml(sensor_to_units(cm[i], 10, 0, TANK_DEPTH_MM)));
+
+        if (e > worst)
+        {
+            worst = e;
+            worst_at = cm_ref[i];
+        }
+        if (ml > previous)
+        {
+            non_monotonic++;
+        }
+        previous = ml;
+    }
+
+    t0 = now_ns();
+    for (pass = 0; pass < TIMING_PASSES; pass++)
+    {
+        for (i = 0; i < SWEEP_STEPS; i++)
+        {
+            sink = tank_volume_ml(cm[i]);
+        }
+    }
+    t_table = (now_ns() - t0) / ((double)SWEEP_STEPS * TIMING_PASSES);
+    t0 = now_ns();
+    for (pass = 0; pass < TIMING_PASSES; pass++)
+    {
+        for (i = 0; i < SWEEP_STEPS; i++)
+        {
+            sink = reference_ml(cm_ref[i] * 10.0);
+        }
+    }
+    t_ref = (now_ns() - t0) / ((double)SWEEP_STEPS * TIMING_PASSES);
+
+    printf("shape %d, depth %d mm, step %lu mm, %d entries\n", TANK_SHAPE, TANK_DEPTH_MM, 1UL << TANK_STEP_LOG2, TANK_TABLE_SIZE);
+    printf("full          %10lu mL\n", (unsigned long)tank_volume_ml(SENSOR(0)));
+    printf("worst error   %10.1f mL at %.2f cm\n", worst, worst_at);
+    printf("non-monotonic %10lu\n", non_monotonic);
+    printf("reserve       %10d mL, pump time when full %lu s\n", TANK_RESERVE_ML,
+           (unsigned long)tank_pump_seconds(tank_volume_ml(SENSOR(0))));
+    printf("table         %10.2f ns/conversion\n", t_table);
+    printf("geometry      %10.2f ns/conversion (double)\n", t_ref);
+    return (non_monotonic == 0) ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+// Thie file contains the host side decoder for the binary telemetry frame (see telemetry.h)
+
+#include <string.h>
+#include "telemetry_decode.h"
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+telemetry_result_t telemetry_decode(const uint8_t *frame, size_t length, telemetry_sample_t *out)
+{
+    const uint8_t *p = frame + TELEMETRY_HEADER_SIZE;
+    uint16_t crc;
+
+    if (length < TELEMETRY_FRAME_SIZE)
+    {
+        return TELEMETRY_ERR_SHORT;
+    }
+    if ((frame[0] != TELEMETRY_SYNC0) || (frame[1] != TELEMETRY_SYNC1))
+    {
+        return TELEMETRY_ERR_SYNC;
+    }
+    if ((frame[2] != TELEMETRY_VERSION) || (frame[3] != TELEMETRY_PAYLOAD_SIZE))
+    {
+        return TELEMETRY_ERR_VERSION;
+    }
+    crc = telemetry_crc16(frame + 2, TELEMETRY_HEADER_SIZE - 2 + TELEMETRY_PAYLOAD_SIZE);
+    if (crc != get_u16(frame + TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_SIZE))
+    {
+        return TELEMETRY_ERR_CRC;
+    }
+
+    out->seq = get_u16(p);
+    out->time_ms = get_u32(p + 2);
+    out->temperature_centi = (int16_t)get_u16(p + 6);
+    out->humidity_centi = get_u16(p + 8);
+    out->moisture_centi = (int16_t)get_u16(p + 10);
+    out->water_level_mm = get_u16(p + 12);
+    out->flags = p[14];
+    return TELEMETRY_OK;
+}
+
+void telemetry_decoder_init(telemetry_decoder_t *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+}
+
+int telemetry_decoder_push(telemetry_decoder_t *dec, uint8_t byte, telemetry_sample_t *out)
+{
+    dec->buf[dec->fill++] = byte;
+
+    //hunt for the sync word
+    if ((dec->fill == 1) && (byte != TELEMETRY_SYNC0))
+    {
+        dec->fill = 0;
+        return 0;
+    }
+    if ((dec->fill == 2) && (byte != TELEMETRY_SYNC1))
+    {
+        dec->fill = (byte == TELEMETRY_SYNC0) ? 1 : 0;
+        return 0;
+    }
+    if (dec->fill < TELEMETRY_FRAME_SIZE)
+    {
+        return 0;
+    }
+
+    if (telemetry_decode(dec->buf, dec->fill, out) == TELEMETRY_OK)
+    {
+        dec->fill = 0;
+        dec->frames++;
+        return 1;
+    }
+
+    //bad frame: restart the hunt one byte past the false sync
+    dec->crc_errors++;
+    {
+        size_t i;
+        size_t start = dec->fill;
+        for (i = 1; i < dec->fill; i++)
+        {
+            if (dec->buf[i] == TELEMETRY_SYNC0)
+            {
+                start = i;
+                break;
+            }
+        }
+        memmove(dec->buf, dec->buf + start, dec->fill - start);
+        dec->fill -= start;
+    }
+    return 0;
+}
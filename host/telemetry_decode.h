@@ -0,0 +1,40 @@
+/*
+ * telemetry_decode.h
+ *
+ * Host/ESP32 side decoder for the frames produced by telemetry_encode().
+ * Build together with ../telemetry.c, which provides the shared CRC.
+ */
+
+#ifndef TELEMETRY_DECODE_H_
+#define TELEMETRY_DECODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../telemetry.h"
+
+typedef enum
+{
+    TELEMETRY_OK = 0,
+    TELEMETRY_ERR_SHORT,    //fewer than TELEMETRY_FRAME_SIZE bytes
+    TELEMETRY_ERR_SYNC,     //no sync word at the start
+    TELEMETRY_ERR_VERSION,  //unknown version or payload length
+    TELEMETRY_ERR_CRC       //checksum mismatch
+} telemetry_result_t;
+
+//byte-at-a-time decoder for a serial stream, resynchronises on the sync word
+typedef struct
+{
+    uint8_t buf[TELEMETRY_FRAME_SIZE];
+    size_t fill;
+    unsigned long frames;     //good frames
+    unsigned long crc_errors; //frames dropped on CRC or header mismatch
+} telemetry_decoder_t;
+
+//Decodes one frame starting at frame[0].
+telemetry_result_t telemetry_decode(const uint8_t *frame, size_t length, telemetry_sample_t *out);
+
+void telemetry_decoder_init(telemetry_decoder_t *dec);
+//Feeds one received byte, returns 1 and fills out when a valid frame completes.
+int telemetry_decoder_push(telemetry_decoder_t *dec, uint8_t byte, telemetry_sample_t *out);
+
+#endif /* TELEMETRY_DECODE_H_ */
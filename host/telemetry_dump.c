@@ -0,0 +1,48 @@
+// Thie file contains a host tool that prints telemetry frames captured from the ESP32 UART as CSV
+//
+// build: cc -O2 -o telemetry_dump telemetry_dump.c telemetry_decode.c ../telemetry.c
+// usage: telemetry_dump [capture.bin]   (reads stdin when no file is given)
+
+#include <stdio.h>
+#include "telemetry_decode.h"
+
+int main(int argc, char **argv)
+{
+    FILE *in = stdin;
+    telemetry_decoder_t dec;
+    telemetry_sample_t s;
+    unsigned long bytes = 0;
+    int c;
+
+    if (argc > 1)
+    {
+        in = fopen(argv[1], "rb");
+        if (in == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    telemetry_decoder_init(&dec);
+    printf("seq,time_ms,temperature_c,humidity_pct,moisture_pct,water_level_cm,pump_on,tank_low,stale\n");
+    while ((c = fgetc(in)) != EOF)
+    {
+        bytes++;
+        if (telemetry_decoder_push(&dec, (uint8_t)c, &s))
+        {
+            printf("%u,%lu,%.2f,%.2f,%.2f,%.1f,%d,%d,%d\n", s.seq, (unsigned long)s.time_ms,
+                   s.temperature_centi / 100.0, s.humidity_centi / 100.0, s.moisture_centi / 100.0,
+                   s.water_level_mm / 10.0, (s.flags & TELEMETRY_FLAG_PUMP_ON) != 0,
+                   (s.flags & TELEMETRY_FLAG_TANK_LOW) != 0, (s.flags & TELEMETRY_FLAG_STALE) != 0);
+        }
+    }
+    fprintf(stderr, "%lu bytes, %lu frames (%d bytes each), %lu bad frames\n",
+            bytes, dec.frames, TELEMETRY_FRAME_SIZE, dec.crc_errors);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    return 0;
+}
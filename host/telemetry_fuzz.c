@@ -0,0 +1,309 @@
+// Thie file contains a randomized round-trip test of the telemetry frame (telemetry.h, telemetry_decode.h)
+//
+// build: make telemetry_fuzz
+// usage: telemetry_fuzz [frames [seed]]     defaults 200000 frames, seed 1
+//
+// Every frame carries random field values and goes through four checks:
+//   round trip  telemetry_decode gives back exactly what telemetry_encode was given
+//   bit errors  1 to 3 flipped bits anywhere after the sync word must be rejected; the CRC
+//               distance is 4 at this length, so this is a guarantee and not a probability
+//   bursts      one burst of up to 16 bits, also always caught by a 16-bit CRC
+//   stream      the frames go through telemetry_decoder_push with random bytes in between
+//               and one frame in four corrupted; every good frame must come out, in order,
+//               and nothing else
+// Any failure is printed and the exit status is 1. Random byte garbage that passes the CRC
+// (about 1 in 65536) is counted, not failed: that is what a 16-bit check is.
+//
+// Then the cost against the text line it replaced, sprintf("Temp: %.3f Hum: %.3f\n"), on this
+// PC: bytes on the wire and ns per frame. The text line carries two of the seven fields.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "telemetry_decode.h"
+
+#define DEFAULT_FRAMES 200000L
+#define TIMING_FRAMES 200000L
+#define GARBAGE_MAX 8            //random bytes between stream frames
+
+static uint32_t rng_state;
+static unsigned long failures;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void random_sample(telemetry_sample_t *s, uint16_t seq)
+{
+    s->seq = seq;
+    s->time_ms = rng();
+    s->temperature_centi = (int16_t)rng();
+    s->humidity_centi = (uint16_t)rng();
+    s->moisture_centi = (int16_t)rng();
+    s->water_level_mm = (uint16_t)rng();
+    s->flags = (uint16_t)(rng() & 0xFF); //one octet on the wire
+}
+
+static int same_sample(const telemetry_sample_t *a, const telemetry_sample_t *b)
+{
+    return (a->seq == b->seq) && (a->time_ms == b->time_ms) && (a->temperature_centi == b->temperature_centi) &&
+           (a->humidity_centi == b->humidity_centi) && (a->moisture_centi == b->moisture_centi) &&
+           (a->water_level_mm == b->water_level_mm) && (a->flags == b->flags);
+}
+
+static void fail(const char *what, long frame)
+{
+    if (failures++ < 10)
+    {
+        printf("FAIL frame %ld: %s\n", frame, what);
+    }
+}
+
+//flips bits distinct bits after the sync word
+static void flip_bits(uint8_t *frame, int bits)
+{
+    int done[3];
+    int i;
+    int j;
+
+    for (i = 0; i < bits; i++)
+    {
+        int bit;
+        do
+        {
+            bit = 16 + (int)(rng() % ((TELEMETRY_FRAME_SIZE - 2) * 8));
+            for (j = 0; (j < i) && (done[j] != bit); j++)
+            {
+            }
+        } while (j < i);
+        done[i] = bit;
+        frame[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+    }
+}
+
+//a burst of length 1..16 bits with both ends flipped, after the sync word
+static void burst(uint8_t *frame)
+{
+    int length = 1 + (int)(rng() % 16);
+    int first = 16 + (int)(rng() % ((TELEMETRY_FRAME_SIZE - 2) * 8 - length + 1));
+    uint32_t pattern = (rng() | 1U | (1U << (length - 1))) & ((1U << length) - 1U);
+    int i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (pattern & (1U << i))
+        {
+            frame[(first + i) / 8] ^= (uint8_t)(1U << ((first + i) % 8));
+        }
+    }
+}
+
+static void check_frames(long frames)
+{
+    unsigned char encoded[TELEMETRY_FRAME_SIZE];
+    uint8_t frame[TELEMETRY_FRAME_SIZE];
+    telemetry_sample_t in;
+    telemetry_sample_t out;
+    unsigned long garbage_passed = 0;
+    long n;
+    int i;
+
+    for (n = 0; n < frames; n++)
+    {
+        random_sample(&in, (uint16_t)n);
+        if (telemetry_encode(encoded, &in) != TELEMETRY_FRAME_SIZE)
+        {
+            fail("encoded length", n);
+        }
+        for (i = 0; i < TELEMETRY_FRAME_SIZE; i++)
+        {
+            frame[i] = encoded[i] & 0xFF;
+        }
+        if ((telemetry_decode(frame, sizeof(frame), &out) != TELEMETRY_OK) || !same_sample(&in, &out))
+        {
+            fail("round trip", n);
+        }
+        if (telemetry_decode(frame, sizeof(frame) - 1, &out) != TELEMETRY_ERR_SHORT)
+        {
+            fail("short frame accepted", n);
+        }
+
+        for (i = 1; i <= 3; i++)
+        {
+            uint8_t bad[TELEMETRY_FRAME_SIZE];
+            memcpy(bad, frame, sizeof(bad));
+            flip_bits(bad, i);
+            if (telemetry_decode(bad, sizeof(bad), &out) == TELEMETRY_OK)
+            {
+                fail("bit errors accepted", n);
+            }
+        }
+        {
+            uint8_t bad[TELEMETRY_FRAME_SIZE];
+            memcpy(bad, frame, sizeof(bad));
+            burst(bad);
+            if (telemetry_decode(bad, sizeof(bad), &out) == TELEMETRY_OK)
+            {
+                fail("burst accepted", n);
+            }
+            memcpy(bad, frame, sizeof(bad));
+            for (i = TELEMETRY_HEADER_SIZE; i < TELEMETRY_FRAME_SIZE; i++)
+            {
+                bad[i] = (uint8_t)rng();
+            }
+            if (telemetry_decode(bad, sizeof(bad), &out) == TELEMETRY_OK)
+            {
+                garbage_passed++;
+            }
+            memcpy(bad, frame, sizeof(bad));
+            bad[rng() % 2] ^= (uint8_t)(1U << (rng() % 8));
+            if (telemetry_decode(bad, sizeof(bad), &out) != TELEMETRY_ERR_SYNC)
+            {
+                fail("broken sync word not reported", n);
+            }
+        }
+    }
+    printf("frames: %ld round trips, %ld each with 1, 2, 3 bit errors and a burst, random payloads passing the CRC"
+           " %lu (expected %.1f)\n", frames, frames, garbage_passed, frames / 65536.0);
+}
+
+static void check_stream(long frames)
+{
+    telemetry_decoder_t dec;
+    telemetry_sample_t sent;
+    telemetry_sample_t out;
+    uint16_t expected_seq = 0;
+    unsigned long good = 0;
+    unsigned long received = 0;
+    unsigned long corrupted = 0;
+    long n;
+
+    telemetry_decoder_init(&dec);
+    for (n = 0; n < frames; n++)
+    {
+        unsigned char encoded[TELEMETRY_FRAME_SIZE];
+        uint8_t frame[TELEMETRY_FRAME_SIZE];
+        int garbage = (int)(rng() % (GARBAGE_MAX + 1));
+        int damaged = (rng() % 4) == 0;
+        int i;
+
+        random_sample(&sent, (uint16_t)n);
+        telemetry_encode(encoded, &sent);
+        for (i = 0; i < TELEMETRY_FRAME_SIZE; i++)
+        {
+            frame[i] = encoded[i] & 0xFF;
+        }
+        if (damaged)
+        {
+            flip_bits(frame, 1 + (int)(rng() % 3));
+            corrupted++;
+        }
+        else
+        {
+            good++;
+        }
+        for (i = 0; i < garbage; i++)
+        {
+            uint8_t byte = (uint8_t)rng();
+            if (telemetry_decoder_push(&dec, byte, &out))
+            {
+                fail("frame out of garbage", n);
+            }
+        }
+        for (i = 0; i < TELEMETRY_FRAME_SIZE; i++)
+        {
+            if (!telemetry_decoder_push(&dec, frame[i], &out))
+            {
+                continue;
+            }
+            received++;
+            if (damaged || (i != TELEMETRY_FRAME_SIZE - 1))
+            {
+                fail("corrupted or misaligned frame out of the stream", n);
+            }
+            else if (!same_sample(&sent, &out))
+            {
+                fail("stream frame differs", n);
+            }
+            else if ((uint16_t)(out.seq - expected_seq) > 0x7FFF)
+            {
+                fail("stream frame out of order", n);
+            }
+            expected_seq = (uint16_t)(out.seq + 1);
+        }
+    }
+    printf("stream: %lu good and %lu corrupted frames sent, %lu received, decoder counted %lu frames and %lu errors\n",
+           good, corrupted, received, dec.frames, dec.crc_errors);
+    if (received != good)
+    {
+        fail("good frames lost in the stream", n);
+    }
+}
+
+static void compare_text(void)
+{
+    unsigned char frame[TELEMETRY_FRAME_SIZE];
+    char text[50];
+    telemetry_sample_t s;
+    volatile unsigned long sink = 0;
+    double t0;
+    double binary_ns;
+    double text_ns;
+    long text_bytes = 0;
+    long n;
+
+    random_sample(&s, 0);
+    t0 = now_ns();
+    for (n = 0; n < TIMING_FRAMES; n++)
+    {
+        s.seq = (uint16_t)n;
+        s.temperature_centi = (int16_t)(2000 + (n & 1023));
+        sink += telemetry_encode(frame, &s) + frame[TELEMETRY_FRAME_SIZE - 1];
+    }
+    binary_ns = (now_ns() - t0) / TIMING_FRAMES;
+    t0 = now_ns();
+    for (n = 0; n < TIMING_FRAMES; n++)
+    {
+        float temperature = 20.0f + (n & 1023) * 0.01f;
+        float humidity = 45.0f + (n & 511) * 0.01f;
+        text_bytes += sprintf(text, "Temp: %.3f Hum: %.3f\n", temperature, humidity);
+        sink += (unsigned long)text[6];
+    }
+    text_ns = (now_ns() - t0) / TIMING_FRAMES;
+    printf("binary frame: %d bytes, %.1f ns per frame, 7 fields\n", TELEMETRY_FRAME_SIZE, binary_ns);
+    printf("sprintf text: %.1f bytes, %.1f ns per frame, 2 fields (%.1fx the time)\n",
+           (double)text_bytes / TIMING_FRAMES, text_ns, text_ns / binary_ns);
+}
+
+int main(int argc, char **argv)
+{
+    long frames = (argc >= 2) ? strtol(argv[1], NULL, 0) : DEFAULT_FRAMES;
+
+    rng_state = (argc >= 3) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+    if ((argc > 3) || (frames < 1) || (rng_state == 0))
+    {
+        fprintf(stderr, "usage: %s [frames [seed (not 0)]]\n", argv[0]);
+        return 2;
+    }
+    check_frames(frames);
+    check_stream(frames);
+    compare_text();
+    if (failures != 0)
+    {
+        printf("%lu failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
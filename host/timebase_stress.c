@@ -0,0 +1,237 @@
+// Thie file contains the host checks and a multithreaded wrap-around stress test of the 64-bit timebase (timebase.h).
+//
+// build: cc -O2 -pthread -o timebase_stress timebase_stress.c ../timebase.c
+// usage: timebase_stress [seconds [readers]]     defaults 2 s, 3 readers
+//
+// Checks, each printed ok/FAIL (non-zero exit on any failure):
+//   wrap       single reader across many wraps, including a reading of exactly the previous count
+//   convert    count to us/ms at 200 MHz and at an odd rate, up to the full 64-bit range
+//   threads    a ticker thread advances a simulated 32-bit counter by up to a quarter of its
+//              range per step (a wrap every few steps) and extends it after every step, as the
+//              Clock tick does in the firmware. Reader threads extend it too and check every
+//              result lies between the true 64-bit time before and after the call and never
+//              goes backwards
+// The threads run is repeated with the counter read before taking the lock, which the check
+// must catch. Then times one extension.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../timebase.h"
+
+timebase_t timebase;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER; //stands in for Hwi_disable
+static volatile uint64_t true_time; //simulated counter before truncation, written by the ticker only
+static volatile int running;
+static int read_first;              //1 = read the counter before the lock, the ordering bug
+static int failures = 0;
+
+typedef struct
+{
+    unsigned long reads;
+    unsigned long outside; //result not between the true time before and after
+    unsigned long backwards;
+} reader_result_t;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void result(const char *name, int ok)
+{
+    failures |= !ok;
+    printf("%-10s %s\n", name, ok ? "ok" : "FAIL");
+}
+
+static uint32_t counter(void)
+{
+    return (uint32_t)true_time;
+}
+
+//host version of the firmware timebase_now()
+uint64_t timebase_now(void)
+{
+    uint64_t now;
+
+    if (read_first)
+    {
+        uint32_t c = counter();
+        sched_yield(); //preempted between the read and the lock
+        pthread_mutex_lock(&lock);
+        now = timebase_extend(&timebase, c);
+    }
+    else
+    {
+        pthread_mutex_lock(&lock);
+        now = timebase_extend(&timebase, counter());
+    }
+    pthread_mutex_unlock(&lock);
+    return now;
+}
+
+static void check_wrap(void)
+{
+    uint64_t t = 0xFFFFF000ULL;
+    uint32_t step = 0x40000000UL;
+    int ok = 1;
+    int i;
+
+    timebase_init(&timebase, 200000000UL, (uint32_t)t);
+    ok &= timebase_extend(&timebase, (uint32_t)t) == t; //same count again is not a wrap
+    for (i = 0; i < 1000; i++)
+    {
+        t += step + (uint32_t)i * 7919U;
+        ok &= timebase_extend(&timebase, (uint32_t)t) == t;
+    }
+    ok &= timebase.high == (uint32_t)(t >> 32);
+    result("wrap", ok);
+}
+
+static int scale_matches(uint64_t got, uint64_t counts, uint32_t freq, uint32_t per_second)
+{
+    //reference in 128 bits
+    unsigned __int128 expected = (unsigned __int128)counts * per_second / freq;
+    return got == (uint64_t)expected;
+}
+
+static void check_convert(void)
+{
+    static const uint32_t freqs[2] = { 200000000UL, 32768UL + 13UL };
+    timebase_t tb;
+    int ok = 1;
+    int f;
+    int i;
+
+    timebase_init(&tb, 200000000UL, 0);
+    ok &= (timebase_to_us(&tb, 200) == 1) && (timebase_to_ms(&tb, 199999) == 0) && (timebase_to_ms(&tb, 200000) == 1);
+    ok &= timebase_from_ms(&tb, 30000) == 6000000000ULL;
+    for (f = 0; f < 2; f++)
+    {
+        timebase_init(&tb, freqs[f], 0);
+        for (i = 0; i < 64; i++)
+        {
+            uint64_t counts[2] = { 1ULL << i, UINT64_MAX >> i };
+            int k;
+            for (k = 0; k < 2; k++)
+            {
+                ok &= scale_matches(timebase_to_us(&tb, counts[k]), counts[k], freqs[f], 1000000UL);
+                ok &= scale_matches(timebase_to_ms(&tb, counts[k]), counts[k], freqs[f], 1000UL);
+            }
+        }
+    }
+    result("convert", ok);
+}
+
+static void *ticker(void *arg)
+{
+    uint32_t x = 12345;
+
+    (void)arg;
+    while (running)
+    {
+        x = x * 1664525U + 1013904223U;
+        true_time += (x >> 2) | 1; //under a quarter of the counter range
+        timebase_now();            //the 1 ms Clock tick
+        sched_yield();
+    }
+    return NULL;
+}
+
+static void *reader(void *arg)
+{
+    reader_result_t *res = arg;
+    uint64_t last = 0;
+
+    while (running)
+    {
+        uint64_t before = true_time;
+        uint64_t now = timebase_now();
+        uint64_t after = true_time;
+
+        if ((now < before) || (now > after))
+        {
+            res->outside++;
+        }
+        if (now < last)
+        {
+            res->backwards++;
+        }
+        last = now;
+        res->reads++;
+    }
+    return NULL;
+}
+
+//returns the readings that were wrong
+static unsigned long run_threads(int bug, double seconds, int readers)
+{
+    pthread_t t;
+    pthread_t r[16];
+    reader_result_t res[16] = { { 0, 0, 0 } };
+    unsigned long reads = 0;
+    unsigned long outside = 0;
+    unsigned long backwards = 0;
+    struct timespec pause;
+    int i;
+
+    read_first = bug;
+    true_time = 0xFFFF0000ULL;
+    timebase_init(&timebase, 200000000UL, counter());
+    running = 1;
+    pthread_create(&t, NULL, ticker, NULL);
+    for (i = 0; i < readers; i++)
+    {
+        pthread_create(&r[i], NULL, reader, &res[i]);
+    }
+    pause.tv_sec = (time_t)seconds;
+    pause.tv_nsec = (long)((seconds - (double)pause.tv_sec) * 1e9);
+    nanosleep(&pause, NULL);
+    running = 0;
+    pthread_join(t, NULL);
+    for (i = 0; i < readers; i++)
+    {
+        pthread_join(r[i], NULL);
+        reads += res[i].reads;
+        outside += res[i].outside;
+        backwards += res[i].backwards;
+    }
+    printf("           %s: %lu wraps, %lu reads, %lu outside, %lu backwards\n",
+           bug ? "read before lock" : "read under lock", (unsigned long)(true_time >> 32), reads, outside, backwards);
+    return outside + backwards;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = (argc >= 2) ? atof(argv[1]) : 2.0;
+    int readers = (argc >= 3) ? atoi(argv[2]) : 3;
+    volatile uint64_t sink = 0;
+    uint32_t n;
+    double t0;
+
+    if ((argc > 3) || (readers < 1) || (readers > 16) || (seconds <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [seconds [readers 1..16]]\n", argv[0]);
+        return 1;
+    }
+    check_wrap();
+    check_convert();
+    result("threads", run_threads(0, seconds, readers) == 0);
+    if (run_threads(1, seconds / 2, readers) == 0)
+    {
+        printf("note: reading before the lock never failed, the run may be too short to trust\n");
+    }
+
+    timebase_init(&timebase, 200000000UL, 0);
+    t0 = now_ns();
+    for (n = 0; n < 100000000UL; n++)
+    {
+        sink += timebase_extend(&timebase, n * 97U);
+    }
+    printf("extend     %.2f ns\n", (now_ns() - t0) / 100000000.0);
+    return failures;
+}
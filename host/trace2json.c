@@ -0,0 +1,306 @@
+// Thie file contains a host tool that converts an event trace dump (trace.h) into a Chrome trace / Perfetto JSON timeline
+//
+// build: cc -O2 -o trace2json trace2json.c ../trace.c ../telemetry.c
+// usage: trace2json [capture.bin] > trace.json   (reads stdin when no file is given)
+//
+// Send 'T' to the board to get a dump; other frames in the capture are skipped. Open the
+// output in chrome://tracing or ui.perfetto.dev: every task, Swi and Hwi gets its own track,
+// semaphore posts/pends and marks are instants on the thread that ran them. The Timer0 tick
+// and the Clock Hwi are only counted by the firmware, their time shows as the thread they interrupted. Only the last
+// dump in the capture is converted. Timestamps are unwrapped from 32 to 64 bits.
+//
+// The per-object run time (time as the innermost running context) and run count are printed
+// to stderr in the same format as host/trace_gen prints its expected values. Exit status is
+// non-zero on bad frames, missing events or begin/end pairs that do not nest.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../trace.h"
+#include "../telemetry.h"
+
+#define STACK_MAX 16
+
+typedef struct
+{
+    uint8_t buf[TRACE_FRAME_MAX];
+    size_t fill;
+    unsigned long frames;
+    unsigned long bad;
+    trace_event_t *ev;      //events of the dump being received
+    unsigned expected;      //from its start frame
+    unsigned received;
+    unsigned long lost;
+    unsigned long untraced; //Timer0 tick and Clock Hwi runs, counted by the firmware instead of recorded
+    uint32_t freq_hz;
+} decoder_t;
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+//checks and applies a whole frame, returns 0 when it is bad
+static int apply(decoder_t *dec)
+{
+    const uint8_t *p = dec->buf + TRACE_HEADER_SIZE;
+    size_t payload = dec->buf[3];
+    size_t i;
+
+    if ((payload < 1) || (telemetry_crc16(dec->buf + 2, (uint16_t)(TRACE_HEADER_SIZE - 2 + payload)) !=
+                          get_u16(dec->buf + TRACE_HEADER_SIZE + payload)))
+    {
+        return 0;
+    }
+    if ((p[0] == TRACE_KIND_START) && (payload == TRACE_START_PAYLOAD))
+    {
+        dec->expected = get_u16(p + 1); //a new dump replaces the previous one
+        dec->lost = get_u32(p + 3);
+        dec->freq_hz = get_u32(p + 7);
+        dec->untraced = get_u32(p + 11);
+        dec->received = 0;
+        return 1;
+    }
+    if ((p[0] != TRACE_KIND_EVENTS) || ((payload - 1) % 8 != 0))
+    {
+        return 0;
+    }
+    for (i = 0; (i < (payload - 1) / 8) && (dec->received < dec->expected); i++)
+    {
+        trace_event_t *e = &dec->ev[dec->received++];
+        e->time = get_u32(p + 1 + 8 * i);
+        e->event = get_u16(p + 5 + 8 * i);
+        e->arg = get_u16(p + 7 + 8 * i);
+    }
+    return 1;
+}
+
+static void push_byte(decoder_t *dec, uint8_t byte)
+{
+    dec->buf[dec->fill++] = byte;
+    if ((dec->fill == 1) && (byte != TRACE_SYNC0))
+    {
+        dec->fill = 0;
+        return;
+    }
+    if ((dec->fill == 2) && (byte != TRACE_SYNC1))
+    {
+        dec->fill = (byte == TRACE_SYNC0) ? 1 : 0;
+        return;
+    }
+    if ((dec->fill == 4) && ((dec->buf[2] != TRACE_VERSION) ||
+        (dec->buf[3] + TRACE_HEADER_SIZE + TRACE_CRC_SIZE > TRACE_FRAME_MAX)))
+    {
+        dec->bad++;
+        dec->fill = 0;
+        return;
+    }
+    if ((dec->fill < 4) || (dec->fill < (size_t)dec->buf[3] + TRACE_HEADER_SIZE + TRACE_CRC_SIZE))
+    {
+        return;
+    }
+    if (apply(dec))
+    {
+        dec->frames++;
+    }
+    else
+    {
+        dec->bad++;
+    }
+    dec->fill = 0;
+}
+
+//Chrome trace output, one track per object
+static double ts_us;
+static int first_event = 1;
+
+static void json_event(const char *ph, uint16_t object, const char *name, const char *extra)
+{
+    printf("%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%u%s}", first_event ? "" : ",\n",
+           name, ph, ts_us, (unsigned)object, extra);
+    first_event = 0;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in = stdin;
+    static decoder_t dec;
+    static const char *const sem_verbs[3] = { "post ", "pend ", "" };
+    uint64_t busy[TRACE_OBJECTS] = { 0 };
+    unsigned long runs[TRACE_OBJECTS] = { 0 };
+    uint16_t stack[STACK_MAX];   //open Swi/Hwi, innermost last
+    int depth = 0;
+    int task = -1;               //running task, unknown until the first switch
+    uint64_t before_switch = 0;
+    unsigned long unbalanced = 0;
+    uint64_t now = 0;
+    uint64_t start = 0;
+    uint32_t last = 0;
+    unsigned i;
+    int c;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [capture.bin]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 1)
+    {
+        in = fopen(argv[1], "rb");
+        if (in == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+    dec.ev = malloc(65536 * sizeof(trace_event_t));
+    while ((c = fgetc(in)) != EOF)
+    {
+        push_byte(&dec, (uint8_t)c);
+    }
+    if (dec.freq_hz == 0)
+    {
+        fprintf(stderr, "no trace dump found\n");
+        return 1;
+    }
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (i = 0; i < TRACE_OBJECTS; i++)
+    {
+        char extra[64];
+        snprintf(extra, sizeof(extra), ",\"args\":{\"name\":\"%s\"}", trace_object_names[i]);
+        json_event("M", (uint16_t)i, "thread_name", extra);
+    }
+    for (i = 0; i < dec.received; i++)
+    {
+        const trace_event_t *e = &dec.ev[i];
+        uint16_t type = TRACE_TYPE(e->event);
+        uint16_t object = TRACE_OBJECT(e->event);
+        int current;
+
+        if (i == 0)
+        {
+            last = e->time;
+        }
+        now += (uint32_t)(e->time - last); //unwrap, the tick keeps the gaps far below one wrap
+        last = e->time;
+        if (i == 0)
+        {
+            start = now;
+        }
+        ts_us = (double)(now - start) * 1e6 / dec.freq_hz;
+
+        //time since the previous event goes to whoever ran innermost
+        current = (depth > 0) ? stack[depth - 1] : task;
+        if (i > 0)
+        {
+            uint32_t elapsed = e->time - dec.ev[i - 1].time;
+            if (current >= 0)
+            {
+                busy[current] += elapsed;
+            }
+            else
+            {
+                before_switch += elapsed; //task not known yet
+            }
+        }
+        if ((object >= TRACE_OBJECTS) || (type >= TRACE_TYPES))
+        {
+            unbalanced++;
+            continue;
+        }
+        switch (type)
+        {
+        case TRACE_TASK_SWITCH:
+            if ((task < 0) && (e->arg < TRACE_OBJECTS))
+            {
+                //first switch: the task switched out is the one that ran since the start of the dump
+                busy[e->arg] += before_switch;
+            }
+            if (task >= 0)
+            {
+                json_event("E", (uint16_t)task, trace_object_names[task], "");
+            }
+            json_event("B", object, trace_object_names[object], "");
+            task = object;
+            runs[object]++;
+            break;
+        case TRACE_SWI_BEGIN:
+        case TRACE_HWI_BEGIN:
+            if (depth < STACK_MAX)
+            {
+                stack[depth++] = object;
+            }
+            json_event("B", object, trace_object_names[object], "");
+            runs[object]++;
+            break;
+        case TRACE_SWI_END:
+        case TRACE_HWI_END:
+            if ((depth > 0) && (stack[depth - 1] == object))
+            {
+                depth--;
+                json_event("E", object, trace_object_names[object], "");
+            }
+            else if ((depth > 0) || (runs[object] > 0))
+            {
+                unbalanced++; //an end that does not close the innermost begin
+            }
+            //else it began before the dump started
+            break;
+        default:
+            if (current >= 0)
+            {
+                char name[48];
+                char extra[64];
+                if (type == TRACE_MARK)
+                {
+                    snprintf(name, sizeof(name), "mark");
+                }
+                else
+                {
+                    const char *verb = (type == TRACE_SEM_PENDED) ? (e->arg ? "taken " : "timeout ") :
+                                       sem_verbs[type - TRACE_SEM_POST];
+                    snprintf(name, sizeof(name), "%s%s", verb, trace_object_names[object]);
+                }
+                snprintf(extra, sizeof(extra), ",\"s\":\"t\",\"args\":{\"arg\":%u}", (unsigned)e->arg);
+                json_event("i", (uint16_t)current, name, extra);
+            }
+            break;
+        }
+    }
+    //close whatever is still open at the end of the dump
+    while (depth > 0)
+    {
+        depth--;
+        json_event("E", stack[depth], trace_object_names[stack[depth]], "");
+    }
+    if (task >= 0)
+    {
+        json_event("E", (uint16_t)task, trace_object_names[task], "");
+    }
+    printf("\n]}\n");
+
+    fprintf(stderr, "%lu frames, %lu bad, %u of %u events, %lu lost before the dump, %lu hwi runs not recorded, %.3f ms\n",
+            dec.frames, dec.bad, dec.received, dec.expected, dec.lost, dec.untraced, (double)(now - start) * 1e3 / dec.freq_hz);
+    for (i = 0; i < TRACE_OBJECTS; i++)
+    {
+        if ((busy[i] != 0) || (runs[i] != 0))
+        {
+            fprintf(stderr, "%-8s %14.3f us %8lu runs\n", trace_object_names[i], (double)busy[i] * 1e6 / dec.freq_hz, runs[i]);
+        }
+    }
+    if (unbalanced != 0)
+    {
+        fprintf(stderr, "%lu events out of order\n", unbalanced);
+    }
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+    return ((dec.bad == 0) && (dec.received == dec.expected) && (unbalanced == 0)) ? 0 : 1;
+}
@@ -0,0 +1,295 @@
+// Thie file contains a host generator of synthetic event trace dumps (trace.h) to test host/trace2json
+//
+// build: cc -O2 -DTRACE_DEPTH=4096 -o trace_gen trace_gen.c ../trace.c ../telemetry.c
+// usage: trace_gen [seconds [seed]] > capture.bin 2> expected.txt     defaults 1.5 s, seed 1
+// check: trace2json capture.bin 2>&1 >trace.json | tail -n +2 | diff - expected.txt
+//
+// Simulates the firmware's scheduling at 200 MHz with the timestamp counter starting 0.5 s
+// before it wraps: the 10 us Timer0 tick Hwi that posts mySem every 10000 ticks, the ECAP Hwi posting
+// mySem1 every 100 ms, the ADC Hwi posting Swi0 every 500 ms, and Tsk0/Tsk1/Tsk2 at their
+// app.cfg priorities (Tsk0 posts mySem2 when done, which preempts it with Tsk2). Durations
+// jitter by up to +-25 %. The tick is counted, not recorded, as trace_bios.c does, so its time
+// goes to the context it interrupted. The events go through the firmware's trace ring and encoder, with
+// telemetry frames in between as on the real UART. The run time and run count of every
+// object, as the simulation accounted them, go to stderr in trace2json's format.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../trace.h"
+#include "../telemetry.h"
+
+#define FREQ_HZ 200000000UL
+#define US(x) ((uint64_t)(x) * (FREQ_HZ / 1000000UL))
+#define HWI_SOURCES 3
+#define TASKS 3
+
+typedef struct
+{
+    uint16_t object;
+    uint64_t period;
+    uint64_t next;       //next arrival
+    uint64_t duration;
+    int post_sem;        //semaphore object posted, or -1
+    int post_every;      //posts on every n-th arrival
+    int post_swi;        //posts Swi0
+    unsigned long arrivals;
+} hwi_source_t;
+
+typedef struct
+{
+    uint16_t object;
+    int priority;
+    uint16_t sem;        //pends on this one
+    int post_sem;        //posts this one when its work is done, or -1
+    uint64_t work;
+    uint64_t remaining;
+    int ready;
+    int posted;          //work done and post made, the pend comes next
+    int woken;           //pend returned, not switched in yet
+} task_t;
+
+static trace_buffer_t trace;
+static const uint32_t base = 0xFFFFFFFFUL - FREQ_HZ / 2; //counter at time 0
+static uint64_t busy[TRACE_OBJECTS];
+static unsigned long runs[TRACE_OBJECTS];
+static int sem_count[TRACE_OBJECTS];
+static task_t tasks[TASKS] = {
+    { TRACE_OBJ_TSK0, 9, TRACE_OBJ_MYSEM, TRACE_OBJ_MYSEM2, 0, 0, 0, 0, 0 },
+    { TRACE_OBJ_TSK1, 10, TRACE_OBJ_MYSEM1, -1, 0, 0, 0, 0, 0 },
+    { TRACE_OBJ_TSK2, 11, TRACE_OBJ_MYSEM2, -1, 0, 0, 0, 0, 0 }
+};
+static uint32_t rng;
+
+static uint64_t jitter(uint64_t cycles)
+{
+    rng = rng * 1664525U + 1013904223U;
+    return cycles * 3 / 4 + (uint64_t)(rng >> 8) % (cycles / 2 + 1);
+}
+
+static void emit(uint64_t t, uint16_t type, uint16_t object, uint16_t arg)
+{
+    trace_put(&trace, (uint32_t)(base + t), TRACE_EVENT(type, object), arg);
+}
+
+static void post(uint64_t t, uint16_t sem)
+{
+    int i;
+
+    emit(t, TRACE_SEM_POST, sem, 0);
+    for (i = 0; i < TASKS; i++)
+    {
+        if (!tasks[i].ready && (tasks[i].sem == sem))
+        {
+            tasks[i].ready = 1; //waiter takes it straight away
+            tasks[i].woken = 1;
+            tasks[i].remaining = jitter(tasks[i].work);
+            return;
+        }
+    }
+    sem_count[sem] = 1; //binary
+}
+
+//task t pends on its semaphore at time now, returns 1 if it keeps running
+static int pend(uint64_t now, task_t *task)
+{
+    emit(now, TRACE_SEM_PEND, task->sem, 0);
+    task->posted = 0;
+    if (sem_count[task->sem])
+    {
+        sem_count[task->sem] = 0;
+        emit(now, TRACE_SEM_PENDED, task->sem, 1);
+        task->remaining = jitter(task->work);
+        return 1;
+    }
+    task->ready = 0;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = (argc >= 2) ? atof(argv[1]) : 1.5;
+    hwi_source_t hwi[HWI_SOURCES] = {
+        { TRACE_OBJ_HWI, US(10), 0, 100, TRACE_OBJ_MYSEM, 10000, 0, 0 },               //Timer0 tick, 0.5 us
+        { TRACE_OBJ_HWI0 + 1, US(100000), US(37000), US(3), TRACE_OBJ_MYSEM1, 1, 0, 0 }, //ECAP
+        { TRACE_OBJ_HWI0, US(500000), US(11000), US(2), -1, 1, 1, 0 }                   //ADC
+    };
+    uint64_t end = (uint64_t)(seconds * FREQ_HZ);
+    uint64_t swi_work = US(25);
+    uint64_t swi_remaining = 0;
+    int swi_pending = 0;
+    int swi_running = 0;
+    int current = TRACE_OBJ_IDLE;
+    uint64_t t = 0;
+    uint16_t frames;
+    uint16_t part;
+    int i;
+
+    rng = (argc >= 3) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+    if ((argc > 3) || (seconds <= 0.0))
+    {
+        fprintf(stderr, "usage: %s [seconds [seed]]\n", argv[0]);
+        return 1;
+    }
+    tasks[0].work = US(1500);
+    tasks[1].work = US(60);
+    tasks[2].work = US(300);
+    trace_init(&trace);
+    emit(0, TRACE_MARK, TRACE_OBJ_IDLE, 0); //opens the timeline at 0, the tick at 0 is not recorded
+
+    while (1)
+    {
+        hwi_source_t *h = &hwi[0];
+        task_t *best = NULL;
+
+        for (i = 1; i < HWI_SOURCES; i++)
+        {
+            if (hwi[i].next < h->next)
+            {
+                h = &hwi[i];
+            }
+        }
+
+        if (t < h->next)
+        {
+            uint64_t run;
+
+            if (swi_pending && !swi_running)
+            {
+                swi_pending = 0;
+                swi_running = 1;
+                swi_remaining = jitter(swi_work);
+                emit(t, TRACE_SWI_BEGIN, TRACE_OBJ_SWI0, 0);
+                runs[TRACE_OBJ_SWI0]++;
+            }
+            if (swi_running)
+            {
+                run = (swi_remaining < h->next - t) ? swi_remaining : (h->next - t);
+                busy[TRACE_OBJ_SWI0] += run;
+                swi_remaining -= run;
+                t += run;
+                if (swi_remaining == 0)
+                {
+                    emit(t, TRACE_SWI_END, TRACE_OBJ_SWI0, 0);
+                    swi_running = 0;
+                }
+                continue;
+            }
+
+            for (i = 0; i < TASKS; i++)
+            {
+                if (tasks[i].ready && ((best == NULL) || (tasks[i].priority > best->priority)))
+                {
+                    best = &tasks[i];
+                }
+            }
+            if ((best != NULL ? best->object : TRACE_OBJ_IDLE) != current)
+            {
+                uint16_t next = (best != NULL) ? best->object : TRACE_OBJ_IDLE;
+                emit(t, TRACE_TASK_SWITCH, next, (uint16_t)current);
+                runs[next]++;
+                current = next;
+                if ((best != NULL) && best->woken)
+                {
+                    best->woken = 0;
+                    emit(t, TRACE_SEM_PENDED, best->sem, 1);
+                }
+            }
+            if (best == NULL)
+            {
+                busy[TRACE_OBJ_IDLE] += h->next - t;
+                t = h->next;
+                continue;
+            }
+            if (best->posted)
+            {
+                pend(t, best); //resumed after the post that preempted it
+                continue;
+            }
+            run = (best->remaining < h->next - t) ? best->remaining : (h->next - t);
+            busy[best->object] += run;
+            best->remaining -= run;
+            t += run;
+            if (best->remaining == 0)
+            {
+                if (best->post_sem >= 0)
+                {
+                    best->posted = 1;
+                    post(t, (uint16_t)best->post_sem); //a higher priority waiter preempts before the pend
+                }
+                else
+                {
+                    pend(t, best);
+                }
+            }
+            continue;
+        }
+
+        //the Hwi, not nested
+        {
+            uint64_t d = jitter(h->duration);
+            int untraced = (h->object == TRACE_OBJ_HWI);
+
+            if (untraced)
+            {
+                trace_skip(&trace);
+                busy[swi_running ? TRACE_OBJ_SWI0 : current] += d;
+            }
+            else
+            {
+                emit(t, TRACE_HWI_BEGIN, h->object, 0);
+                runs[h->object]++;
+                busy[h->object] += d;
+            }
+            t += d;
+            h->arrivals++;
+            if ((h->post_sem >= 0) && (h->arrivals % h->post_every == 0))
+            {
+                post(t, (uint16_t)h->post_sem);
+            }
+            if (h->post_swi)
+            {
+                swi_pending = 1;
+            }
+            if (!untraced)
+            {
+                emit(t, TRACE_HWI_END, h->object, 0);
+            }
+            h->next += h->period;
+            if ((t >= end) && !untraced) //closes the timeline with a recorded event
+            {
+                break;
+            }
+        }
+    }
+
+    if (trace.count > TRACE_DEPTH)
+    {
+        fprintf(stderr, "%lu events do not fit TRACE_DEPTH %d, build with a larger one or run shorter\n",
+                (unsigned long)trace.count, TRACE_DEPTH);
+        return 1;
+    }
+
+    //dump it as Tsk2 would, with telemetry frames on the same line
+    frames = trace_freeze(&trace);
+    for (part = 0; part < frames; part++)
+    {
+        unsigned char frame[TRACE_FRAME_MAX > TELEMETRY_FRAME_SIZE ? TRACE_FRAME_MAX : TELEMETRY_FRAME_SIZE];
+        uint16_t n = trace_encode(frame, &trace, FREQ_HZ, part);
+
+        fwrite(frame, 1, n, stdout);
+        if ((part % 16) == 0)
+        {
+            telemetry_sample_t sample = { part, part * 10U, 2000, 5000, 3000, 800, 0 };
+            n = telemetry_encode(frame, &sample);
+            fwrite(frame, 1, n, stdout);
+        }
+    }
+    for (i = 0; i < TRACE_OBJECTS; i++)
+    {
+        if ((busy[i] != 0) || (runs[i] != 0))
+        {
+            fprintf(stderr, "%-8s %14.3f us %8lu runs\n", trace_object_names[i], (double)busy[i] * 1e6 / FREQ_HZ, runs[i]);
+        }
+    }
+    return 0;
+}
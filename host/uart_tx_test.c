@@ -0,0 +1,314 @@
+// Thie file contains a host test of the buffered SCIB transmit (28379D_uart.h) against the SCIB
+// model of sim/sci_link.c, on the SYS/BIOS shim
+//
+// build: make uart_tx_test
+// usage: uart_tx_test [bytes]     bytes streamed through the ring, default 4096
+//
+// Only 28379D_uart.c of the firmware is linked: one test task queues output while the model
+// shifts it out at 115200 baud and raises SCIB_TX_ISR as its FIFO drains. Checked:
+//   - ring wrap: a numbered stream many times the ring size, queued in odd sized pieces as the
+//     ring has room, comes out complete and in order
+//   - full ring: one uart_tx_buff larger than the ring queues UART_TX_RING_SIZE - 1 bytes, counts
+//     the refusal in uart_tx_dropped and sends exactly the bytes it queued; uart_tx_char on a full
+//     ring returns false and counts too
+//   - frame ping-pong: numbered frames of every length up to UART_FRAME_SIZE come out whole and in
+//     the order submitted; with both buffers in flight uart_frame_acquire gives NULL and
+//     uart_frame_submit false; uart_tx_pending counts both queued frames; bytes queued in the
+//     ring before a frame go out before it
+//   - uart_tx_pending is 0 and the line idle when uart_tx_flush returns
+// Reported: line use of the stream and of the frames, SCIB_TX_ISR runs per byte.
+// Every failed check is printed and the exit status is 1.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shim/shim.h"
+#include "sim/sim.h"
+#include "../28379D_uart.h"
+#include <ti/sysbios/BIOS.h>
+
+#define CALL_CYCLES 20
+#define BAUD 115200UL
+#define CAPTURE_SIZE 65536
+#define FRAMES 300
+#define CHAR_CYCLES (320.0 * (LSP_CLK_FREQ / (BAUD * 8U))) //10 bits, as sci_link.c times them
+
+extern Void SCIB_TX_ISR(UArg arg);
+static Void test_task(UArg arg0, UArg arg1);
+
+static struct Task_Object task_obj = { "test", test_task, 0, 0, 9 };
+static struct Hwi_Object tx_hwi = { "SCIB_TX_ISR", 99, SCIB_TX_ISR, 0 };
+
+static const Task_Handle tasks[] = { &task_obj };
+static const Hwi_Handle hwis[] = { &tx_hwi };
+
+const shim_app_t shim_app = {
+    tasks, 1,
+    NULL, 0,
+    hwis, 1,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0,
+    NULL, 0
+};
+
+static long stream_bytes = 4096;
+static unsigned long failures;
+static volatile int finished;
+
+//what came out of the shift register
+static struct
+{
+    uint8_t data[CAPTURE_SIZE];
+    size_t count;
+    uint64_t first;
+    uint64_t last;
+} line;
+
+static void line_byte(void *arg, uint8_t byte)
+{
+    if (line.count == 0)
+    {
+        line.first = shim_now();
+    }
+    if (line.count < CAPTURE_SIZE)
+    {
+        line.data[line.count] = byte;
+    }
+    line.count++;
+    line.last = shim_now();
+}
+
+static void check(const char *what, int ok)
+{
+    if (!ok)
+    {
+        printf("FAIL %s\n", what);
+        failures++;
+    }
+}
+
+static uint8_t stream_byte(long n)
+{
+    return (uint8_t)(n * 7 + (n >> 8));
+}
+
+//flushes and checks that nothing is left anywhere
+static void drain(const char *what)
+{
+    uart_tx_flush();
+    if ((uart_tx_pending() != 0) || (ScibRegs.SCIFFTX.bit.TXFFST != 0) || !ScibRegs.SCICTL2.bit.TXEMPTY)
+    {
+        printf("FAIL %s: output left after uart_tx_flush\n", what);
+        failures++;
+    }
+}
+
+static void check_stream(void)
+{
+    char piece[97];
+    unsigned long runs = tx_hwi.stat.runs;
+    unsigned long refused = 0;
+    long queued = 0;
+    long n;
+
+    line.count = 0;
+    uart_tx_dropped = 0;
+    while (queued < stream_bytes)
+    {
+        uint16_t length = (uint16_t)(1 + (queued * 13) % sizeof(piece));
+        uint16_t i;
+        uint16_t taken;
+
+        if (length > stream_bytes - queued)
+        {
+            length = (uint16_t)(stream_bytes - queued);
+        }
+        for (i = 0; i < length; i++)
+        {
+            piece[i] = (char)stream_byte(queued + i);
+        }
+        taken = uart_tx_buff(piece, length);
+        queued += taken;
+        if (taken < length)
+        {
+            refused++;
+            Task_sleep(1); //ring full, let the ISR drain it, then queue the rest again
+        }
+    }
+    drain("stream");
+    check("stream length", line.count == (size_t)stream_bytes);
+    check("uart_tx_dropped counts each refused piece", uart_tx_dropped == refused);
+    for (n = 0; (n < stream_bytes) && (n < CAPTURE_SIZE) && (n < (long)line.count); n++)
+    {
+        if (line.data[n] != stream_byte(n))
+        {
+            printf("FAIL stream byte %ld: 0x%02x, expected 0x%02x\n", n, line.data[n], stream_byte(n));
+            failures++;
+            break;
+        }
+    }
+    printf("stream: %ld bytes through a %u byte ring, %.1f %% of the line, %.3f SCIB_TX_ISR runs per byte\n",
+           stream_bytes, UART_TX_RING_SIZE,
+           100.0 * line.count * CHAR_CYCLES / ((double)(line.last - line.first) + CHAR_CYCLES),
+           (double)(tx_hwi.stat.runs - runs) / stream_bytes);
+}
+
+static void check_full_ring(void)
+{
+    static char burst[UART_TX_RING_SIZE + 44];
+    uint16_t taken;
+    uint16_t i;
+
+    for (i = 0; i < sizeof(burst); i++)
+    {
+        burst[i] = (char)(i ^ 0x5A);
+    }
+    line.count = 0;
+    uart_tx_dropped = 0;
+    //no kernel call in between, so SCIB_TX_ISR cannot take bytes out while the ring fills
+    taken = uart_tx_buff(burst, sizeof(burst));
+    check("full ring takes UART_TX_RING_SIZE - 1", taken == UART_TX_RING_SIZE - 1);
+    check("uart_tx_dropped counts the refused byte", uart_tx_dropped == 1);
+    check("uart_tx_pending of a full ring", uart_tx_pending() == UART_TX_RING_SIZE - 1);
+    check("uart_tx_char on a full ring", !uart_tx_char('x'));
+    check("uart_tx_dropped counts every refused call", uart_tx_dropped == 2);
+    drain("full ring");
+    check("full ring sends what it queued", line.count == taken);
+    for (i = 0; (i < taken) && (i < line.count); i++)
+    {
+        if (line.data[i] != (uint8_t)burst[i])
+        {
+            printf("FAIL full ring byte %u: 0x%02x, expected 0x%02x\n", i, line.data[i], (uint8_t)burst[i]);
+            failures++;
+            break;
+        }
+    }
+}
+
+static uint16_t frame_length(int frame)
+{
+    return (uint16_t)(1 + (frame * 37) % UART_FRAME_SIZE);
+}
+
+static uint8_t frame_byte(int frame, uint16_t i)
+{
+    return (uint8_t)((frame << 2) ^ (i * 29));
+}
+
+static void fill_frame(char *buf, int frame)
+{
+    uint16_t i;
+
+    for (i = 0; i < frame_length(frame); i++)
+    {
+        buf[i] = (char)frame_byte(frame, i);
+    }
+}
+
+static void check_frame_buffers(void)
+{
+    char *a;
+    char *b;
+
+    line.count = 0;
+    check("ring before frames", uart_tx_buff("ring", 4) == 4);
+    //no kernel call until the flush, so SCIB_TX_ISR takes nothing out in between
+    a = uart_frame_acquire();
+    check("first buffer", a != NULL);
+    check("submit without a length", !uart_frame_submit(0));
+    fill_frame(a, 0);
+    check("first submit", uart_frame_submit(frame_length(0)));
+    b = uart_frame_acquire();
+    check("second buffer is the other one", (b != NULL) && (b != a));
+    memset(b, 'z', UART_FRAME_SIZE);
+    check("oversized submit is clamped", uart_frame_submit(UART_FRAME_SIZE + 10));
+    check("no buffer while both are in flight", uart_frame_acquire() == NULL);
+    check("no submit while both are in flight", !uart_frame_submit(1));
+    check("uart_tx_pending counts the ring and both frames",
+          uart_tx_pending() == 4 + frame_length(0) + UART_FRAME_SIZE);
+    drain("frame buffers");
+    check("ring then frames", (line.count == 4U + frame_length(0) + UART_FRAME_SIZE) &&
+                              (memcmp(line.data, "ring", 4) == 0) && (line.data[4] == frame_byte(0, 0)) &&
+                              (line.data[line.count - 1] == 'z'));
+}
+
+static void check_frames(void)
+{
+    unsigned long runs = tx_hwi.stat.runs;
+    size_t pos = 0;
+    int frame;
+
+    line.count = 0;
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        char *buf;
+
+        while ((buf = uart_frame_acquire()) == NULL)
+        {
+            Task_sleep(1);
+        }
+        fill_frame(buf, frame);
+        check("frame submit", uart_frame_submit(frame_length(frame)));
+    }
+    drain("frames");
+    for (frame = 0; frame < FRAMES; frame++)
+    {
+        uint16_t i;
+
+        for (i = 0; (i < frame_length(frame)) && (pos < line.count); i++, pos++)
+        {
+            if (line.data[pos] != frame_byte(frame, i))
+            {
+                printf("FAIL frame %d byte %u: 0x%02x, expected 0x%02x\n", frame, i, line.data[pos],
+                       frame_byte(frame, i));
+                failures++;
+                return;
+            }
+        }
+    }
+    check("frames length", pos == line.count);
+    printf("frames: %d frames, %lu bytes, %.1f %% of the line, %.3f SCIB_TX_ISR runs per byte\n", FRAMES,
+           (unsigned long)line.count, 100.0 * line.count * CHAR_CYCLES / ((double)(line.last - line.first) + CHAR_CYCLES),
+           (double)(tx_hwi.stat.runs - runs) / line.count);
+}
+
+static Void test_task(UArg arg0, UArg arg1)
+{
+    uart_init(BAUD);
+    check_stream();
+    check_full_ring();
+    check_frame_buffers();
+    check_frames();
+    finished = 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        stream_bytes = strtol(argv[1], NULL, 0);
+    }
+    if ((argc > 2) || (stream_bytes < 1) || (stream_bytes > CAPTURE_SIZE))
+    {
+        fprintf(stderr, "usage: %s [bytes (1..%d)]\n", argv[0], CAPTURE_SIZE);
+        return 2;
+    }
+    shim_config.call_cycles = CALL_CYCLES;
+    shim_config.run_cycles = (uint64_t)(2 + stream_bytes * 10 / BAUD) * SHIM_CPU_HZ;
+    sim_sci_init(line_byte, NULL);
+    BIOS_start();
+
+    if (!finished)
+    {
+        printf("FAIL the test task did not finish\n");
+        failures++;
+    }
+    if (failures != 0)
+    {
+        printf("%lu failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,254 @@
+// Thie file contains a host test of the ultrasonic ranging (ePWM2 trigger, eCAP1 capture, ECAP_ISR
+// and Tsk1 in SoilMonitor_main.c) against the HC-SR04 and eCAP1 model of sim/hcsr04.c
+//
+// build: make ultrasonic_test
+// usage: ultrasonic_test
+//
+// The whole firmware runs on the shim as in firmware_host; the test moves the water and stops
+// the trigger from model events and checks the ranging state at the end of each phase:
+//   0 s    steady   water at 100 mm: both eCAP widths of every cycle are the echo of 100 mm,
+//                   ECAP_ISR runs once per two echoes and clears INT, Tsk1 wakes once per
+//                   ECAP_ISR, no timeouts, no overruns, the level is 10 cm
+//   3 s    step     water at 120 mm, faster than WATER_LEVEL_MAX_RATE: the first echoes are
+//                   rejected as outliers and the level holds at 10 cm, 2 s later it is 12 cm
+//   5 s    silent   ePWM2 stopped, no echoes: Tsk1 counts a timeout every ULTRASONIC_TIMEOUT_TICKS
+//                   and locks the pump out (isrFlag1) at the ULTRASONIC_MISS_LIMIT'th, not before
+//   6.5 s  restart  ePWM2 counting again: the lockout ends with the first echo pair, the level
+//                   is still 12 cm and no timeout is counted after it
+// Reported: per range (one ECAP_ISR and one pass of Tsk1, two echoes) the runs, the virtual
+// cycles the shim charged (20 per kernel call, the code itself takes no virtual time) and the
+// host ns of both threads, and the largest PROFILE_ECAP and PROFILE_TSK1 readings.
+// Every failed check is printed and the exit status is 1.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "shim/shim.h"
+#include "sim/sim.h"
+#include "../sensor_math.h"
+#include "../ultrasonic.h"
+#include "../water_level.h"
+#include "../profile.h"
+#include <Headers/F2837xD_device.h>
+
+#define CALL_CYCLES 20
+#define TEMPERATURE 21.0
+#define STEADY_MM 100.0
+#define STEP_MM 120.0
+#define STEP_S 3.0
+#define STEP_HOLD_S 3.25 //two echo pairs after the step
+#define SILENT_S 5.0
+#define RESTART_S 6.5
+#define END_S 8.0
+#define LEVEL_TOLERANCE_CM 0.2
+#define WIDTH_TOLERANCE 0.01 //of the echo width, the firmware's air temperature is the DHT20's
+
+extern Int firmware_main();
+extern volatile Bool isrFlag1;
+extern uint32_t ultrasonic_timeouts;
+extern volatile uint32_t ultrasonic_echo[2];
+extern water_level_t tank_level;
+extern sensor_t distance;
+extern const Hwi_Handle hwi1; //ECAP_ISR
+extern const Task_Handle Tsk1;
+
+static unsigned long failures;
+
+//ranging state at the end of a phase
+typedef struct
+{
+    unsigned long ecap_runs;
+    unsigned long tsk1_runs;
+    unsigned long echoes;
+    unsigned long timeouts;
+    unsigned long rejected;
+    uint64_t cycles;
+    uint64_t host_ns;
+} phase_t;
+
+static phase_t phase[4];
+
+//isrFlag1 edges seen by the 1 ms watch
+static struct
+{
+    int locked;
+    double lock_s;
+    unsigned long lock_timeouts;
+    double unlock_s;
+} lockout;
+
+static void check(const char *what, int ok)
+{
+    if (!ok)
+    {
+        printf("FAIL %s\n", what);
+        failures++;
+    }
+}
+
+static double now_s(void)
+{
+    return (double)shim_now() / SHIM_CPU_HZ;
+}
+
+static double level_cm(void)
+{
+    return sensor_to_units(distance, 1000, 0, 2147483647L) / 1000.0;
+}
+
+static void take(phase_t *s)
+{
+    s->ecap_runs = hwi1->stat.runs;
+    s->tsk1_runs = Tsk1->stat.runs;
+    s->echoes = sim_stats.echoes + sim_stats.echoes_lost;
+    s->timeouts = ultrasonic_timeouts;
+    s->rejected = tank_level.rejected;
+    s->cycles = hwi1->stat.cycles + Tsk1->stat.cycles;
+    s->host_ns = hwi1->stat.host_ns + Tsk1->stat.host_ns;
+}
+
+static void watch(void *arg)
+{
+    if (isrFlag1 && !lockout.locked)
+    {
+        lockout.locked = 1;
+        lockout.lock_s = now_s();
+        lockout.lock_timeouts = ultrasonic_timeouts;
+    }
+    else if (!isrFlag1 && lockout.locked)
+    {
+        lockout.locked = 0;
+        lockout.unlock_s = now_s();
+    }
+}
+
+static void check_widths(double mm)
+{
+    double speed = SOUND_SPEED_0C + SOUND_SPEED_PER_C * TEMPERATURE;
+    double width = 2.0 * mm / 1000.0 / speed * SHIM_CPU_HZ;
+    int i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (fabs(ultrasonic_echo[i] - width) > WIDTH_TOLERANCE * width)
+        {
+            printf("FAIL echo %d at %.1f s: %lu counts, expected %.0f\n", i, now_s(), (unsigned long)ultrasonic_echo[i],
+                   width);
+            failures++;
+        }
+    }
+}
+
+static void check_level(const char *what, double cm)
+{
+    if (fabs(level_cm() - cm) > LEVEL_TOLERANCE_CM)
+    {
+        printf("FAIL %s: level %.2f cm, expected %.1f\n", what, level_cm(), cm);
+        failures++;
+    }
+}
+
+static void steady_end(void *arg)
+{
+    take(&phase[0]);
+    check_widths(STEADY_MM);
+    check_level("steady", STEADY_MM / 10.0);
+    check("steady: an ECAP_ISR per two echoes", (phase[0].ecap_runs == phase[0].echoes / 2) && (phase[0].ecap_runs != 0));
+    check("steady: Tsk1 wakes once per ECAP_ISR", phase[0].tsk1_runs == phase[0].ecap_runs + 1); //+ its start
+    check("steady: ECAP_ISR clears INT", (ECap1Regs.ECFLG.bit.INT & ~ECap1Regs.ECCLR.bit.INT) == 0); //ECCLR applies at the next capture
+    check("steady: no timeouts", phase[0].timeouts == 0);
+    check("steady: no lockout", !isrFlag1);
+    check("steady: no eCAP overruns", sim_stats.ecap_overruns == 0);
+    sim_signal_set(SIM_DISTANCE, STEP_MM);
+}
+
+static void step_hold(void *arg)
+{
+    check("step: the first echoes after the step are rejected", tank_level.rejected > phase[0].rejected);
+    check_level("step: level holds", STEADY_MM / 10.0);
+}
+
+static void step_end(void *arg)
+{
+    take(&phase[1]);
+    check_widths(STEP_MM);
+    check_level("step", STEP_MM / 10.0);
+    check("step: no timeouts", phase[1].timeouts == 0);
+    check("step: no lockout", !isrFlag1);
+    EPwm2Regs.TBCTL.bit.CTRMODE = 3; //stopped, the model fires no trigger
+}
+
+static void silent_end(void *arg)
+{
+    take(&phase[2]);
+    check("silent: no echo after the trigger stopped", phase[2].echoes - phase[1].echoes <= 1);
+    check("silent: a timeout per ULTRASONIC_TIMEOUT_TICKS",
+          phase[2].timeouts == (unsigned long)((RESTART_S - SILENT_S) * 1000.0 / ULTRASONIC_TIMEOUT_TICKS));
+    check("silent: locked out", isrFlag1 && lockout.locked);
+    check("silent: locked out at the ULTRASONIC_MISS_LIMIT'th timeout", lockout.lock_timeouts == ULTRASONIC_MISS_LIMIT);
+    EPwm2Regs.TBCTL.bit.CTRMODE = 0;
+}
+
+static void restart_end(void *arg)
+{
+    take(&phase[3]);
+    check_widths(STEP_MM);
+    check_level("restart", STEP_MM / 10.0);
+    check("restart: lockout over", !isrFlag1 && !lockout.locked);
+    check("restart: lockout ends with the first echo pair",
+          lockout.unlock_s - RESTART_S < 2.0 * ULTRASONIC_PERIOD_MS / 1000.0 + 0.05);
+    check("restart: no timeout after the echoes are back", phase[3].timeouts == phase[2].timeouts);
+    check("restart: no eCAP overruns", sim_stats.ecap_overruns == 0);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long ranges;
+
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        return 2;
+    }
+    if (shim_app_check() != 0)
+    {
+        return 2;
+    }
+    shim_config.call_cycles = CALL_CYCLES;
+    shim_config.run_cycles = (uint64_t)(END_S * SHIM_CPU_HZ) + 1U;
+    sim_signal_set(SIM_TEMPERATURE, TEMPERATURE);
+    sim_signal_set(SIM_DISTANCE, STEADY_MM);
+    sim_signal_set(SIM_A5, 3200);
+    sim_i2c_init();
+    sim_hcsr04_init();
+    sim_adc_init();
+    sim_sci_init(NULL, NULL);
+    shim_at(0, SIM_CYCLES_MS, watch, NULL);
+    shim_at((uint64_t)(STEP_S * SHIM_CPU_HZ), 0, steady_end, NULL);
+    shim_at((uint64_t)(STEP_HOLD_S * SHIM_CPU_HZ), 0, step_hold, NULL);
+    shim_at((uint64_t)(SILENT_S * SHIM_CPU_HZ), 0, step_end, NULL);
+    shim_at((uint64_t)(RESTART_S * SHIM_CPU_HZ), 0, silent_end, NULL);
+    shim_at((uint64_t)(END_S * SHIM_CPU_HZ), 0, restart_end, NULL);
+    firmware_main(); //returns at the end of the run on the host
+
+    ranges = phase[3].ecap_runs;
+    check("the last phase was checked", phase[3].ecap_runs != 0);
+    if (ranges != 0)
+    {
+        printf("%lu ranges (ECAP_ISR + Tsk1, 2 echoes each) in %.1f s, per range: %.1f virtual cycles "
+               "(%u per kernel call), %.0f host ns\n", ranges, END_S, (double)phase[3].cycles / ranges,
+               (unsigned)CALL_CYCLES, (double)phase[3].host_ns / ranges);
+        printf("  ECAP_ISR %.1f cycles %.0f ns, Tsk1 %.1f cycles %.0f ns; probes: ECAP max %lu, TSK1 max %lu\n",
+               (double)hwi1->stat.cycles / hwi1->stat.runs, (double)hwi1->stat.host_ns / hwi1->stat.runs,
+               (double)Tsk1->stat.cycles / Tsk1->stat.runs, (double)Tsk1->stat.host_ns / Tsk1->stat.runs,
+               (unsigned long)profile_probes[PROFILE_ECAP].max, (unsigned long)profile_probes[PROFILE_TSK1].max);
+    }
+    printf("lockout at %.3f s after %lu timeouts, over at %.3f s\n", lockout.lock_s, lockout.lock_timeouts,
+           lockout.unlock_s);
+    if (failures != 0)
+    {
+        printf("%lu failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Thie file contains a host benchmark of the water level estimator (water_level.h) against the
+// single-echo reading the firmware used before (calculateDistance on the last eCAP width).
+//
+// build: cc -O2 -o water_level_bench water_level_bench.c ../water_level.c ../sensor_math.c ../moisture_lut.c -lm
+// usage: water_level_bench [seed]         synthetic trace, see make_trace()
+//        water_level_bench - < trace.csv  recorded trace, one echo per line: dt_ms,width_counts,temp_c[,true_cm]
+//        Lines without true_cm are only counted for lockout flips and timing.
+//
+// Reported per method: RMS and worst error against the true distance, how often the tank
+// lockout (distance > WATER_LEVEL) changed state, and host nanoseconds per echo.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "../sensor_math.h"
+#include "../water_level.h"
+
+#define WATER_LEVEL 14.5      //distance at which the default tank reaches TANK_RESERVE_ML, cm
+#define MAX_ECHOES 100000
+#define RATE_HZ 10            //ULTRASONIC_RATE_HZ default
+#define TIMING_PASSES 50
+
+typedef struct
+{
+    uint32_t dt_ms;
+    uint32_t width;
+    double temp;
+    double truth;  //cm, < 0 if unknown
+} echo_t;
+
+static echo_t trace[MAX_ECHOES];
+static volatile double sink; //keeps the timed loops from being optimised out
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double uniform(void)
+{
+    return (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+}
+
+static double gauss(void)
+{
+    return sqrt(-2.0 * log(uniform())) * cos(6.283185307179586 * uniform());
+}
+
+//10 minutes at RATE_HZ: the pump drains the tank past the lockout level at 0.5 cm/min, a refill
+//brings it back in 20 s, the air warms from 18 to 32 C. On top: 0.3 cm of jitter, 3 % multipath
+//spikes anywhere between 2 and 40 cm and 2 % dropouts (missing echo, the period is skipped).
+static unsigned long make_trace(void)
+{
+    unsigned long n = 0;
+    unsigned long i;
+    uint32_t dt = 0;
+
+    for (i = 0; i < 600UL * RATE_HZ; i++)
+    {
+        double t = (double)i / RATE_HZ;
+        double truth = (t < 480.0) ? 10.0 + t * 0.5 / 60.0 : 14.0 - fmin(t - 480.0, 20.0) * 0.2;
+        double temp = 18.0 + 14.0 * t / 600.0;
+        double speed = (SOUND_SPEED_0C + SOUND_SPEED_PER_C * temp) / 10.0; //cm/ms
+        double cm = truth + 0.3 * gauss();
+        double r = uniform();
+
+        dt += 1000 / RATE_HZ;
+        if (r < 0.02)
+        {
+            continue;
+        }
+        if (r < 0.05)
+        {
+            cm = 2.0 + 38.0 * uniform();
+        }
+        trace[n].dt_ms = dt;
+        trace[n].width = (uint32_t)(2.0 * cm / speed * 200e3 + 0.5); //round trip at 200 MHz
+        trace[n].temp = temp;
+        trace[n].truth = truth;
+        dt = 0;
+        n++;
+    }
+    return n;
+}
+
+static unsigned long read_trace(FILE *f)
+{
+    unsigned long n = 0;
+    char line[128];
+
+    while ((n < MAX_ECHOES) && (fgets(line, sizeof(line), f) != NULL))
+    {
+        unsigned long dt;
+        unsigned long width;
+        double temp;
+        double truth;
+        int fields = sscanf(line, "%lu,%lu,%lf,%lf", &dt, &width, &temp, &truth);
+
+        if (fields < 3)
+        {
+            continue; //header or comment
+        }
+        trace[n].dt_ms = (uint32_t)dt;
+        trace[n].width = (uint32_t)width;
+        trace[n].temp = temp;
+        trace[n].truth = (fields == 4) ? truth : -1.0;
+        n++;
+    }
+    return n;
+}
+
+static void report(const char *name, double sq, double worst, unsigned long scored, unsigned long flips, double ns)
+{
+    printf("%-10s %10.3f %10.3f %8lu %12.1f\n", name, scored ? sqrt(sq / scored) : 0.0, worst, flips, ns);
+}
+
+int main(int argc, char **argv)
+{
+    water_level_t wl;
+    unsigned long n;
+    unsigned long i;
+    unsigned long pass;
+    double sq;
+    double worst;
+    unsigned long scored;
+    unsigned long flips;
+    int locked;
+    double t0;
+
+    if ((argc == 2) && (argv[1][0] == '-') && (argv[1][1] == '\0'))
+    {
+        n = read_trace(stdin);
+    }
+    else if (argc <= 2)
+    {
+        srand((argc == 2) ? (unsigned)strtoul(argv[1], NULL, 0) : 1U);
+        n = make_trace();
+    }
+    else
+    {
+        fprintf(stderr, "usage: %s [seed | -]\n", argv[0]);
+        return 1;
+    }
+    if (n == 0)
+    {
+        fprintf(stderr, "empty trace\n");
+        return 1;
+    }
+
+    printf("%lu echoes, window %d, rate limit %g cm/s, noise %g cm\n", n, WATER_LEVEL_WINDOW,
+           WATER_LEVEL_MAX_RATE, WATER_LEVEL_NOISE);
+    printf("%-10s %10s %10s %8s %12s\n", "method", "rms cm", "worst cm", "flips", "ns/echo");
+
+    //single echo, fixed speed of sound: what Tsk1 did before
+    sq = worst = 0.0;
+    scored = flips = 0;
+    locked = 0;
+    for (i = 0; i < n; i++)
+    {
+        double cm = SENSOR_TO_FLOAT(sensor_echo_to_cm(trace[i].width));
+        if (trace[i].truth >= 0.0)
+        {
+            double e = fabs(cm - trace[i].truth);
+            sq += e * e;
+            worst = fmax(worst, e);
+            scored++;
+        }
+        if ((cm > WATER_LEVEL) != locked)
+        {
+            locked = !locked;
+            flips++;
+        }
+    }
+    t0 = now_ns();
+    for (pass = 0; pass < TIMING_PASSES; pass++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            sink = SENSOR_TO_FLOAT(sensor_echo_to_cm(trace[i].width));
+        }
+    }
+    report("raw", sq, worst, scored, flips, (now_ns() - t0) / (n * TIMING_PASSES));
+
+    //estimator: rate limited median window, temperature compensated
+    sq = worst = 0.0;
+    scored = flips = 0;
+    locked = 0;
+    water_level_init(&wl);
+    for (i = 0; i < n; i++)
+    {
+        double cm;
+
+        water_level_push(&wl, trace[i].width, trace[i].dt_ms);
+        cm = SENSOR_TO_FLOAT(water_level_cm(&wl, SENSOR(trace[i].temp)));
+        if (trace[i].truth >= 0.0)
+        {
+            double e = fabs(cm - trace[i].truth);
+            sq += e * e;
+            worst = fmax(worst, e);
+            scored++;
+        }
+        if ((cm > WATER_LEVEL) != locked)
+        {
+            locked = !locked;
+            flips++;
+        }
+    }
+    printf("# estimator accepted %lu, rejected %lu\n", (unsigned long)wl.accepted, (unsigned long)wl.rejected);
+    t0 = now_ns();
+    for (pass = 0; pass < TIMING_PASSES; pass++)
+    {
+        water_level_init(&wl);
+        for (i = 0; i < n; i++)
+        {
+            water_level_push(&wl, trace[i].width, trace[i].dt_ms);
+            sink = SENSOR_TO_FLOAT(water_level_cm(&wl, SENSOR(trace[i].temp)));
+        }
+    }
+    report("median", sq, worst, scored, flips, (now_ns() - t0) / (n * TIMING_PASSES));
+    return 0;
+}
@@ -0,0 +1,639 @@
+// Thie file contains the worst-case execution time harness for the interrupt level handlers and its schedulability report
+//
+// build: make wcet_harness wcet_harness_float
+// usage: wcet_harness [-n rounds] [-b rounds] [-k ratio] [-c cycles] [-o cycles] [-a hz] [-g app.cfg] [-p capture.bin] [-x]
+//   -n  timed rounds per input and call, default 256
+//   -b  rounds per batch, default 16; -n must be a multiple of it
+//   -k  C28x cycles per host counter count (TSC on x86, ns elsewhere), default 4, a guess; set
+//       it from bench_suite on both: target min / host min of the moisture and decimator cases
+//   -c  C28x cycles per SYS/BIOS call a handler makes, default 10: most are Hwi_disable/restore
+//       and Timestamp_get32 at a few cycles, Swi_post and Semaphore_post cost about a hundred
+//   -o  C28x cycles the Hwi or Swi dispatcher adds to every run, default 120
+//   -a  Timer1 (ADC trigger) rate to analyse instead of the app.cfg period, Hz
+//   -g  app.cfg to analyse, default ../app.cfg
+//   -p  profile dump of the target ('P' on SCIB): the max of the hwi, swi and ecap probes
+//       replaces the host estimate of myHwi, mySwiFxn and ECAP_ISR
+//   -x  exit 1 on a deadline miss (the gate); without it a miss is only reported
+//
+// The same firmware objects as firmware_host run for a virtual second so main() and every task
+// have initialised, then myTickFxn (Timer0), myHwi, ECAP_ISR and mySwiFxn are called directly,
+// inside the app.cfg Hwi/Swi hooks, with adversarial register contents: ADC bursts of 0, 1,
+// 4095 and alternating codes, a zero moisture code (1 / volts on the MOISTURE_LUT=0 path of
+// wcet_harness_float), codes at the table's saturation and the pump threshold, eCAP widths of
+// 0, a 38 ms no-echo pulse and 0xFFFFFFFF, the tick that posts mySem and the UInt16 wrap.
+// mySwiFxn is called MOISTURE_CIC_RATIO * MOISTURE_FIR_RATIO * MOISTURE_AGGREGATE times per
+// input so every decimator stage fires on one of the calls. The rounds of a call are cut into
+// batches of -b; a batch's time is its fastest round and the call's time its slowest batch. A
+// preemption of the host lands in a round or two and not in every round of a batch, so it
+// drops out, while a path that is slow on every run stays in. The slowest single round, host
+// noise included, is printed next to it and not used. An input's time is its slowest call and
+// the handler's WCET its slowest input. The estimate in C28x cycles is ratio * host counts +
+// kernel calls * -c + -o. Denormals cannot reach these paths: every input is an integer
+// register, the smallest non-zero probe voltage is 0.73 mV, and FPU32 flushes them anyway.
+//
+// The report runs a response time analysis over the periodic interrupt level work: Timer0,
+// the Clock Hwi and Swi, myHwi and Swi0 at the Timer1 rate, ECAP_ISR every two ranging
+// periods. c28 Hwis nest (maskSetting SELF), so every other Hwi can preempt a Hwi and every
+// Hwi and higher Swi preempts Swi0. Deadlines are the next overwrite of what a handler reads:
+// the next tick, the next ADC burst, the next eCAP capture. I2C-B and SCIB interrupts are
+// sporadic and left out, as are Hwi_disable sections in tasks. The result is only as good as
+// -k and the other estimates; -p with a target dump replaces them for myHwi, mySwiFxn and
+// ECAP_ISR. With -x it exits 1 on a deadline miss.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "shim/shim.h"
+#include "sim/sim.h"
+#include "cfg_parse.h"
+#include "profile_decode.h"
+#include "../adc_config.h"
+#include "../sensor_math.h"
+#include "../ultrasonic.h"
+#include <Headers/F2837xD_device.h>
+
+#define USAGE "usage: %s [-n rounds] [-b rounds] [-k ratio] [-c cycles] [-o cycles] [-a hz] [-g app.cfg] [-p capture.bin] [-x]\n"
+
+#define DEFAULT_ROUNDS 256
+#define DEFAULT_BATCH 16
+#define DEFAULT_RATIO 4.0        //rough, see -k
+#define DEFAULT_CALL_CYCLES 10
+#define DEFAULT_DISPATCH_CYCLES 120
+#define WARMUP_SECONDS 1.0
+#define SWI_CALLS (MOISTURE_CIC_RATIO * MOISTURE_FIR_RATIO * MOISTURE_AGGREGATE)
+#define INPUTS 8
+#define ECHO_TIMEOUT_COUNTS 7600000UL //38 ms at 200 MHz, the HC-SR04's no-echo pulse
+#define THREADS 8
+
+extern Int firmware_main();
+extern Void myTickFxn(UArg arg);
+extern Void myHwi(Void);
+extern Void ECAP_ISR(UArg arg);
+extern Void mySwiFxn(Void);
+extern volatile UInt16 tickCount;
+extern int init;
+extern volatile uint16_t moisture_adc_code;
+extern sensor_t water_content;
+extern const Swi_Handle Swi0;
+extern const Hwi_Handle hwi0;
+extern const Hwi_Handle hwi1;
+
+typedef struct
+{
+    const char *fxn;
+    const char *inputs[INPUTS];  //NULL after the last
+    void (*load)(uint16_t input);
+    void (*run)(void);
+    uint16_t calls;              //calls per input and round
+    //results
+    double counts[INPUTS];       //slowest call, slowest batch of its rounds
+    double noisy[INPUTS];        //slowest single run
+    uint32_t kernel[INPUTS];     //SYS/BIOS calls on the slowest path
+    char result[INPUTS][32];     //what the handler made of the input
+    double cycles;               //estimate of the slowest input
+    uint16_t worst;
+} handler_t;
+
+typedef struct
+{
+    const char *name;
+    const char *fxn;
+    int swi;                     //0 Hwi level, else Swi priority + 1
+    double period;               //cycles
+    double deadline;
+    double cycles;               //WCET
+    const char *source;
+    double response;
+} thread_t;
+
+static double ratio = DEFAULT_RATIO;
+static uint32_t call_cycles = DEFAULT_CALL_CYCLES;
+static uint32_t dispatch_cycles = DEFAULT_DISPATCH_CYCLES;
+static double counter_floor;
+static long batch = DEFAULT_BATCH;
+
+static uint64_t host_counter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/* ======== handlers and their inputs ======== */
+static void hwi_hooks(Hwi_Handle hwi, int end)
+{
+    uint16_t i;
+
+    for (i = 0; i < shim_app.hwi_hook_count; i++)
+    {
+        (end ? shim_app.hwi_hooks[i].endFxn : shim_app.hwi_hooks[i].beginFxn)(hwi);
+    }
+}
+
+static void run_tick(void)
+{
+    hwi_hooks(NULL, 0); //the Timer0 Hwi is BIOS's own, the hooks see an unknown handle
+    myTickFxn(0);
+    hwi_hooks(NULL, 1);
+}
+
+static void run_adc(void)
+{
+    hwi_hooks(hwi0, 0);
+    myHwi();
+    hwi_hooks(hwi0, 1);
+}
+
+static void run_ecap(void)
+{
+    hwi_hooks(hwi1, 0);
+    ECAP_ISR(0);
+    hwi_hooks(hwi1, 1);
+}
+
+static void run_swi(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < shim_app.swi_hook_count; i++)
+    {
+        shim_app.swi_hooks[i].beginFxn(Swi0);
+    }
+    mySwiFxn();
+    for (i = 0; i < shim_app.swi_hook_count; i++)
+    {
+        shim_app.swi_hooks[i].endFxn(Swi0);
+    }
+}
+
+static void load_tick(uint16_t input)
+{
+    static const UInt16 counts[] = { 1, 9999, 65535, 9999 };
+
+    tickCount = counts[input]; //9999: this tick posts mySem, 65535: wraps to 0 and posts it too
+    init = (input != 3);       //the first tick also posts mySem2
+}
+
+static void load_adc(uint16_t input)
+{
+    volatile Uint16 *result = &AdcaResultRegs.ADCRESULT0;
+    uint16_t i;
+
+    for (i = 0; i < ADC_OVERSAMPLE; i++)
+    {
+        static const uint16_t codes[][2] = { { 0, 0 }, { 1, 1 }, { 4095, 4095 }, { 0, 4095 } };
+        result[i] = (input < 4) ? codes[input][i & 1] : (uint16_t)(4095UL * i / ADC_OVERSAMPLE);
+    }
+    AdcaRegs.ADCINTFLG.bit.ADCINT1 = 1;
+}
+
+static void load_ecap(uint16_t input)
+{
+    static const uint32_t widths[] = { 0, 116000UL, ECHO_TIMEOUT_COUNTS, 0xFFFFFFFFUL };
+
+    ECap1Regs.CAP2 = widths[input];
+    ECap1Regs.CAP4 = widths[input];
+    ECap1Regs.ECFLG.all = 0x1F; //CEVT1..4 and INT
+}
+
+//zero reading, first code off the table's saturation, a dry and a wet probe outside the
+//28 % / 32 % pump hysteresis, full scale
+static const uint16_t swi_codes[] = { 0, 1, 11, 3200, 3400, 4095 };
+
+static void load_swi(uint16_t input)
+{
+    moisture_adc_code = swi_codes[input];
+    GpioDataRegs.GPASET.all = 0;
+    GpioDataRegs.GPACLEAR.all = 0;
+}
+
+static handler_t handlers[] = {
+    { "myTickFxn", { "tick", "post", "wrap", "first", NULL }, load_tick, run_tick, 1 },
+    { "myHwi", { "zero", "one", "full", "alternate", "ramp", NULL }, load_adc, run_adc, 1 },
+    { "ECAP_ISR", { "zero", "10cm", "timeout", "max", NULL }, load_ecap, run_ecap, 1 },
+    { "mySwiFxn", { "zero", "one", "saturate", "dry", "wet", "full", NULL }, load_swi, run_swi, SWI_CALLS },
+};
+#define HANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+static void describe(handler_t *h, uint16_t input)
+{
+    char *out = h->result[input];
+
+    if (h->load == load_adc)
+    {
+        snprintf(out, sizeof(h->result[0]), "code %u", (unsigned)moisture_adc_code);
+    }
+    else if (h->load == load_swi)
+    {
+        float water = SENSOR_TO_FLOAT(water_content);
+        snprintf(out, sizeof(h->result[0]), "%s%.2f %%, pump %s", isfinite(water) ? "" : "non-finite ",
+                 sensor_to_units(water_content, 100, -32768L, 32767L) / 100.0,
+                 GpioDataRegs.GPASET.bit.GPIO22 ? "on" : "off");
+    }
+    else
+    {
+        out[0] = '\0';
+    }
+}
+
+//the slowest of the batches of n rounds, each batch the fastest of its rounds
+static double slowest_batch(const double *counts, long n)
+{
+    double slowest = 0.0;
+    long first;
+    long i;
+
+    for (first = 0; first + batch <= n; first += batch)
+    {
+        double fastest = counts[first];
+        for (i = first + 1; i < first + batch; i++)
+        {
+            fastest = (counts[i] < fastest) ? counts[i] : fastest;
+        }
+        slowest = (fastest > slowest) ? fastest : slowest;
+    }
+    return slowest;
+}
+
+//timed runs of one handler, see the top of the file
+static void measure(handler_t *h, long rounds)
+{
+    double *counts_of = malloc(sizeof(double) * SWI_CALLS * (size_t)rounds); //[call][round]
+    uint16_t input;
+    uint16_t call;
+    long round;
+
+    if (counts_of == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    h->cycles = 0.0;
+    for (input = 0; (input < INPUTS) && (h->inputs[input] != NULL); input++)
+    {
+        for (call = 0; call < h->calls; call++)
+        {
+            h->load(input);
+            h->run(); //fills the windows, the decimator stays in step with the call number
+        }
+        h->noisy[input] = 0.0;
+        h->kernel[input] = 0;
+        for (round = 0; round < rounds; round++)
+        {
+            for (call = 0; call < h->calls; call++)
+            {
+                uint64_t virtual_start;
+                uint64_t start;
+                double counts;
+
+                h->load(input);
+                virtual_start = shim_now();
+                start = host_counter();
+                h->run();
+                counts = (double)(host_counter() - start) - counter_floor;
+                counts_of[call * rounds + round] = counts;
+                h->noisy[input] = (counts > h->noisy[input]) ? counts : h->noisy[input];
+                if (shim_now() - virtual_start > h->kernel[input])
+                {
+                    h->kernel[input] = (uint32_t)(shim_now() - virtual_start); //one cycle per call, see main
+                }
+            }
+        }
+        h->counts[input] = 0.0;
+        for (call = 0; call < h->calls; call++)
+        {
+            double counts = slowest_batch(&counts_of[call * rounds], rounds);
+            h->counts[input] = (counts > h->counts[input]) ? counts : h->counts[input];
+        }
+        describe(h, input);
+        {
+            double cycles = ratio * h->counts[input] + (double)h->kernel[input] * call_cycles + dispatch_cycles;
+            if (cycles > h->cycles)
+            {
+                h->cycles = cycles;
+                h->worst = input;
+            }
+        }
+    }
+    free(counts_of);
+}
+
+//two back to back counter reads, taken off every run
+static void measure_floor(void)
+{
+    long i;
+
+    counter_floor = HUGE_VAL;
+    for (i = 0; i < 100000; i++)
+    {
+        uint64_t start = host_counter();
+        double counts = (double)(host_counter() - start);
+        counter_floor = (counts < counter_floor) ? counts : counter_floor;
+    }
+}
+
+/* ======== schedulability ======== */
+//response time of t, preempted by every other Hwi and, for a Swi, by higher Swis
+static double response_time(const thread_t *threads, uint16_t count, uint16_t self)
+{
+    const thread_t *t = &threads[self];
+    double r = t->cycles;
+    double last = 0.0;
+
+    while ((r != last) && (r <= 1e3 * t->deadline))
+    {
+        uint16_t j;
+        last = r;
+        r = t->cycles;
+        for (j = 0; j < count; j++)
+        {
+            const thread_t *o = &threads[j];
+            if ((j != self) && ((o->swi == 0) || (o->swi > t->swi)) && ((t->swi != 0) || (o->swi == 0)))
+            {
+                r += ceil(last / o->period) * o->cycles;
+            }
+        }
+    }
+    return r;
+}
+
+//every deadline met at this Timer1 period, response times left in threads
+static int schedulable(thread_t *threads, uint16_t count, double adc_period)
+{
+    double utilisation = 0.0;
+    int ok = 1;
+    uint16_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((strcmp(threads[i].fxn, "myHwi") == 0) || (strcmp(threads[i].fxn, "mySwiFxn") == 0))
+        {
+            threads[i].period = adc_period;
+            threads[i].deadline = adc_period;
+        }
+        utilisation += threads[i].cycles / threads[i].period;
+    }
+    for (i = 0; i < count; i++)
+    {
+        threads[i].response = (utilisation < 1.0) ? response_time(threads, count, i) : HUGE_VAL;
+        ok &= threads[i].response <= threads[i].deadline;
+    }
+    return ok;
+}
+
+static const handler_t *find_handler(const char *fxn)
+{
+    uint16_t i;
+
+    for (i = 0; i < HANDLERS; i++)
+    {
+        if (strcmp(handlers[i].fxn, fxn) == 0)
+        {
+            return &handlers[i];
+        }
+    }
+    return NULL;
+}
+
+static int add_thread(thread_t *t, const cfg_t *cfg, cfg_kind_t kind, const char *fxn, double period, double deadline)
+{
+    const cfg_object_t *o = cfg_find_fxn(cfg, kind, fxn);
+    const handler_t *h = find_handler(fxn);
+
+    if (o == NULL)
+    {
+        fprintf(stderr, "app.cfg has no %s for %s\n", (kind == CFG_SWI) ? "Swi" : "Hwi", fxn);
+        return -1;
+    }
+    t->name = o->name;
+    t->fxn = fxn;
+    t->swi = (kind == CFG_SWI) ? (int)cfg_priority(cfg, o) + 1 : 0;
+    t->period = period;
+    t->deadline = deadline;
+    t->cycles = h->cycles;
+    t->source = "host";
+    return 0;
+}
+
+//the target's probe maxima, wall time with nesting included, instead of the estimates
+static int apply_capture(const char *path, thread_t *threads, uint16_t count)
+{
+    static profile_decoder_t dec;
+    static const struct
+    {
+        uint16_t probe;
+        const char *fxn;
+    } map[] = { { PROFILE_HWI, "myHwi" }, { PROFILE_SWI, "mySwiFxn" }, { PROFILE_ECAP, "ECAP_ISR" } };
+    FILE *in = fopen(path, "rb");
+    uint16_t i;
+    uint16_t j;
+    int c;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    profile_decoder_init(&dec);
+    while ((c = fgetc(in)) != EOF)
+    {
+        profile_decoder_push(&dec, (uint8_t)c);
+    }
+    fclose(in);
+    for (i = 0; i < sizeof(map) / sizeof(map[0]); i++)
+    {
+        if (!dec.seen[map[i].probe] || (dec.probe[map[i].probe].count == 0))
+        {
+            fprintf(stderr, "%s: no %s probe, keeping the host estimate of %s\n", path,
+                    profile_probe_names[map[i].probe], map[i].fxn);
+            continue;
+        }
+        for (j = 0; j < count; j++)
+        {
+            if (strcmp(threads[j].fxn, map[i].fxn) == 0)
+            {
+                threads[j].cycles = (double)dec.probe[map[i].probe].max + dispatch_cycles;
+                threads[j].source = "target";
+            }
+        }
+    }
+    return 0;
+}
+
+static void report(const cfg_t *cfg, thread_t *threads, uint16_t count, double adc_period)
+{
+    double us = cfg->cpu_hz / 1e6;
+    double utilisation = 0.0;
+    int ok = schedulable(threads, count, adc_period);
+    uint16_t i;
+
+    printf("\n%.0f MHz, Timer1 %.3f Hz, Clock %lu us, ranging %u Hz\n", cfg->cpu_hz / 1e6, cfg->cpu_hz / adc_period,
+           cfg->clock_tick_us, (unsigned)ULTRASONIC_RATE_HZ);
+    printf("%-9s %-10s %-6s %12s %12s %9s %9s %7s %12s %6s %s\n", "thread", "fxn", "level", "period us", "deadline us",
+           "WCET cyc", "WCET us", "U %", "response us", "", "from");
+    for (i = 0; i < count; i++)
+    {
+        const thread_t *t = &threads[i];
+        char level[16];
+
+        if (t->swi != 0)
+        {
+            snprintf(level, sizeof(level), "swi %d", t->swi - 1);
+        }
+        else
+        {
+            strcpy(level, "hwi");
+        }
+        utilisation += t->cycles / t->period;
+        printf("%-9s %-10s %-6s %12.1f %12.1f %9.0f %9.2f %7.3f %12.2f %6s %s\n", t->name, t->fxn, level,
+               t->period / us, t->deadline / us, t->cycles, t->cycles / us, 100.0 * t->cycles / t->period,
+               t->response / us, (t->response <= t->deadline) ? "ok" : "MISS", t->source);
+    }
+    printf("interrupt level utilisation %.2f %%, %s\n", 100.0 * utilisation,
+           ok ? "every deadline met" : "DEADLINE MISSED");
+}
+
+int main(int argc, char **argv)
+{
+    static cfg_t cfg;
+    thread_t threads[THREADS];
+    const char *cfg_path = "../app.cfg";
+    const char *capture = NULL;
+    const cfg_object_t *timer0;
+    const cfg_object_t *timer1;
+    double adc_hz = 0.0;
+    double adc_period;
+    double clock_period;
+    double ranging;
+    long rounds = DEFAULT_ROUNDS;
+    int gate = 0;
+    int missed = 0;
+    uint16_t count = 0;
+    uint16_t i;
+    uint16_t j;
+    int c;
+
+    while ((c = getopt(argc, argv, "n:b:k:c:o:a:g:p:x")) != -1)
+    {
+        switch (c)
+        {
+        case 'n':
+            rounds = strtol(optarg, NULL, 0);
+            break;
+        case 'b':
+            batch = strtol(optarg, NULL, 0);
+            break;
+        case 'k':
+            ratio = atof(optarg);
+            break;
+        case 'c':
+            call_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            dispatch_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'a':
+            adc_hz = atof(optarg);
+            break;
+        case 'g':
+            cfg_path = optarg;
+            break;
+        case 'p':
+            capture = optarg;
+            break;
+        case 'x':
+            gate = 1;
+            break;
+        default:
+            fprintf(stderr, USAGE, argv[0]);
+            return 2;
+        }
+    }
+    if ((batch < 1) || (rounds < batch) || (rounds % batch != 0) || (ratio <= 0.0) || (adc_hz < 0.0) || (optind != argc))
+    {
+        fprintf(stderr, USAGE, argv[0]);
+        return 2;
+    }
+    if (cfg_load(cfg_path, &cfg) != 0)
+    {
+        return 2;
+    }
+    timer0 = cfg_find_fxn(&cfg, CFG_TIMER, "myTickFxn");
+    timer1 = cfg_find_timer(&cfg, 1);
+    if ((timer0 == NULL) || (timer1 == NULL))
+    {
+        fprintf(stderr, "%s: no myTickFxn timer or no Timer1\n", cfg_path);
+        return 2;
+    }
+
+    if (shim_app_check() != 0)
+    {
+        return 2;
+    }
+
+    //the firmware as firmware_host runs it, then stopped with every thread initialised
+    shim_config.run_cycles = (uint64_t)(WARMUP_SECONDS * SHIM_CPU_HZ);
+    shim_config.call_cycles = 20;
+    sim_signal_set(SIM_A5, 3200);
+    sim_i2c_init();
+    sim_hcsr04_init();
+    sim_adc_init();
+    sim_sci_init(NULL, NULL);
+    firmware_main();
+    shim_config.call_cycles = 1; //virtual time now counts the kernel calls
+
+    measure_floor();
+    printf("%-10s %-10s %10s %10s %7s %10s  %s\n", "handler", "input", "counts", "max", "calls", "C28x est", "result");
+    for (i = 0; i < HANDLERS; i++)
+    {
+        handler_t *h = &handlers[i];
+
+        measure(h, rounds);
+        for (j = 0; (j < INPUTS) && (h->inputs[j] != NULL); j++)
+        {
+            printf("%-10s %-10s %10.1f %10.1f %7lu %10.0f  %s\n", h->fxn, h->inputs[j], h->counts[j], h->noisy[j],
+                   (unsigned long)h->kernel[j], ratio * h->counts[j] + (double)h->kernel[j] * call_cycles + dispatch_cycles,
+                   h->result[j]);
+        }
+    }
+    printf("counts: host counter, slowest call's slowest batch of %ld rounds, %ld batches (max: slowest single run, "
+           "not used)\n", batch, rounds / batch);
+    printf("C28x est = %.2f * counts + %u * calls + %u%s\n", ratio, (unsigned)call_cycles, (unsigned)dispatch_cycles,
+           (ratio == DEFAULT_RATIO) ? ", -k not given: the ratio is a guess, so are the verdicts below" : "");
+
+    adc_period = (adc_hz > 0.0) ? cfg.cpu_hz / adc_hz : cfg_timer_cycles(&cfg, timer1);
+    clock_period = (double)cfg.clock_tick_us * cfg.cpu_hz / 1e6;
+    ranging = (double)cfg.cpu_hz / ULTRASONIC_RATE_HZ;
+    if ((add_thread(&threads[count++], &cfg, CFG_HWI, "myHwi", adc_period, adc_period) != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_HWI, "ECAP_ISR", 2.0 * ranging, ranging) != 0) ||
+        (add_thread(&threads[count++], &cfg, CFG_SWI, "mySwiFxn", adc_period, adc_period) != 0))
+    {
+        return 2;
+    }
+    //Timer0 is a BIOS Timer Hwi, the Clock a Timer2 Hwi and the top priority Swi
+    threads[count++] = (thread_t){ timer0->name, "myTickFxn", 0, cfg_timer_cycles(&cfg, timer0),
+                                   cfg_timer_cycles(&cfg, timer0), find_handler("myTickFxn")->cycles, "host", 0.0 };
+    threads[count++] = (thread_t){ "Clock", "(tick)", 0, clock_period, clock_period, dispatch_cycles, "-o", 0.0 };
+    threads[count++] = (thread_t){ "Clock", "(swi)", (int)cfg.swi_priorities, clock_period, clock_period,
+                                   dispatch_cycles, "-o", 0.0 };
+    if ((capture != NULL) && (apply_capture(capture, threads, count) != 0))
+    {
+        return 2;
+    }
+    report(&cfg, threads, count, adc_period);
+    for (i = 0; i < count; i++)
+    {
+        missed |= threads[i].response > threads[i].deadline;
+    }
+    return (gate && missed) ? 1 : 0;
+}
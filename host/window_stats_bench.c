@@ -0,0 +1,148 @@
+// Thie file contains a host benchmark of the sliding window statistics engine (window_stats.h).
+//
+// build: cc -O2 -o window_stats_bench window_stats_bench.c ../window_stats.c -lm
+// usage: window_stats_bench [samples]
+//
+// For window sizes 8..1024 it pushes a random walk in 0.01 C (default 1000000 samples) and
+// reports host ns per push and per full query (mean, min, max, variance, median). The first
+// 20000 pushes of every size are checked against a brute force scan of the window. At the end
+// the float running sum the old temperature buffer used is run over the same stream to show
+// how far its mean drifts from the exact one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../window_stats.h"
+
+#define CHECKED 20000UL
+
+static int32_t storage[WINDOW_STATS_WORDS(WINDOW_STATS_MAX)];
+static int32_t *stream;
+static volatile int64_t sink; //keeps the timed loops from being optimised out
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int compare_int32(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a;
+    int32_t y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+//brute force over the last count samples of stream ending at end, 0 if everything matches
+static int check(const window_stats_t *ws, unsigned long end)
+{
+    static int32_t window[WINDOW_STATS_MAX];
+    unsigned long n = ws->count;
+    unsigned long i;
+    int64_t sum = 0;
+    int64_t squares = 0;
+    int32_t mean;
+    uint64_t variance;
+
+    memcpy(window, stream + end + 1 - n, n * sizeof(int32_t));
+    for (i = 0; i < n; i++)
+    {
+        sum += window[i];
+        squares += (int64_t)window[i] * window[i];
+    }
+    qsort(window, n, sizeof(int32_t), compare_int32);
+    mean = (int32_t)((sum >= 0) ? ((sum + (int64_t)(n / 2)) / (int64_t)n) : ((sum - (int64_t)(n / 2)) / (int64_t)n));
+    variance = (uint64_t)((int64_t)n * squares - sum * sum) / (uint64_t)(n * n);
+
+    return (window_stats_mean(ws) != mean) || (window_stats_min(ws) != window[0]) ||
+           (window_stats_max(ws) != window[n - 1]) || (window_stats_median(ws) != window[n / 2]) ||
+           (window_stats_variance(ws) != variance);
+}
+
+int main(int argc, char **argv)
+{
+    window_stats_t ws;
+    unsigned long samples = 1000000UL;
+    unsigned long i;
+    uint16_t window;
+    int failures = 0;
+    int32_t value = 2200; //22.00 C
+    float sum = 0.0f;
+    double t0;
+
+    if (argc == 2)
+    {
+        samples = strtoul(argv[1], NULL, 0);
+    }
+    if ((argc > 2) || (samples < CHECKED))
+    {
+        fprintf(stderr, "usage: %s [samples >= %lu]\n", argv[0], CHECKED);
+        return 1;
+    }
+    stream = malloc(samples * sizeof(int32_t));
+    if (stream == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (i = 0; i < samples; i++)
+    {
+        value += (rand() % 21) - 10 + (2200 - value) / 64; //random walk around 22 C, +-0.1 C per sample
+        stream[i] = value;
+    }
+
+    printf("%lu samples\n", samples);
+    printf("%8s %12s %12s %10s\n", "window", "ns/push", "ns/query", "check");
+    for (window = 8; window <= WINDOW_STATS_MAX; window *= 2)
+    {
+        double push_ns;
+        double query_ns;
+        int bad = 0;
+
+        window_stats_init(&ws, storage, window);
+        for (i = 0; i < CHECKED; i++)
+        {
+            window_stats_push(&ws, stream[i]);
+            bad |= check(&ws, i);
+        }
+        failures |= bad;
+
+        window_stats_init(&ws, storage, window);
+        t0 = now_ns();
+        for (i = 0; i < samples; i++)
+        {
+            window_stats_push(&ws, stream[i]);
+        }
+        push_ns = (now_ns() - t0) / samples;
+
+        t0 = now_ns();
+        for (i = 0; i < samples; i++)
+        {
+            sink += window_stats_mean(&ws) + window_stats_min(&ws) + window_stats_max(&ws) +
+                    (int64_t)window_stats_variance(&ws) + window_stats_median(&ws);
+            ws.sum += 1; //defeats hoisting of the query out of the loop, the state is not reused
+        }
+        query_ns = (now_ns() - t0) / samples;
+        printf("%8u %12.1f %12.1f %10s\n", window, push_ns, query_ns, bad ? "FAIL" : "ok");
+    }
+
+    //the old moving average: float ring of BUFFER_SIZE (64) with a running sum that is never rebuilt
+    window_stats_init(&ws, storage, 64);
+    for (i = 0; i < samples; i++)
+    {
+        if (i >= 64)
+        {
+            sum -= stream[i - 64] / 100.0f;
+        }
+        sum += stream[i] / 100.0f;
+        window_stats_push(&ws, stream[i]);
+    }
+    printf("window 64 mean after %lu samples: float running sum %.4f C, exact %.4f C\n", samples,
+           sum / 64.0f, window_stats_mean(&ws) / 100.0);
+
+    free(stream);
+    return failures;
+}
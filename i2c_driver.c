@@ -1,10 +1,51 @@
 // Author: Ken Huynh
-// Thie file contains the function that is used to configure and operate I2C driver 
+// Thie file contains the function that is used to configure and operate I2C driver
+// Transfers are queued on an interrupt-driven engine: the I2C-B FIFO interrupt moves
+// data and the basic I2C-B interrupt handles ARDY/SCD/NACK, so callers block on a
+// semaphore instead of polling XRDY/RRDY.
 
 #include "i2c_driver.h"
+#include "trace_bios.h"
+#include <ti/sysbios/hal/Hwi.h>
 
 #define DHT20_ADDRESS 0x38 // address for I2C temperature and humidity sensor
 
+//I2CMDR values used to kick off each phase (IRS and MST always set)
+#define I2C_MDR_IRS  0x0020
+#define I2C_MDR_TRX  0x0200
+#define I2C_MDR_MST  0x0400
+#define I2C_MDR_STP  0x0800
+#define I2C_MDR_STT  0x2000
+#define I2C_MDR_WRITE_STOP   (I2C_MDR_STT | I2C_MDR_STP | I2C_MDR_MST | I2C_MDR_TRX | I2C_MDR_IRS)
+#define I2C_MDR_WRITE_NOSTOP (I2C_MDR_STT | I2C_MDR_MST | I2C_MDR_TRX | I2C_MDR_IRS) //ARDY fires when I2CCNT hits 0
+#define I2C_MDR_READ_STOP    (I2C_MDR_STT | I2C_MDR_STP | I2C_MDR_MST | I2C_MDR_IRS)
+
+//I2CISRC interrupt codes
+#define I2C_INT_ARBL 1
+#define I2C_INT_NACK 2
+#define I2C_INT_ARDY 3
+#define I2C_INT_SCD  6
+
+//I2CSTR write-1-to-clear masks
+#define I2C_STR_ARBL 0x0001
+#define I2C_STR_NACK 0x0002
+#define I2C_STR_ARDY 0x0004
+
+//Semaphore handle defined in .cfg File:
+extern const Semaphore_Handle i2cSem; //completion of blocking transfers
+
+//engine state, only touched by the ISRs or with interrupts disabled
+static i2c_txn_t *i2c_queue[I2C_QUEUE_DEPTH];
+static volatile uint16_t i2c_q_head = 0;
+static volatile uint16_t i2c_q_count = 0;
+static i2c_txn_t *volatile i2c_active = NULL;
+static uint16_t i2c_tx_idx;
+static uint16_t i2c_rx_idx;
+static Bool i2c_rx_phase;
+static i2c_status_t i2c_error; //error latched until the STOP completes the transaction
+
+static void i2c_start_next(void);
+
 void start_i2c()
 {
     EALLOW;
@@ -37,11 +78,22 @@ void start_i2c()
     I2cbRegs.I2CMDR.bit.BC = 0; //8-bits transmission (look at the sensor data sheet to check how many bits per data send)
     //System_printf("i2c initialized\n");
 
-    //disable FIFO
-    I2cbRegs.I2CFFTX.bit.I2CFFEN = 0;
-    I2cbRegs.I2CFFTX.bit.TXFFRST = 0;
-    I2cbRegs.I2CFFRX.bit.RXFFRST = 0;
-    //System_printf("FIFO disabled\n");
+    //enable FIFO, interrupts are switched on per transaction
+    I2cbRegs.I2CFFTX.all = 0;
+    I2cbRegs.I2CFFRX.all = 0;
+    I2cbRegs.I2CFFTX.bit.I2CFFEN = 1;
+    I2cbRegs.I2CFFTX.bit.TXFFIL = I2C_TX_FIFO_LEVEL;
+    I2cbRegs.I2CFFTX.bit.TXFFRST = 1;
+    I2cbRegs.I2CFFRX.bit.RXFFRST = 1;
+    I2cbRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+    I2cbRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+
+    //basic interrupt only reports bus events, data moves through the FIFO interrupt
+    I2cbRegs.I2CIER.all = 0;
+    I2cbRegs.I2CIER.bit.ARBL = 1;
+    I2cbRegs.I2CIER.bit.NACK = 1;
+    I2cbRegs.I2CIER.bit.ARDY = 1;
+    I2cbRegs.I2CIER.bit.SCD = 1;
 
     I2cbRegs.I2CMDR.bit.IRS = 1; //I2C IRS enable
     //System_printf("IRS enabled for i2c\n");
@@ -49,69 +101,191 @@ void start_i2c()
     EDIS;
 }
 
-bool i2c_master_transmit(UInt8 dev_addr, UInt8 *commands, uint16_t length)
+//copy as many pending bytes as the TX FIFO will take
+static void i2c_fill_tx_fifo(i2c_txn_t *txn)
 {
-    uint16_t i = 0;
-    bool success = false;
-    //To make sure master is in transmitter mode after receiving data
-    I2cbRegs.I2CMDR.bit.MST = 1; //Master mode
-    I2cbRegs.I2CMDR.bit.TRX = 1; //Transmitter
-    I2cbRegs.I2CSAR.bit.SAR = dev_addr; //configure the sensor address
-    I2cbRegs.I2CCNT = length; //set up the length of data
-    //length of data
-
-    I2cbRegs.I2CMDR.bit.STT = 1; //Start condition toggle (also send the device address)
+    while ((i2c_tx_idx < txn->tx_len) && (I2cbRegs.I2CFFTX.bit.TXFFST < I2C_FIFO_DEPTH))
+    {
+        I2cbRegs.I2CDXR.all = txn->tx_data[i2c_tx_idx++];
+    }
+}
 
-    if(length == 0)
+//empty the RX FIFO into the caller's buffer
+static void i2c_drain_rx_fifo(i2c_txn_t *txn)
+{
+    while (I2cbRegs.I2CFFRX.bit.RXFFST > 0)
     {
-        //check that address has been sent
-        while (!I2cbRegs.I2CSTR.bit.XRDY)
+        UInt8 byte = (UInt8) (I2cbRegs.I2CDRR.all & 0xFF);
+        if (i2c_rx_idx < txn->rx_len)
         {
-            if (I2cbRegs.I2CSTR.bit.NACK) //check for nack
-            {
-                I2cbRegs.I2CSTR.bit.NACK = 1;
-                I2cbRegs.I2CSTR.bit.XRDY = 1;
-                I2cbRegs.I2CMDR.bit.STP = 1; //stop condition toggle
-                return false;
-            }
+            txn->rx_data[i2c_rx_idx++] = byte;
         }
     }
+}
+
+static uint16_t i2c_rx_level(i2c_txn_t *txn)
+{
+    uint16_t remaining = txn->rx_len - i2c_rx_idx;
+    return (remaining > I2C_FIFO_DEPTH) ? I2C_FIFO_DEPTH : remaining;
+}
+
+static void i2c_start_tx(i2c_txn_t *txn)
+{
+    i2c_rx_phase = FALSE;
+    I2cbRegs.I2CCNT = txn->tx_len;
+    i2c_fill_tx_fifo(txn);
+    I2cbRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+    I2cbRegs.I2CFFTX.bit.TXFFIENA = (i2c_tx_idx < txn->tx_len) ? 1 : 0; //only needed for frames longer than the FIFO
+    I2cbRegs.I2CMDR.all = (txn->rx_len > 0) ? I2C_MDR_WRITE_NOSTOP : I2C_MDR_WRITE_STOP;
+}
+
+static void i2c_start_rx(i2c_txn_t *txn)
+{
+    i2c_rx_phase = TRUE;
+    I2cbRegs.I2CCNT = txn->rx_len;
+    I2cbRegs.I2CFFRX.bit.RXFFIL = i2c_rx_level(txn);
+    I2cbRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+    I2cbRegs.I2CFFRX.bit.RXFFIENA = 1;
+    I2cbRegs.I2CMDR.all = I2C_MDR_READ_STOP; //(repeated) START, hardware NACKs the last byte
+}
+
+//retire the active transaction and start the next queued one
+static void i2c_complete(i2c_status_t status)
+{
+    i2c_txn_t *txn = i2c_active;
+
+    I2cbRegs.I2CFFTX.bit.TXFFIENA = 0;
+    I2cbRegs.I2CFFRX.bit.RXFFIENA = 0;
+
+    i2c_queue[i2c_q_head] = NULL;
+    i2c_q_head = (i2c_q_head + 1) % I2C_QUEUE_DEPTH;
+    i2c_q_count--;
+    i2c_active = NULL;
+
+    txn->status = status;
+    if (txn->done != NULL)
+    {
+        trace_sem_post(txn->done);
+    }
+    i2c_start_next();
+}
+
+static void i2c_start_next(void)
+{
+    i2c_txn_t *txn;
+
+    if (i2c_q_count == 0)
+    {
+        return;
+    }
+    txn = i2c_queue[i2c_q_head];
+    i2c_active = txn;
+    i2c_tx_idx = 0;
+    i2c_rx_idx = 0;
+    i2c_error = I2C_PENDING;
+    I2cbRegs.I2CSAR.bit.SAR = txn->dev_addr; //configure the sensor address
+
+    if (txn->tx_len > 0)
+    {
+        i2c_start_tx(txn);
+    }
     else
     {
-        for (i = 0; i < length; i++)
-        {
+        i2c_start_rx(txn);
+    }
+}
 
-            success = i2c_send_byte(commands[i]); //loop through the command array
-            if (success == false)
-            {
-                return false;
-            }
-        }
+bool i2c_submit(i2c_txn_t *txn)
+{
+    UInt key;
+
+    if ((txn->tx_len == 0) && (txn->rx_len == 0))
+    {
+        return false; //I2CCNT = 0 means 65536 bytes in non-repeat mode
     }
+    txn->status = I2C_PENDING;
 
-    I2cbRegs.I2CMDR.bit.STP = 1; //stop condition toggle
+    key = Hwi_disable();
+    if (i2c_q_count == I2C_QUEUE_DEPTH)
+    {
+        Hwi_restore(key);
+        txn->status = I2C_QUEUE_FULL;
+        return false;
+    }
+    i2c_queue[(i2c_q_head + i2c_q_count) % I2C_QUEUE_DEPTH] = txn;
+    i2c_q_count++;
+    if (i2c_active == NULL)
+    {
+        i2c_start_next(); //engine idle, start on the bus now
+    }
+    Hwi_restore(key);
     return true;
 }
 
-bool i2c_send_byte(UInt8 byte)
+void i2c_abort(void)
 {
-    while (!I2cbRegs.I2CSTR.bit.XRDY) //check for transmit-data-ready interrupt enable
+    UInt key = Hwi_disable();
+
+    I2cbRegs.I2CMDR.bit.IRS = 0; //module reset releases the bus and clears the flags
+    I2cbRegs.I2CFFTX.bit.TXFFIENA = 0;
+    I2cbRegs.I2CFFRX.bit.RXFFIENA = 0;
+    I2cbRegs.I2CFFTX.bit.TXFFRST = 0;
+    I2cbRegs.I2CFFRX.bit.RXFFRST = 0;
+    I2cbRegs.I2CFFTX.bit.TXFFRST = 1;
+    I2cbRegs.I2CFFRX.bit.RXFFRST = 1;
+    I2cbRegs.I2CMDR.bit.IRS = 1;
+
+    while (i2c_q_count > 0)
     {
+        i2c_txn_t *txn = i2c_queue[i2c_q_head];
+        i2c_queue[i2c_q_head] = NULL;
+        i2c_q_head = (i2c_q_head + 1) % I2C_QUEUE_DEPTH;
+        i2c_q_count--;
+        txn->status = I2C_TIMEOUT;
+        if (txn->done != NULL)
+        {
+            trace_sem_post(txn->done);
+        }
+    }
+    i2c_active = NULL;
+    Hwi_restore(key);
+}
 
-        if (I2cbRegs.I2CSTR.bit.NACK) //check for nack
+i2c_status_t i2c_wait(i2c_txn_t *txn, UInt32 timeout)
+{
+    while (txn->status == I2C_PENDING)
+    {
+        if (!trace_sem_pend(txn->done, timeout))
         {
-            I2cbRegs.I2CSTR.bit.NACK = 1;
-            I2cbRegs.I2CSTR.bit.XRDY = 1;
-            I2cbRegs.I2CMDR.bit.STP = 1; //stop condition toggle
-            return false;
+            i2c_abort(); //stuck bus, recover instead of hanging the task
         }
     }
+    return txn->status;
+}
 
-    I2cbRegs.I2CDXR.bit.DATA = byte;
+i2c_status_t i2c_transfer(UInt8 dev_addr, const UInt8 *tx_data, uint16_t tx_len, UInt8 *rx_data, uint16_t rx_len)
+{
+    i2c_txn_t txn;
 
-    return true;
+    txn.dev_addr = dev_addr;
+    txn.tx_data = tx_data;
+    txn.tx_len = tx_len;
+    txn.rx_data = rx_data;
+    txn.rx_len = rx_len;
+    txn.done = i2cSem;
 
+    if (!i2c_submit(&txn))
+    {
+        return txn.status;
+    }
+    return i2c_wait(&txn, I2C_TIMEOUT_TICKS);
 }
+
+bool i2c_master_transmit(UInt8 dev_addr, UInt8 *commands, uint16_t length)
+{
+    return i2c_transfer(dev_addr, commands, length, NULL, 0) == I2C_OK;
+}
+
 bool resetRegister(UInt8 reg)
 {
     UInt8 value[3];
@@ -125,49 +299,98 @@ bool resetRegister(UInt8 reg)
     i2c_master_transmit(DHT20_ADDRESS,data1,length);
     return true;
 }
-bool i2c_received_byte(UInt8 *byte)
+
+bool i2c_master_receive(UInt8 dev_addr, UInt8 *data_received, uint16_t length)
 {
-    while (!I2cbRegs.I2CSTR.bit.RRDY) //check for receive-data-ready interrupt enable
-    {
-        if (I2cbRegs.I2CSTR.bit.NACK) //check for nack (gets stuck here)
-        {
-            I2cbRegs.I2CSTR.bit.NACK = 1;
-            I2cbRegs.I2CSTR.bit.RRDY = 1;
-            I2cbRegs.I2CMDR.bit.STP = 1; //stop condition toggle
-            return false;
-        }
-    }
-    *byte = (UInt8) I2cbRegs.I2CDRR.bit.DATA;
-    return true;
+    return i2c_transfer(dev_addr, NULL, 0, data_received, length) == I2C_OK;
 }
-bool i2c_master_receive(UInt8 dev_addr, UInt8 *data_received, uint16_t length)
+
+/* ======== I2CB_ISR ======== */
+//HWI configured ISR for I2C-B bus events (arbitration, NACK, register-access-ready, STOP)
+Void I2CB_ISR(UArg arg)
 {
-    bool success = false;
-    uint16_t i = 0;
+    uint16_t intcode = I2cbRegs.I2CISRC.bit.INTCODE; //reading I2CISRC clears the reported flag
+    i2c_txn_t *txn = i2c_active;
 
-    //To make sure master is in transmitter mode after receiving data
-    I2cbRegs.I2CMDR.bit.MST = 1; //Master mode
-    I2cbRegs.I2CMDR.bit.TRX = 0; //Receiver mode
+    if (txn == NULL)
+    {
+        return;
+    }
 
-    I2cbRegs.I2CSAR.bit.SAR = dev_addr;
-    I2cbRegs.I2CCNT = length;
-    //length of data
+    switch (intcode)
+    {
+    case I2C_INT_NACK:
+        I2cbRegs.I2CMDR.bit.STP = 1; //release the bus, SCD completes the transaction
+        I2cbRegs.I2CSTR.all = I2C_STR_NACK;
+        I2cbRegs.I2CFFTX.bit.TXFFRST = 0; //discard bytes the device refused
+        I2cbRegs.I2CFFTX.bit.TXFFRST = 1;
+        i2c_error = I2C_NACK;
+        break;
 
-    I2cbRegs.I2CMDR.bit.STT = 1; //Start condition toggle (also send the device address)
+    case I2C_INT_ARBL:
+        I2cbRegs.I2CSTR.all = I2C_STR_ARBL;
+        i2c_complete(I2C_ARB_LOST); //no STOP of our own will follow
+        break;
 
-    for (i = 0; i < length; i++)
-    {
-        success = i2c_received_byte(data_received + i); //loop through the command array
-        if (success == false)
+    case I2C_INT_ARDY:
+        //write phase of a write-then-read finished without STOP: repeated START into the read
+        I2cbRegs.I2CSTR.all = I2C_STR_ARDY;
+        if (!i2c_rx_phase && (i2c_error == I2C_PENDING) && (txn->rx_len > 0))
+        {
+            i2c_start_rx(txn);
+        }
+        break;
+
+    case I2C_INT_SCD:
+        if (i2c_rx_phase)
         {
-            return false;
+            i2c_drain_rx_fifo(txn); //bytes below the FIFO level arrive with the STOP
         }
-        // If it's the last byte, send NACK before stopping
-        if (i == (length - 2)){
-            I2caRegs.I2CMDR.bit.NACKMOD = 1;
+        if ((i2c_error == I2C_PENDING) && i2c_rx_phase && (i2c_rx_idx < txn->rx_len))
+        {
+            i2c_error = I2C_NACK; //STOP before all bytes arrived
         }
+        i2c_complete((i2c_error == I2C_PENDING) ? I2C_OK : i2c_error);
+        break;
+
+    default:
+        break;
     }
-    return true; //missing (check with ken later)
 }
 
+/* ======== I2CB_FIFO_ISR ======== */
+//HWI configured ISR for the I2C-B FIFO levels, moves data between the FIFOs and the active transaction
+Void I2CB_FIFO_ISR(UArg arg)
+{
+    i2c_txn_t *txn = i2c_active;
+
+    if (I2cbRegs.I2CFFRX.bit.RXFFINT)
+    {
+        if (txn != NULL)
+        {
+            i2c_drain_rx_fifo(txn);
+            if (i2c_rx_idx < txn->rx_len)
+            {
+                I2cbRegs.I2CFFRX.bit.RXFFIL = i2c_rx_level(txn);
+            }
+            else
+            {
+                I2cbRegs.I2CFFRX.bit.RXFFIENA = 0; //everything in, wait for SCD
+            }
+        }
+        I2cbRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+    }
 
+    if (I2cbRegs.I2CFFTX.bit.TXFFINT)
+    {
+        if (txn != NULL)
+        {
+            i2c_fill_tx_fifo(txn);
+            if (i2c_tx_idx >= txn->tx_len)
+            {
+                I2cbRegs.I2CFFTX.bit.TXFFIENA = 0;
+            }
+        }
+        I2cbRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+    }
+}
@@ -1,11 +1,15 @@
+
 #ifndef I2C_DRIVER_H_
 #define I2C_DRIVER_H_
 
-#endif /* I2C_DRIVER_H_ */
-
 #define DHT20_ADDR 0x38     //consult data sheet
 #define DHT20_SCLK 100000UL //UL = Unsigned long
 
+#define I2C_FIFO_DEPTH 16      //I2C-B hardware FIFO depth (TX and RX)
+#define I2C_TX_FIFO_LEVEL 4    //refill TX FIFO once it drains to this many words
+#define I2C_QUEUE_DEPTH 4      //number of transactions that can be queued on the engine
+#define I2C_TIMEOUT_TICKS 50   //Clock ticks to wait for a transaction before resetting the bus
+
 //C standard library includes
 #include <ctype.h>
 
@@ -14,15 +18,48 @@
 #include <xdc/runtime/System.h>
 #include <ti/sysbios/BIOS.h>
 #include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Semaphore.h>
 #include <xdc/std.h>
 
+//result of a queued transaction
+typedef enum
+{
+    I2C_PENDING = 0,   //queued or on the bus
+    I2C_OK,            //completed with STOP
+    I2C_NACK,          //device did not acknowledge
+    I2C_ARB_LOST,      //lost arbitration to another master
+    I2C_TIMEOUT,       //engine was reset after I2C_TIMEOUT_TICKS
+    I2C_QUEUE_FULL     //rejected, queue already holds I2C_QUEUE_DEPTH transactions
+} i2c_status_t;
+
+//One bus transaction. tx_len > 0 and rx_len > 0 gives a write-then-read with a
+//repeated START between the phases; either length may be 0 for a plain read/write.
+typedef struct i2c_txn
+{
+    UInt8 dev_addr;
+    const UInt8 *tx_data;
+    uint16_t tx_len;
+    UInt8 *rx_data;
+    uint16_t rx_len;
+    Semaphore_Handle done;          //posted from the ISR on completion (may be NULL)
+    volatile i2c_status_t status;
+} i2c_txn_t;
 
 void start_i2c();
 
+//interrupt-driven engine
+bool i2c_submit(i2c_txn_t *txn); //queue a transaction, returns immediately
+i2c_status_t i2c_wait(i2c_txn_t *txn, UInt32 timeout); //pend on txn->done (must be set) until the transaction completes
+i2c_status_t i2c_transfer(UInt8 dev_addr, const UInt8 *tx_data, uint16_t tx_len, UInt8 *rx_data, uint16_t rx_len);
+void i2c_abort(void); //reset the module and fail everything queued
+
+//blocking helpers built on i2c_transfer()
 bool resetRegister(UInt8 reg); //DB
 bool i2c_master_transmit(UInt8 dev_addr, UInt8 *commands, uint16_t length);
-bool i2c_send_byte(UInt8 byte);
 bool i2c_master_receive(UInt8 dev_addr, UInt8 *data_received, uint16_t length);
-bool i2c_receive_byte(UInt8 *byte);
 
+//I2C-B interrupt handlers, attached in app.cfg
+Void I2CB_ISR(UArg arg);
+Void I2CB_FIFO_ISR(UArg arg);
 
+#endif /* I2C_DRIVER_H_ */
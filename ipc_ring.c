@@ -0,0 +1,51 @@
+// Thie file contains the CPU1 -> CPU2 sample ring described in ipc_ring.h
+// Shared by both CPU images and the host tools.
+
+#include "ipc_ring.h"
+
+void ipc_ring_tx_init(ipc_ring_tx_t *tx)
+{
+    tx->write_count = 0;
+    tx->dropped = 0;
+}
+
+void ipc_ring_rx_init(ipc_ring_rx_t *rx)
+{
+    rx->read_count = 0;
+}
+
+uint32_t ipc_ring_count(const ipc_ring_tx_t *tx, const ipc_ring_rx_t *rx)
+{
+    return tx->write_count - rx->read_count; //counts wrap together
+}
+
+bool ipc_ring_push(ipc_ring_tx_t *tx, const ipc_ring_rx_t *rx, const ipc_msg_t *msg)
+{
+    uint32_t head = tx->write_count;
+
+    if ((head - rx->read_count) >= IPC_RING_DEPTH)
+    {
+        tx->dropped++;
+        return false;
+    }
+    IPC_RING_BARRIER(); //the slot is free only once read_count has been seen
+    tx->slot[head & IPC_RING_MASK] = *msg;
+    IPC_RING_BARRIER(); //record lands before the count that publishes it
+    tx->write_count = head + 1U;
+    return true;
+}
+
+bool ipc_ring_pop(const ipc_ring_tx_t *tx, ipc_ring_rx_t *rx, ipc_msg_t *msg)
+{
+    uint32_t tail = rx->read_count;
+
+    if (tx->write_count == tail)
+    {
+        return false;
+    }
+    IPC_RING_BARRIER(); //read the record only after its count
+    *msg = tx->slot[tail & IPC_RING_MASK];
+    IPC_RING_BARRIER(); //finish the copy before handing the slot back
+    rx->read_count = tail + 1U;
+    return true;
+}
@@ -0,0 +1,71 @@
+/*
+ * ipc_ring.h
+ *
+ * Single-producer single-consumer ring that carries sample records from CPU1 to CPU2.
+ * The ring is split by owner because each F28379D core can only write its own RAM:
+ *   ipc_ring_tx_t  slots + write count, written by CPU1 only (GS RAM owned by CPU1)
+ *   ipc_ring_rx_t  read count, written by CPU2 only (CPU2TOCPU1 message RAM)
+ * Both counts run freely and are only ever written by their owner, so no lock is needed.
+ * A slot is copied in full before the write count moves past it and is not reused before
+ * the read count moves past it, so a reader never sees a half written record.
+ * Plain C, no TI includes, so the same code builds on the host.
+ */
+
+#ifndef IPC_RING_H_
+#define IPC_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "telemetry.h"
+
+#define IPC_RING_DEPTH 16U //slots, power of two
+#define IPC_RING_MASK (IPC_RING_DEPTH - 1U)
+
+#define IPC_RING_TX_ADDR 0x00E000UL //RAMGS2, fixed in both linker files
+#define IPC_RING_RX_ADDR 0x03F800UL //start of CPU2TOCPU1RAM
+
+//The C28x cores have no cache and complete stores in order, volatile is enough there.
+//Weakly ordered hosts need a real fence between a record and its count.
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+#define IPC_RING_BARRIER() __sync_synchronize()
+#else
+#define IPC_RING_BARRIER()
+#endif
+
+//message types
+#define IPC_MSG_SAMPLE 1 //one telemetry sample for CPU2 to encode and send
+
+//IPC flags used next to the ring
+#define IPC_FLAG_SAMPLE 1      //CPU1 -> CPU2: records were published (PIE 1.14 on CPU2)
+#define IPC_FLAG_CPU2_READY 2  //CPU2 -> CPU1: read count initialised, left set while CPU2 runs
+
+typedef struct
+{
+    uint16_t type;
+    uint16_t reserved;
+    telemetry_sample_t sample;
+} ipc_msg_t;
+
+typedef struct
+{
+    volatile uint32_t write_count; //records published
+    volatile uint32_t dropped;     //pushes refused because the ring was full
+    volatile ipc_msg_t slot[IPC_RING_DEPTH];
+} ipc_ring_tx_t;
+
+typedef struct
+{
+    volatile uint32_t read_count; //records consumed
+} ipc_ring_rx_t;
+
+void ipc_ring_tx_init(ipc_ring_tx_t *tx); //CPU1, before CPU2 is started
+void ipc_ring_rx_init(ipc_ring_rx_t *rx); //CPU2, before it enables the IPC interrupt
+
+//CPU1: copy msg into the ring, false (and dropped++) when CPU2 is IPC_RING_DEPTH behind
+bool ipc_ring_push(ipc_ring_tx_t *tx, const ipc_ring_rx_t *rx, const ipc_msg_t *msg);
+//CPU2: copy the oldest record into msg, false when the ring is empty
+bool ipc_ring_pop(const ipc_ring_tx_t *tx, ipc_ring_rx_t *rx, ipc_msg_t *msg);
+//records waiting, either side
+uint32_t ipc_ring_count(const ipc_ring_tx_t *tx, const ipc_ring_rx_t *rx);
+
+#endif /* IPC_RING_H_ */
@@ -0,0 +1,38 @@
+// Thie file contains the C28x side of the CLA moisture path: the message RAM objects and the CLA setup
+// Built with MOISTURE_USE_CLA=1, the task itself is in moisture_cla_tasks.cla.
+
+#include <Headers/F2837xD_device.h>
+#include "adc_config.h"
+#include "moisture_cla.h"
+
+#if MOISTURE_USE_CLA
+
+#define CLA_TRIGGER_ADCA1 1 //CLA1TASKSRCSELx value for ADCAINT1
+
+#pragma DATA_SECTION(moisture_cla_params, "CpuToCla1MsgRAM")
+moisture_ctrl_params_t moisture_cla_params;
+#pragma DATA_SECTION(moisture_cla_out, "Cla1ToCpuMsgRAM")
+moisture_ctrl_out_t moisture_cla_out;
+#pragma DATA_SECTION(moisture_cla_state, "Cla1DataRam")
+moisture_ctrl_state_t moisture_cla_state;
+
+void moisture_cla_init(void)
+{
+    moisture_ctrl_params_init(&moisture_cla_params, MOISTURE_PUMP_ON, MOISTURE_PUMP_OFF, MOISTURE_FILTER_SHIFT);
+    moisture_ctrl_reset(&moisture_cla_state);
+
+    EALLOW;
+    CpuSysRegs.PCLKCR0.bit.CLA1 = 1; //enable CLA clock
+    //Cla1Prog was copied into LS5 by BINIT before main, it becomes CLA program memory now
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS4 = 1;     //LS4 shared between CPU and CLA (data)
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS5 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS5 = 1; //LS5 CLA program
+    Cla1Regs.MVECT1 = (Uint16)((Uint32)&moisture_cla_task1);
+    Cla1Regs.MCTL.bit.IACKE = 1;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 = CLA_TRIGGER_ADCA1;
+    Cla1Regs.MIER.all = 0;
+    Cla1Regs.MIER.bit.INT1 = 1; //task 1 only, its end of task interrupt goes to PIE 11.1
+    EDIS;
+}
+
+#endif
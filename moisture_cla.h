@@ -0,0 +1,24 @@
+/*
+ * moisture_cla.h
+ *
+ * Objects shared between the C28x and CLA task 1 (moisture_cla_tasks.cla) when built
+ * with MOISTURE_USE_CLA=1. Included by both compilers.
+ */
+
+#ifndef MOISTURE_CLA_H_
+#define MOISTURE_CLA_H_
+
+#include "moisture_ctrl.h"
+
+extern moisture_ctrl_params_t moisture_cla_params; //CpuToCla1MsgRAM
+extern moisture_ctrl_out_t moisture_cla_out;       //Cla1ToCpuMsgRAM
+extern moisture_ctrl_state_t moisture_cla_state;   //CLA data RAM (LS4)
+
+//CLA task 1, triggered by ADCAINT1
+__interrupt void moisture_cla_task1(void);
+
+#ifndef __TMS320C28XX_CLA__
+void moisture_cla_init(void); //load parameters, hand LS4/LS5 to the CLA and arm task 1, call after DeviceInit()
+#endif
+
+#endif /* MOISTURE_CLA_H_ */
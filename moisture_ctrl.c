@@ -0,0 +1,18 @@
+// Thie file contains the CPU side setup of the moisture filter/hysteresis in moisture_ctrl.h
+// Plain C, also built into the host tools.
+
+#include <math.h>
+#include "sensor_math.h"
+#include "moisture_ctrl.h"
+
+//water content = MOISTURE_K / code - MOISTURE_OFFSET * 100 (see sensor_math.h)
+#define MOISTURE_K (MOISTURE_SLOPE * 100.0 * ADC_FULL_SCALE / VREFHI)
+
+void moisture_ctrl_params_init(moisture_ctrl_params_t *params, double on_percent, double off_percent, uint32_t shift)
+{
+    //water < on  <=>  code > K / (on + offset): smallest such code
+    params->on_code = (int32_t)floor(MOISTURE_K / (on_percent + MOISTURE_OFFSET * 100.0)) + 1;
+    //water > off <=>  code < K / (off + offset): largest such code
+    params->off_code = (int32_t)ceil(MOISTURE_K / (off_percent + MOISTURE_OFFSET * 100.0)) - 1;
+    params->shift = shift;
+}
@@ -0,0 +1,99 @@
+/*
+ * moisture_ctrl.h
+ *
+ * Soil moisture filter and pump hysteresis run by CLA task 1 (MOISTURE_USE_CLA=1).
+ * Everything is done on the ADC code in 32-bit integers: the CLA has no 64-bit types
+ * and divides with a reciprocal estimate, so integer math is the only way to get the
+ * same bits on the CLA, the C28x and the host. Water content falls as the code rises,
+ * so the % thresholds are turned into code thresholds once on the CPU
+ * (moisture_ctrl_params_init) and the CLA only compares.
+ *
+ * The structs are shared through the CLA message RAMs, every field is 32 bits so the
+ * layout is the same for the C28x (16-bit int) and the CLA (32-bit int).
+ */
+
+#ifndef MOISTURE_CTRL_H_
+#define MOISTURE_CTRL_H_
+
+#include <stdint.h>
+
+#define MOISTURE_PUMP_ON 28.0     //pump starts below this water content (%)
+#define MOISTURE_PUMP_OFF 32.0    //and stops above this one
+#define MOISTURE_FILTER_SHIFT 2   //EMA weight of a new sample = 1 / 2^shift
+#define MOISTURE_CTRL_Q 4         //fraction bits of the filter state
+
+//CPU -> CLA (CpuToCla1MsgRAM)
+typedef struct
+{
+    int32_t on_code;   //pump on when the filtered code is >= on_code (drier)
+    int32_t off_code;  //pump off when it is <= off_code (wetter)
+    uint32_t shift;    //MOISTURE_FILTER_SHIFT
+} moisture_ctrl_params_t;
+
+//CLA private state (CLA data RAM)
+typedef struct
+{
+    int32_t acc;       //filtered code << MOISTURE_CTRL_Q
+    uint32_t primed;   //acc holds a sample
+    uint32_t pump_on;
+    uint32_t count;    //samples processed
+} moisture_ctrl_state_t;
+
+//CLA -> CPU (Cla1ToCpuMsgRAM)
+typedef struct
+{
+    uint32_t code;     //filtered ADC code
+    uint32_t pump_on;  //desired GPIO22 state, the CPU still applies the tank lockout
+    uint32_t count;
+} moisture_ctrl_out_t;
+
+//CPU/host only: turns the % thresholds into ADC code thresholds (uses double math)
+void moisture_ctrl_params_init(moisture_ctrl_params_t *params, double on_percent, double off_percent, uint32_t shift);
+
+static inline void moisture_ctrl_reset(moisture_ctrl_state_t *state)
+{
+    state->acc = 0;
+    state->primed = 0;
+    state->pump_on = 0;
+    state->count = 0;
+}
+
+//one averaged ADC code in, filtered code and pump decision out
+static inline void moisture_ctrl_step(moisture_ctrl_state_t *state, const moisture_ctrl_params_t *params,
+                                      uint32_t code, moisture_ctrl_out_t *out)
+{
+    int32_t sample = (int32_t)code << MOISTURE_CTRL_Q;
+    int32_t diff = sample - state->acc;
+    int32_t filtered;
+
+    if (state->primed == 0)
+    {
+        state->acc = sample; //start from the first reading instead of ramping up from 0
+        state->primed = 1;
+    }
+    else if (diff >= 0) //shift magnitudes only, >> of a negative value is implementation defined
+    {
+        state->acc += diff >> params->shift;
+    }
+    else
+    {
+        state->acc -= (-diff) >> params->shift;
+    }
+    filtered = (state->acc + (1L << (MOISTURE_CTRL_Q - 1))) >> MOISTURE_CTRL_Q;
+
+    if (filtered >= params->on_code)
+    {
+        state->pump_on = 1;
+    }
+    else if (filtered <= params->off_code)
+    {
+        state->pump_on = 0;
+    }
+    state->count++;
+
+    out->code = (uint32_t)filtered;
+    out->pump_on = state->pump_on;
+    out->count = state->count;
+}
+
+#endif /* MOISTURE_CTRL_H_ */
@@ -0,0 +1,1041 @@
+// Filename:            moisture_lut.c
+//
+// Description:         ADC code -> soil water content table, generated by host/gen_moisture_lut.
+//                      Do not edit, regenerate with: gen_moisture_lut 3 2.48 0.72
+//
+// Target:              TMS320F28379D
+
+#include "sensor_math.h"
+
+#if MOISTURE_LUT
+
+//placed by TMS320F28379D.cmd in flash, or copied to GS RAM at boot with MOISTURE_LUT_IN_RAM
+#pragma DATA_SECTION(moisture_lut, "MoistureLutFile")
+const sensor_t moisture_lut[MOISTURE_LUT_SIZE] = {
+    SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(32767.999985),
+    SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(32767.999985),
+    SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(32767.999985), SENSOR(30702.545455),
+    SENSOR(28138.000000), SENSOR(25968.000000), SENSOR(24108.000000), SENSOR(22496.000000),
+    SENSOR(21085.500000), SENSOR(19840.941176), SENSOR(18734.666667), SENSOR(17744.842105),
+    SENSOR(16854.000000), SENSOR(16048.000000), SENSOR(15315.272727), SENSOR(14646.260870),
+    SENSOR(14033.000000), SENSOR(13468.800000), SENSOR(12948.000000), SENSOR(12465.777778),
+    SENSOR(12018.000000), SENSOR(11601.103448), SENSOR(11212.000000), SENSOR(10848.000000),
+    SENSOR(10506.750000), SENSOR(10186.181818), SENSOR(9884.470588), SENSOR(9600.000000),
+    SENSOR(9331.333333), SENSOR(9077.189189), SENSOR(8836.421053), SENSOR(8608.000000),
+    SENSOR(8391.000000), SENSOR(8184.585366), SENSOR(7988.000000), SENSOR(7800.558140),
+    SENSOR(7621.636364), SENSOR(7450.666667), SENSOR(7287.130435), SENSOR(7130.553191),
+    SENSOR(6980.500000), SENSOR(6836.571429), SENSOR(6698.400000), SENSOR(6565.647059),
+    SENSOR(6438.000000), SENSOR(6315.169811), SENSOR(6196.888889), SENSOR(6082.909091),
+    SENSOR(5973.000000), SENSOR(5866.947368), SENSOR(5764.551724), SENSOR(5665.627119),
+    SENSOR(5570.000000), SENSOR(5477.508197), SENSOR(5388.000000), SENSOR(5301.333333),
+    SENSOR(5217.375000), SENSOR(5136.000000), SENSOR(5057.090909), SENSOR(4980.537313),
+    SENSOR(4906.235294), SENSOR(4834.086957), SENSOR(4764.000000), SENSOR(4695.887324),
+    SENSOR(4629.666667), SENSOR(4565.260274), SENSOR(4502.594595), SENSOR(4441.600000),
+    SENSOR(4382.210526), SENSOR(4324.363636), SENSOR(4268.000000), SENSOR(4213.063291),
+    SENSOR(4159.500000), SENSOR(4107.259259), SENSOR(4056.292683), SENSOR(4006.554217),
+    SENSOR(3958.000000), SENSOR(3910.588235), SENSOR(3864.279070), SENSOR(3819.034483),
+    SENSOR(3774.818182), SENSOR(3731.595506), SENSOR(3689.333333), SENSOR(3648.000000),
+    SENSOR(3607.565217), SENSOR(3568.000000), SENSOR(3529.276596), SENSOR(3491.368421),
+    SENSOR(3454.250000), SENSOR(3417.896907), SENSOR(3382.285714), SENSOR(3347.393939),
+    SENSOR(3313.200000), SENSOR(3279.683168), SENSOR(3246.823529), SENSOR(3214.601942),
+    SENSOR(3183.000000), SENSOR(3152.000000), SENSOR(3121.584906), SENSOR(3091.738318),
+    SENSOR(3062.444444), SENSOR(3033.688073), SENSOR(3005.454545), SENSOR(2977.729730),
+    SENSOR(2950.500000), SENSOR(2923.752212), SENSOR(2897.473684), SENSOR(2871.652174),
+    SENSOR(2846.275862), SENSOR(2821.333333), SENSOR(2796.813559), SENSOR(2772.705882),
+    SENSOR(2749.000000), SENSOR(2725.685950), SENSOR(2702.754098), SENSOR(2680.195122),
+    SENSOR(2658.000000), SENSOR(2636.160000), SENSOR(2614.666667), SENSOR(2593.511811),
+    SENSOR(2572.687500), SENSOR(2552.186047), SENSOR(2532.000000), SENSOR(2512.122137),
+    SENSOR(2492.545455), SENSOR(2473.263158), SENSOR(2454.268657), SENSOR(2435.555556),
+    SENSOR(2417.117647), SENSOR(2398.948905), SENSOR(2381.043478), SENSOR(2363.395683),
+    SENSOR(2346.000000), SENSOR(2328.851064), SENSOR(2311.943662), SENSOR(2295.272727),
+    SENSOR(2278.833333), SENSOR(2262.620690), SENSOR(2246.630137), SENSOR(2230.857143),
+    SENSOR(2215.297297), SENSOR(2199.946309), SENSOR(2184.800000), SENSOR(2169.854305),
+    SENSOR(2155.105263), SENSOR(2140.549020), SENSOR(2126.181818), SENSOR(2112.000000),
+    SENSOR(2098.000000), SENSOR(2084.178344), SENSOR(2070.531646), SENSOR(2057.056604),
+    SENSOR(2043.750000), SENSOR(2030.608696), SENSOR(2017.629630), SENSOR(2004.809816),
+    SENSOR(1992.146341), SENSOR(1979.636364), SENSOR(1967.277108), SENSOR(1955.065868),
+    SENSOR(1943.000000), SENSOR(1931.076923), SENSOR(1919.294118), SENSOR(1907.649123),
+    SENSOR(1896.139535), SENSOR(1884.763006), SENSOR(1873.517241), SENSOR(1862.400000),
+    SENSOR(1851.409091), SENSOR(1840.542373), SENSOR(1829.797753), SENSOR(1819.173184),
+    SENSOR(1808.666667), SENSOR(1798.276243), SENSOR(1788.000000), SENSOR(1777.836066),
+    SENSOR(1767.782609), SENSOR(1757.837838), SENSOR(1748.000000), SENSOR(1738.267380),
+    SENSOR(1728.638298), SENSOR(1719.111111), SENSOR(1709.684211), SENSOR(1700.356021),
+    SENSOR(1691.125000), SENSOR(1681.989637), SENSOR(1672.948454), SENSOR(1664.000000),
+    SENSOR(1655.142857), SENSOR(1646.375635), SENSOR(1637.696970), SENSOR(1629.105528),
+    SENSOR(1620.600000), SENSOR(1612.179104), SENSOR(1603.841584), SENSOR(1595.586207),
+    SENSOR(1587.411765), SENSOR(1579.317073), SENSOR(1571.300971), SENSOR(1563.362319),
+    SENSOR(1555.500000), SENSOR(1547.712919), SENSOR(1540.000000), SENSOR(1532.360190),
+    SENSOR(1524.792453), SENSOR(1517.295775), SENSOR(1509.869159), SENSOR(1502.511628),
+    SENSOR(1495.222222), SENSOR(1488.000000), SENSOR(1480.844037), SENSOR(1473.753425),
+    SENSOR(1466.727273), SENSOR(1459.764706), SENSOR(1452.864865), SENSOR(1446.026906),
+    SENSOR(1439.250000), SENSOR(1432.533333), SENSOR(1425.876106), SENSOR(1419.277533),
+    SENSOR(1412.736842), SENSOR(1406.253275), SENSOR(1399.826087), SENSOR(1393.454545),
+    SENSOR(1387.137931), SENSOR(1380.875536), SENSOR(1374.666667), SENSOR(1368.510638),
+    SENSOR(1362.406780), SENSOR(1356.354430), SENSOR(1350.352941), SENSOR(1344.401674),
+    SENSOR(1338.500000), SENSOR(1332.647303), SENSOR(1326.842975), SENSOR(1321.086420),
+    SENSOR(1315.377049), SENSOR(1309.714286), SENSOR(1304.097561), SENSOR(1298.526316),
+    SENSOR(1293.000000), SENSOR(1287.518072), SENSOR(1282.080000), SENSOR(1276.685259),
+    SENSOR(1271.333333), SENSOR(1266.023715), SENSOR(1260.755906), SENSOR(1255.529412),
+    SENSOR(1250.343750), SENSOR(1245.198444), SENSOR(1240.093023), SENSOR(1235.027027),
+    SENSOR(1230.000000), SENSOR(1225.011494), SENSOR(1220.061069), SENSOR(1215.148289),
+    SENSOR(1210.272727), SENSOR(1205.433962), SENSOR(1200.631579), SENSOR(1195.865169),
+    SENSOR(1191.134328), SENSOR(1186.438662), SENSOR(1181.777778), SENSOR(1177.151292),
+    SENSOR(1172.558824), SENSOR(1168.000000), SENSOR(1163.474453), SENSOR(1158.981818),
+    SENSOR(1154.521739), SENSOR(1150.093863), SENSOR(1145.697842), SENSOR(1141.333333),
+    SENSOR(1137.000000), SENSOR(1132.697509), SENSOR(1128.425532), SENSOR(1124.183746),
+    SENSOR(1119.971831), SENSOR(1115.789474), SENSOR(1111.636364), SENSOR(1107.512195),
+    SENSOR(1103.416667), SENSOR(1099.349481), SENSOR(1095.310345), SENSOR(1091.298969),
+    SENSOR(1087.315068), SENSOR(1083.358362), SENSOR(1079.428571), SENSOR(1075.525424),
+    SENSOR(1071.648649), SENSOR(1067.797980), SENSOR(1063.973154), SENSOR(1060.173913),
+    SENSOR(1056.400000), SENSOR(1052.651163), SENSOR(1048.927152), SENSOR(1045.227723),
+    SENSOR(1041.552632), SENSOR(1037.901639), SENSOR(1034.274510), SENSOR(1030.671010),
+    SENSOR(1027.090909), SENSOR(1023.533981), SENSOR(1020.000000), SENSOR(1016.488746),
+    SENSOR(1013.000000), SENSOR(1009.533546), SENSOR(1006.089172), SENSOR(1002.666667),
+    SENSOR(999.265823), SENSOR(995.886435), SENSOR(992.528302), SENSOR(989.191223),
+    SENSOR(985.875000), SENSOR(982.579439), SENSOR(979.304348), SENSOR(976.049536),
+    SENSOR(972.814815), SENSOR(969.600000), SENSOR(966.404908), SENSOR(963.229358),
+    SENSOR(960.073171), SENSOR(956.936170), SENSOR(953.818182), SENSOR(950.719033),
+    SENSOR(947.638554), SENSOR(944.576577), SENSOR(941.532934), SENSOR(938.507463),
+    SENSOR(935.500000), SENSOR(932.510386), SENSOR(929.538462), SENSOR(926.584071),
+    SENSOR(923.647059), SENSOR(920.727273), SENSOR(917.824561), SENSOR(914.938776),
+    SENSOR(912.069767), SENSOR(909.217391), SENSOR(906.381503), SENSOR(903.561960),
+    SENSOR(900.758621), SENSOR(897.971347), SENSOR(895.200000), SENSOR(892.444444),
+    SENSOR(889.704545), SENSOR(886.980170), SENSOR(884.271186), SENSOR(881.577465),
+    SENSOR(878.898876), SENSOR(876.235294), SENSOR(873.586592), SENSOR(870.952646),
+    SENSOR(868.333333), SENSOR(865.728532), SENSOR(863.138122), SENSOR(860.561983),
+    SENSOR(858.000000), SENSOR(855.452055), SENSOR(852.918033), SENSOR(850.397820),
+    SENSOR(847.891304), SENSOR(845.398374), SENSOR(842.918919), SENSOR(840.452830),
+    SENSOR(838.000000), SENSOR(835.560322), SENSOR(833.133690), SENSOR(830.720000),
+    SENSOR(828.319149), SENSOR(825.931034), SENSOR(823.555556), SENSOR(821.192612),
+    SENSOR(818.842105), SENSOR(816.503937), SENSOR(814.178010), SENSOR(811.864230),
+    SENSOR(809.562500), SENSOR(807.272727), SENSOR(804.994819), SENSOR(802.728682),
+    SENSOR(800.474227), SENSOR(798.231362), SENSOR(796.000000), SENSOR(793.780051),
+    SENSOR(791.571429), SENSOR(789.374046), SENSOR(787.187817), SENSOR(785.012658),
+    SENSOR(782.848485), SENSOR(780.695214), SENSOR(778.552764), SENSOR(776.421053),
+    SENSOR(774.300000), SENSOR(772.189526), SENSOR(770.089552), SENSOR(768.000000),
+    SENSOR(765.920792), SENSOR(763.851852), SENSOR(761.793103), SENSOR(759.744472),
+    SENSOR(757.705882), SENSOR(755.677262), SENSOR(753.658537), SENSOR(751.649635),
+    SENSOR(749.650485), SENSOR(747.661017), SENSOR(745.681159), SENSOR(743.710843),
+    SENSOR(741.750000), SENSOR(739.798561), SENSOR(737.856459), SENSOR(735.923628),
+    SENSOR(734.000000), SENSOR(732.085511), SENSOR(730.180095), SENSOR(728.283688),
+    SENSOR(726.396226), SENSOR(724.517647), SENSOR(722.647887), SENSOR(720.786885),
+    SENSOR(718.934579), SENSOR(717.090909), SENSOR(715.255814), SENSOR(713.429234),
+    SENSOR(711.611111), SENSOR(709.801386), SENSOR(708.000000), SENSOR(706.206897),
+    SENSOR(704.422018), SENSOR(702.645309), SENSOR(700.876712), SENSOR(699.116173),
+    SENSOR(697.363636), SENSOR(695.619048), SENSOR(693.882353), SENSOR(692.153499),
+    SENSOR(690.432432), SENSOR(688.719101), SENSOR(687.013453), SENSOR(685.315436),
+    SENSOR(683.625000), SENSOR(681.942094), SENSOR(680.266667), SENSOR(678.598670),
+    SENSOR(676.938053), SENSOR(675.284768), SENSOR(673.638767), SENSOR(672.000000),
+    SENSOR(670.368421), SENSOR(668.743982), SENSOR(667.126638), SENSOR(665.516340),
+    SENSOR(663.913043), SENSOR(662.316703), SENSOR(660.727273), SENSOR(659.144708),
+    SENSOR(657.568966), SENSOR(656.000000), SENSOR(654.437768), SENSOR(652.882227),
+    SENSOR(651.333333), SENSOR(649.791045), SENSOR(648.255319), SENSOR(646.726115),
+    SENSOR(645.203390), SENSOR(643.687104), SENSOR(642.177215), SENSOR(640.673684),
+    SENSOR(639.176471), SENSOR(637.685535), SENSOR(636.200837), SENSOR(634.722338),
+    SENSOR(633.250000), SENSOR(631.783784), SENSOR(630.323651), SENSOR(628.869565),
+    SENSOR(627.421488), SENSOR(625.979381), SENSOR(624.543210), SENSOR(623.112936),
+    SENSOR(621.688525), SENSOR(620.269939), SENSOR(618.857143), SENSOR(617.450102),
+    SENSOR(616.048780), SENSOR(614.653144), SENSOR(613.263158), SENSOR(611.878788),
+    SENSOR(610.500000), SENSOR(609.126761), SENSOR(607.759036), SENSOR(606.396794),
+    SENSOR(605.040000), SENSOR(603.688623), SENSOR(602.342629), SENSOR(601.001988),
+    SENSOR(599.666667), SENSOR(598.336634), SENSOR(597.011858), SENSOR(595.692308),
+    SENSOR(594.377953), SENSOR(593.068762), SENSOR(591.764706), SENSOR(590.465753),
+    SENSOR(589.171875), SENSOR(587.883041), SENSOR(586.599222), SENSOR(585.320388),
+    SENSOR(584.046512), SENSOR(582.777563), SENSOR(581.513514), SENSOR(580.254335),
+    SENSOR(579.000000), SENSOR(577.750480), SENSOR(576.505747), SENSOR(575.265774),
+    SENSOR(574.030534), SENSOR(572.800000), SENSOR(571.574144), SENSOR(570.352941),
+    SENSOR(569.136364), SENSOR(567.924386), SENSOR(566.716981), SENSOR(565.514124),
+    SENSOR(564.315789), SENSOR(563.121951), SENSOR(561.932584), SENSOR(560.747664),
+    SENSOR(559.567164), SENSOR(558.391061), SENSOR(557.219331), SENSOR(556.051948),
+    SENSOR(554.888889), SENSOR(553.730129), SENSOR(552.575646), SENSOR(551.425414),
+    SENSOR(550.279412), SENSOR(549.137615), SENSOR(548.000000), SENSOR(546.866545),
+    SENSOR(545.737226), SENSOR(544.612022), SENSOR(543.490909), SENSOR(542.373866),
+    SENSOR(541.260870), SENSOR(540.151899), SENSOR(539.046931), SENSOR(537.945946),
+    SENSOR(536.848921), SENSOR(535.755835), SENSOR(534.666667), SENSOR(533.581395),
+    SENSOR(532.500000), SENSOR(531.422460), SENSOR(530.348754), SENSOR(529.278863),
+    SENSOR(528.212766), SENSOR(527.150442), SENSOR(526.091873), SENSOR(525.037037),
+    SENSOR(523.985915), SENSOR(522.938489), SENSOR(521.894737), SENSOR(520.854641),
+    SENSOR(519.818182), SENSOR(518.785340), SENSOR(517.756098), SENSOR(516.730435),
+    SENSOR(515.708333), SENSOR(514.689775), SENSOR(513.674740), SENSOR(512.663212),
+    SENSOR(511.655172), SENSOR(510.650602), SENSOR(509.649485), SENSOR(508.651801),
+    SENSOR(507.657534), SENSOR(506.666667), SENSOR(505.679181), SENSOR(504.695060),
+    SENSOR(503.714286), SENSOR(502.736842), SENSOR(501.762712), SENSOR(500.791878),
+    SENSOR(499.824324), SENSOR(498.860034), SENSOR(497.898990), SENSOR(496.941176),
+    SENSOR(495.986577), SENSOR(495.035176), SENSOR(494.086957), SENSOR(493.141903),
+    SENSOR(492.200000), SENSOR(491.261231), SENSOR(490.325581), SENSOR(489.393035),
+    SENSOR(488.463576), SENSOR(487.537190), SENSOR(486.613861), SENSOR(485.693575),
+    SENSOR(484.776316), SENSOR(483.862069), SENSOR(482.950820), SENSOR(482.042553),
+    SENSOR(481.137255), SENSOR(480.234910), SENSOR(479.335505), SENSOR(478.439024),
+    SENSOR(477.545455), SENSOR(476.654781), SENSOR(475.766990), SENSOR(474.882068),
+    SENSOR(474.000000), SENSOR(473.120773), SENSOR(472.244373), SENSOR(471.370787),
+    SENSOR(470.500000), SENSOR(469.632000), SENSOR(468.766773), SENSOR(467.904306),
+    SENSOR(467.044586), SENSOR(466.187599), SENSOR(465.333333), SENSOR(464.481775),
+    SENSOR(463.632911), SENSOR(462.786730), SENSOR(461.943218), SENSOR(461.102362),
+    SENSOR(460.264151), SENSOR(459.428571), SENSOR(458.595611), SENSOR(457.765258),
+    SENSOR(456.937500), SENSOR(456.112324), SENSOR(455.289720), SENSOR(454.469673),
+    SENSOR(453.652174), SENSOR(452.837209), SENSOR(452.024768), SENSOR(451.214838),
+    SENSOR(450.407407), SENSOR(449.602465), SENSOR(448.800000), SENSOR(448.000000),
+    SENSOR(447.202454), SENSOR(446.407351), SENSOR(445.614679), SENSOR(444.824427),
+    SENSOR(444.036585), SENSOR(443.251142), SENSOR(442.468085), SENSOR(441.687405),
+    SENSOR(440.909091), SENSOR(440.133132), SENSOR(439.359517), SENSOR(438.588235),
+    SENSOR(437.819277), SENSOR(437.052632), SENSOR(436.288288), SENSOR(435.526237),
+    SENSOR(434.766467), SENSOR(434.008969), SENSOR(433.253731), SENSOR(432.500745),
+    SENSOR(431.750000), SENSOR(431.001486), SENSOR(430.255193), SENSOR(429.511111),
+    SENSOR(428.769231), SENSOR(428.029542), SENSOR(427.292035), SENSOR(426.556701),
+    SENSOR(425.823529), SENSOR(425.092511), SENSOR(424.363636), SENSOR(423.636896),
+    SENSOR(422.912281), SENSOR(422.189781), SENSOR(421.469388), SENSOR(420.751092),
+    SENSOR(420.034884), SENSOR(419.320755), SENSOR(418.608696), SENSOR(417.898698),
+    SENSOR(417.190751), SENSOR(416.484848), SENSOR(415.780980), SENSOR(415.079137),
+    SENSOR(414.379310), SENSOR(413.681492), SENSOR(412.985673), SENSOR(412.291845),
+    SENSOR(411.600000), SENSOR(410.910128), SENSOR(410.222222), SENSOR(409.536273),
+    SENSOR(408.852273), SENSOR(408.170213), SENSOR(407.490085), SENSOR(406.811881),
+    SENSOR(406.135593), SENSOR(405.461213), SENSOR(404.788732), SENSOR(404.118143),
+    SENSOR(403.449438), SENSOR(402.782609), SENSOR(402.117647), SENSOR(401.454545),
+    SENSOR(400.793296), SENSOR(400.133891), SENSOR(399.476323), SENSOR(398.820584),
+    SENSOR(398.166667), SENSOR(397.514563), SENSOR(396.864266), SENSOR(396.215768),
+    SENSOR(395.569061), SENSOR(394.924138), SENSOR(394.280992), SENSOR(393.639615),
+    SENSOR(393.000000), SENSOR(392.362140), SENSOR(391.726027), SENSOR(391.091655),
+    SENSOR(390.459016), SENSOR(389.828104), SENSOR(389.198910), SENSOR(388.571429),
+    SENSOR(387.945652), SENSOR(387.321574), SENSOR(386.699187), SENSOR(386.078484),
+    SENSOR(385.459459), SENSOR(384.842105), SENSOR(384.226415), SENSOR(383.612382),
+    SENSOR(383.000000), SENSOR(382.389262), SENSOR(381.780161), SENSOR(381.172691),
+    SENSOR(380.566845), SENSOR(379.962617), SENSOR(379.360000), SENSOR(378.758988),
+    SENSOR(378.159574), SENSOR(377.561753), SENSOR(376.965517), SENSOR(376.370861),
+    SENSOR(375.777778), SENSOR(375.186262), SENSOR(374.596306), SENSOR(374.007905),
+    SENSOR(373.421053), SENSOR(372.835742), SENSOR(372.251969), SENSOR(371.669725),
+    SENSOR(371.089005), SENSOR(370.509804), SENSOR(369.932115), SENSOR(369.355932),
+    SENSOR(368.781250), SENSOR(368.208062), SENSOR(367.636364), SENSOR(367.066148),
+    SENSOR(366.497409), SENSOR(365.930142), SENSOR(365.364341), SENSOR(364.800000),
+    SENSOR(364.237113), SENSOR(363.675676), SENSOR(363.115681), SENSOR(362.557125),
+    SENSOR(362.000000), SENSOR(361.444302), SENSOR(360.890026), SENSOR(360.337165),
+    SENSOR(359.785714), SENSOR(359.235669), SENSOR(358.687023), SENSOR(358.139771),
+    SENSOR(357.593909), SENSOR(357.049430), SENSOR(356.506329), SENSOR(355.964602),
+    SENSOR(355.424242), SENSOR(354.885246), SENSOR(354.347607), SENSOR(353.811321),
+    SENSOR(353.276382), SENSOR(352.742785), SENSOR(352.210526), SENSOR(351.679599),
+    SENSOR(351.150000), SENSOR(350.621723), SENSOR(350.094763), SENSOR(349.569116),
+    SENSOR(349.044776), SENSOR(348.521739), SENSOR(348.000000), SENSOR(347.479554),
+    SENSOR(346.960396), SENSOR(346.442522), SENSOR(345.925926), SENSOR(345.410604),
+    SENSOR(344.896552), SENSOR(344.383764), SENSOR(343.872236), SENSOR(343.361963),
+    SENSOR(342.852941), SENSOR(342.345165), SENSOR(341.838631), SENSOR(341.333333),
+    SENSOR(340.829268), SENSOR(340.326431), SENSOR(339.824818), SENSOR(339.324423),
+    SENSOR(338.825243), SENSOR(338.327273), SENSOR(337.830508), SENSOR(337.334946),
+    SENSOR(336.840580), SENSOR(336.347407), SENSOR(335.855422), SENSOR(335.364621),
+    SENSOR(334.875000), SENSOR(334.386555), SENSOR(333.899281), SENSOR(333.413174),
+    SENSOR(332.928230), SENSOR(332.444444), SENSOR(331.961814), SENSOR(331.480334),
+    SENSOR(331.000000), SENSOR(330.520809), SENSOR(330.042755), SENSOR(329.565836),
+    SENSOR(329.090047), SENSOR(328.615385), SENSOR(328.141844), SENSOR(327.669421),
+    SENSOR(327.198113), SENSOR(326.727915), SENSOR(326.258824), SENSOR(325.790834),
+    SENSOR(325.323944), SENSOR(324.858148), SENSOR(324.393443), SENSOR(323.929825),
+    SENSOR(323.467290), SENSOR(323.005834), SENSOR(322.545455), SENSOR(322.086147),
+    SENSOR(321.627907), SENSOR(321.170732), SENSOR(320.714617), SENSOR(320.259560),
+    SENSOR(319.805556), SENSOR(319.352601), SENSOR(318.900693), SENSOR(318.449827),
+    SENSOR(318.000000), SENSOR(317.551208), SENSOR(317.103448), SENSOR(316.656716),
+    SENSOR(316.211009), SENSOR(315.766323), SENSOR(315.322654), SENSOR(314.880000),
+    SENSOR(314.438356), SENSOR(313.997719), SENSOR(313.558087), SENSOR(313.119454),
+    SENSOR(312.681818), SENSOR(312.245176), SENSOR(311.809524), SENSOR(311.374858),
+    SENSOR(310.941176), SENSOR(310.508475), SENSOR(310.076749), SENSOR(309.645998),
+    SENSOR(309.216216), SENSOR(308.787402), SENSOR(308.359551), SENSOR(307.932660),
+    SENSOR(307.506726), SENSOR(307.081747), SENSOR(306.657718), SENSOR(306.234637),
+    SENSOR(305.812500), SENSOR(305.391304), SENSOR(304.971047), SENSOR(304.551724),
+    SENSOR(304.133333), SENSOR(303.715871), SENSOR(303.299335), SENSOR(302.883721),
+    SENSOR(302.469027), SENSOR(302.055249), SENSOR(301.642384), SENSOR(301.230430),
+    SENSOR(300.819383), SENSOR(300.409241), SENSOR(300.000000), SENSOR(299.591658),
+    SENSOR(299.184211), SENSOR(298.777656), SENSOR(298.371991), SENSOR(297.967213),
+    SENSOR(297.563319), SENSOR(297.160305), SENSOR(296.758170), SENSOR(296.356910),
+    SENSOR(295.956522), SENSOR(295.557003), SENSOR(295.158351), SENSOR(294.760563),
+    SENSOR(294.363636), SENSOR(293.967568), SENSOR(293.572354), SENSOR(293.177994),
+    SENSOR(292.784483), SENSOR(292.391819), SENSOR(292.000000), SENSOR(291.609023),
+    SENSOR(291.218884), SENSOR(290.829582), SENSOR(290.441113), SENSOR(290.053476),
+    SENSOR(289.666667), SENSOR(289.280683), SENSOR(288.895522), SENSOR(288.511182),
+    SENSOR(288.127660), SENSOR(287.744952), SENSOR(287.363057), SENSOR(286.981972),
+    SENSOR(286.601695), SENSOR(286.222222), SENSOR(285.843552), SENSOR(285.465681),
+    SENSOR(285.088608), SENSOR(284.712329), SENSOR(284.336842), SENSOR(283.962145),
+    SENSOR(283.588235), SENSOR(283.215110), SENSOR(282.842767), SENSOR(282.471204),
+    SENSOR(282.100418), SENSOR(281.730408), SENSOR(281.361169), SENSOR(280.992701),
+    SENSOR(280.625000), SENSOR(280.258065), SENSOR(279.891892), SENSOR(279.526480),
+    SENSOR(279.161826), SENSOR(278.797927), SENSOR(278.434783), SENSOR(278.072389),
+    SENSOR(277.710744), SENSOR(277.349845), SENSOR(276.989691), SENSOR(276.630278),
+    SENSOR(276.271605), SENSOR(275.913669), SENSOR(275.556468), SENSOR(275.200000),
+    SENSOR(274.844262), SENSOR(274.489253), SENSOR(274.134969), SENSOR(273.781410),
+    SENSOR(273.428571), SENSOR(273.076453), SENSOR(272.725051), SENSOR(272.374364),
+    SENSOR(272.024390), SENSOR(271.675127), SENSOR(271.326572), SENSOR(270.978723),
+    SENSOR(270.631579), SENSOR(270.285137), SENSOR(269.939394), SENSOR(269.594349),
+    SENSOR(269.250000), SENSOR(268.906344), SENSOR(268.563380), SENSOR(268.221106),
+    SENSOR(267.879518), SENSOR(267.538616), SENSOR(267.198397), SENSOR(266.858859),
+    SENSOR(266.520000), SENSOR(266.181818), SENSOR(265.844311), SENSOR(265.507478),
+    SENSOR(265.171315), SENSOR(264.835821), SENSOR(264.500994), SENSOR(264.166832),
+    SENSOR(263.833333), SENSOR(263.500496), SENSOR(263.168317), SENSOR(262.836795),
+    SENSOR(262.505929), SENSOR(262.175716), SENSOR(261.846154), SENSOR(261.517241),
+    SENSOR(261.188976), SENSOR(260.861357), SENSOR(260.534381), SENSOR(260.208047),
+    SENSOR(259.882353), SENSOR(259.557297), SENSOR(259.232877), SENSOR(258.909091),
+    SENSOR(258.585938), SENSOR(258.263415), SENSOR(257.941520), SENSOR(257.620253),
+    SENSOR(257.299611), SENSOR(256.979592), SENSOR(256.660194), SENSOR(256.341416),
+    SENSOR(256.023256), SENSOR(255.705712), SENSOR(255.388781), SENSOR(255.072464),
+    SENSOR(254.756757), SENSOR(254.441659), SENSOR(254.127168), SENSOR(253.813282),
+    SENSOR(253.500000), SENSOR(253.187320), SENSOR(252.875240), SENSOR(252.563758),
+    SENSOR(252.252874), SENSOR(251.942584), SENSOR(251.632887), SENSOR(251.323782),
+    SENSOR(251.015267), SENSOR(250.707340), SENSOR(250.400000), SENSOR(250.093245),
+    SENSOR(249.787072), SENSOR(249.481481), SENSOR(249.176471), SENSOR(248.872038),
+    SENSOR(248.568182), SENSOR(248.264901), SENSOR(247.962193), SENSOR(247.660057),
+    SENSOR(247.358491), SENSOR(247.057493), SENSOR(246.757062), SENSOR(246.457197),
+    SENSOR(246.157895), SENSOR(245.859155), SENSOR(245.560976), SENSOR(245.263355),
+    SENSOR(244.966292), SENSOR(244.669785), SENSOR(244.373832), SENSOR(244.078431),
+    SENSOR(243.783582), SENSOR(243.489282), SENSOR(243.195531), SENSOR(242.902326),
+    SENSOR(242.609665), SENSOR(242.317549), SENSOR(242.025974), SENSOR(241.734940),
+    SENSOR(241.444444), SENSOR(241.154487), SENSOR(240.865065), SENSOR(240.576177),
+    SENSOR(240.287823), SENSOR(240.000000), SENSOR(239.712707), SENSOR(239.425943),
+    SENSOR(239.139706), SENSOR(238.853994), SENSOR(238.568807), SENSOR(238.284143),
+    SENSOR(238.000000), SENSOR(237.716377), SENSOR(237.433272), SENSOR(237.150685),
+    SENSOR(236.868613), SENSOR(236.587056), SENSOR(236.306011), SENSOR(236.025478),
+    SENSOR(235.745455), SENSOR(235.465940), SENSOR(235.186933), SENSOR(234.908432),
+    SENSOR(234.630435), SENSOR(234.352941), SENSOR(234.075949), SENSOR(233.799458),
+    SENSOR(233.523466), SENSOR(233.247971), SENSOR(232.972973), SENSOR(232.698470),
+    SENSOR(232.424460), SENSOR(232.150943), SENSOR(231.877917), SENSOR(231.605381),
+    SENSOR(231.333333), SENSOR(231.061773), SENSOR(230.790698), SENSOR(230.520107),
+    SENSOR(230.250000), SENSOR(229.980375), SENSOR(229.711230), SENSOR(229.442565),
+    SENSOR(229.174377), SENSOR(228.906667), SENSOR(228.639432), SENSOR(228.372671),
+    SENSOR(228.106383), SENSOR(227.840567), SENSOR(227.575221), SENSOR(227.310345),
+    SENSOR(227.045936), SENSOR(226.781995), SENSOR(226.518519), SENSOR(226.255507),
+    SENSOR(225.992958), SENSOR(225.730871), SENSOR(225.469244), SENSOR(225.208077),
+    SENSOR(224.947368), SENSOR(224.687117), SENSOR(224.427320), SENSOR(224.167979),
+    SENSOR(223.909091), SENSOR(223.650655), SENSOR(223.392670), SENSOR(223.135135),
+    SENSOR(222.878049), SENSOR(222.621410), SENSOR(222.365217), SENSOR(222.109470),
+    SENSOR(221.854167), SENSOR(221.599306), SENSOR(221.344887), SENSOR(221.090909),
+    SENSOR(220.837370), SENSOR(220.584270), SENSOR(220.331606), SENSOR(220.079379),
+    SENSOR(219.827586), SENSOR(219.576227), SENSOR(219.325301), SENSOR(219.074807),
+    SENSOR(218.824742), SENSOR(218.575107), SENSOR(218.325901), SENSOR(218.077121),
+    SENSOR(217.828767), SENSOR(217.580838), SENSOR(217.333333), SENSOR(217.086251),
+    SENSOR(216.839590), SENSOR(216.593350), SENSOR(216.347530), SENSOR(216.102128),
+    SENSOR(215.857143), SENSOR(215.612574), SENSOR(215.368421), SENSOR(215.124682),
+    SENSOR(214.881356), SENSOR(214.638442), SENSOR(214.395939), SENSOR(214.153846),
+    SENSOR(213.912162), SENSOR(213.670886), SENSOR(213.430017), SENSOR(213.189553),
+    SENSOR(212.949495), SENSOR(212.709840), SENSOR(212.470588), SENSOR(212.231738),
+    SENSOR(211.993289), SENSOR(211.755239), SENSOR(211.517588), SENSOR(211.280335),
+    SENSOR(211.043478), SENSOR(210.807018), SENSOR(210.570952), SENSOR(210.335279),
+    SENSOR(210.100000), SENSOR(209.865112), SENSOR(209.630616), SENSOR(209.396509),
+    SENSOR(209.162791), SENSOR(208.929461), SENSOR(208.696517), SENSOR(208.463960),
+    SENSOR(208.231788), SENSOR(208.000000), SENSOR(207.768595), SENSOR(207.537572),
+    SENSOR(207.306931), SENSOR(207.076669), SENSOR(206.846787), SENSOR(206.617284),
+    SENSOR(206.388158), SENSOR(206.159408), SENSOR(205.931034), SENSOR(205.703035),
+    SENSOR(205.475410), SENSOR(205.248157), SENSOR(205.021277), SENSOR(204.794767),
+    SENSOR(204.568627), SENSOR(204.342857), SENSOR(204.117455), SENSOR(203.892421),
+    SENSOR(203.667752), SENSOR(203.443450), SENSOR(203.219512), SENSOR(202.995938),
+    SENSOR(202.772727), SENSOR(202.549878), SENSOR(202.327391), SENSOR(202.105263),
+    SENSOR(201.883495), SENSOR(201.662086), SENSOR(201.441034), SENSOR(201.220339),
+    SENSOR(201.000000), SENSOR(200.780016), SENSOR(200.560386), SENSOR(200.341110),
+    SENSOR(200.122186), SENSOR(199.903614), SENSOR(199.685393), SENSOR(199.467522),
+    SENSOR(199.250000), SENSOR(199.032826), SENSOR(198.816000), SENSOR(198.599520),
+    SENSOR(198.383387), SENSOR(198.167598), SENSOR(197.952153), SENSOR(197.737052),
+    SENSOR(197.522293), SENSOR(197.307876), SENSOR(197.093800), SENSOR(196.880064),
+    SENSOR(196.666667), SENSOR(196.453608), SENSOR(196.240887), SENSOR(196.028504),
+    SENSOR(195.816456), SENSOR(195.604743), SENSOR(195.393365), SENSOR(195.182320),
+    SENSOR(194.971609), SENSOR(194.761229), SENSOR(194.551181), SENSOR(194.341463),
+    SENSOR(194.132075), SENSOR(193.923016), SENSOR(193.714286), SENSOR(193.505882),
+    SENSOR(193.297806), SENSOR(193.090055), SENSOR(192.882629), SENSOR(192.675528),
+    SENSOR(192.468750), SENSOR(192.262295), SENSOR(192.056162), SENSOR(191.850351),
+    SENSOR(191.644860), SENSOR(191.439689), SENSOR(191.234837), SENSOR(191.030303),
+    SENSOR(190.826087), SENSOR(190.622188), SENSOR(190.418605), SENSOR(190.215337),
+    SENSOR(190.012384), SENSOR(189.809745), SENSOR(189.607419), SENSOR(189.405405),
+    SENSOR(189.203704), SENSOR(189.002313), SENSOR(188.801233), SENSOR(188.600462),
+    SENSOR(188.400000), SENSOR(188.199846), SENSOR(188.000000), SENSOR(187.800460),
+    SENSOR(187.601227), SENSOR(187.402299), SENSOR(187.203675), SENSOR(187.005356),
+    SENSOR(186.807339), SENSOR(186.609626), SENSOR(186.412214), SENSOR(186.215103),
+    SENSOR(186.018293), SENSOR(185.821782), SENSOR(185.625571), SENSOR(185.429658),
+    SENSOR(185.234043), SENSOR(185.038724), SENSOR(184.843703), SENSOR(184.648976),
+    SENSOR(184.454545), SENSOR(184.260409), SENSOR(184.066566), SENSOR(183.873016),
+    SENSOR(183.679758), SENSOR(183.486792), SENSOR(183.294118), SENSOR(183.101733),
+    SENSOR(182.909639), SENSOR(182.717833), SENSOR(182.526316), SENSOR(182.335086),
+    SENSOR(182.144144), SENSOR(181.953488), SENSOR(181.763118), SENSOR(181.573034),
+    SENSOR(181.383234), SENSOR(181.193717), SENSOR(181.004484), SENSOR(180.815534),
+    SENSOR(180.626866), SENSOR(180.438479), SENSOR(180.250373), SENSOR(180.062547),
+    SENSOR(179.875000), SENSOR(179.687732), SENSOR(179.500743), SENSOR(179.314031),
+    SENSOR(179.127596), SENSOR(178.941438), SENSOR(178.755556), SENSOR(178.569948),
+    SENSOR(178.384615), SENSOR(178.199557), SENSOR(178.014771), SENSOR(177.830258),
+    SENSOR(177.646018), SENSOR(177.462049), SENSOR(177.278351), SENSOR(177.094923),
+    SENSOR(176.911765), SENSOR(176.728876), SENSOR(176.546256), SENSOR(176.363903),
+    SENSOR(176.181818), SENSOR(176.000000), SENSOR(175.818448), SENSOR(175.637162),
+    SENSOR(175.456140), SENSOR(175.275383), SENSOR(175.094891), SENSOR(174.914661),
+    SENSOR(174.734694), SENSOR(174.554989), SENSOR(174.375546), SENSOR(174.196364),
+    SENSOR(174.017442), SENSOR(173.838780), SENSOR(173.660377), SENSOR(173.482234),
+    SENSOR(173.304348), SENSOR(173.126720), SENSOR(172.949349), SENSOR(172.772234),
+    SENSOR(172.595376), SENSOR(172.418773), SENSOR(172.242424), SENSOR(172.066330),
+    SENSOR(171.890490), SENSOR(171.714903), SENSOR(171.539568), SENSOR(171.364486),
+    SENSOR(171.189655), SENSOR(171.015075), SENSOR(170.840746), SENSOR(170.666667),
+    SENSOR(170.492837), SENSOR(170.319256), SENSOR(170.145923), SENSOR(169.972838),
+    SENSOR(169.800000), SENSOR(169.627409), SENSOR(169.455064), SENSOR(169.282965),
+    SENSOR(169.111111), SENSOR(168.939502), SENSOR(168.768137), SENSOR(168.597015),
+    SENSOR(168.426136), SENSOR(168.255500), SENSOR(168.085106), SENSOR(167.914954),
+    SENSOR(167.745042), SENSOR(167.575372), SENSOR(167.405941), SENSOR(167.236749),
+    SENSOR(167.067797), SENSOR(166.899083), SENSOR(166.730606), SENSOR(166.562368),
+    SENSOR(166.394366), SENSOR(166.226601), SENSOR(166.059072), SENSOR(165.891778),
+    SENSOR(165.724719), SENSOR(165.557895), SENSOR(165.391304), SENSOR(165.224947),
+    SENSOR(165.058824), SENSOR(164.892932), SENSOR(164.727273), SENSOR(164.561845),
+    SENSOR(164.396648), SENSOR(164.231682), SENSOR(164.066946), SENSOR(163.902439),
+    SENSOR(163.738162), SENSOR(163.574113), SENSOR(163.410292), SENSOR(163.246699),
+    SENSOR(163.083333), SENSOR(162.920194), SENSOR(162.757282), SENSOR(162.594595),
+    SENSOR(162.432133), SENSOR(162.269896), SENSOR(162.107884), SENSOR(161.946095),
+    SENSOR(161.784530), SENSOR(161.623188), SENSOR(161.462069), SENSOR(161.301172),
+    SENSOR(161.140496), SENSOR(160.980041), SENSOR(160.819807), SENSOR(160.659794),
+    SENSOR(160.500000), SENSOR(160.340426), SENSOR(160.181070), SENSOR(160.021933),
+    SENSOR(159.863014), SENSOR(159.704312), SENSOR(159.545828), SENSOR(159.387560),
+    SENSOR(159.229508), SENSOR(159.071672), SENSOR(158.914052), SENSOR(158.756646),
+    SENSOR(158.599455), SENSOR(158.442478), SENSOR(158.285714), SENSOR(158.129164),
+    SENSOR(157.972826), SENSOR(157.816701), SENSOR(157.660787), SENSOR(157.505085),
+    SENSOR(157.349593), SENSOR(157.194313), SENSOR(157.039242), SENSOR(156.884381),
+    SENSOR(156.729730), SENSOR(156.575287), SENSOR(156.421053), SENSOR(156.267026),
+    SENSOR(156.113208), SENSOR(155.959596), SENSOR(155.806191), SENSOR(155.652993),
+    SENSOR(155.500000), SENSOR(155.347213), SENSOR(155.194631), SENSOR(155.042254),
+    SENSOR(154.890080), SENSOR(154.738111), SENSOR(154.586345), SENSOR(154.434783),
+    SENSOR(154.283422), SENSOR(154.132265), SENSOR(153.981308), SENSOR(153.830554),
+    SENSOR(153.680000), SENSOR(153.529647), SENSOR(153.379494), SENSOR(153.229541),
+    SENSOR(153.079787), SENSOR(152.930233), SENSOR(152.780876), SENSOR(152.631719),
+    SENSOR(152.482759), SENSOR(152.333996), SENSOR(152.185430), SENSOR(152.037062),
+    SENSOR(151.888889), SENSOR(151.740912), SENSOR(151.593131), SENSOR(151.445545),
+    SENSOR(151.298153), SENSOR(151.150956), SENSOR(151.003953), SENSOR(150.857143),
+    SENSOR(150.710526), SENSOR(150.564103), SENSOR(150.417871), SENSOR(150.271832),
+    SENSOR(150.125984), SENSOR(149.980328), SENSOR(149.834862), SENSOR(149.689587),
+    SENSOR(149.544503), SENSOR(149.399608), SENSOR(149.254902), SENSOR(149.110385),
+    SENSOR(148.966057), SENSOR(148.821918), SENSOR(148.677966), SENSOR(148.534202),
+    SENSOR(148.390625), SENSOR(148.247235), SENSOR(148.104031), SENSOR(147.961014),
+    SENSOR(147.818182), SENSOR(147.675535), SENSOR(147.533074), SENSOR(147.390797),
+    SENSOR(147.248705), SENSOR(147.106796), SENSOR(146.965071), SENSOR(146.823529),
+    SENSOR(146.682171), SENSOR(146.540994), SENSOR(146.400000), SENSOR(146.259188),
+    SENSOR(146.118557), SENSOR(145.978107), SENSOR(145.837838), SENSOR(145.697749),
+    SENSOR(145.557841), SENSOR(145.418112), SENSOR(145.278562), SENSOR(145.139192),
+    SENSOR(145.000000), SENSOR(144.860987), SENSOR(144.722151), SENSOR(144.583493),
+    SENSOR(144.445013), SENSOR(144.306709), SENSOR(144.168582), SENSOR(144.030632),
+    SENSOR(143.892857), SENSOR(143.755258), SENSOR(143.617834), SENSOR(143.480586),
+    SENSOR(143.343511), SENSOR(143.206612), SENSOR(143.069886), SENSOR(142.933333),
+    SENSOR(142.796954), SENSOR(142.660748), SENSOR(142.524715), SENSOR(142.388854),
+    SENSOR(142.253165), SENSOR(142.117647), SENSOR(141.982301), SENSOR(141.847126),
+    SENSOR(141.712121), SENSOR(141.577287), SENSOR(141.442623), SENSOR(141.308129),
+    SENSOR(141.173804), SENSOR(141.039648), SENSOR(140.905660), SENSOR(140.771842),
+    SENSOR(140.638191), SENSOR(140.504708), SENSOR(140.371393), SENSOR(140.238245),
+    SENSOR(140.105263), SENSOR(139.972448), SENSOR(139.839800), SENSOR(139.707317),
+    SENSOR(139.575000), SENSOR(139.442848), SENSOR(139.310861), SENSOR(139.179039),
+    SENSOR(139.047382), SENSOR(138.915888), SENSOR(138.784558), SENSOR(138.653391),
+    SENSOR(138.522388), SENSOR(138.391548), SENSOR(138.260870), SENSOR(138.130354),
+    SENSOR(138.000000), SENSOR(137.869808), SENSOR(137.739777), SENSOR(137.609907),
+    SENSOR(137.480198), SENSOR(137.350649), SENSOR(137.221261), SENSOR(137.092032),
+    SENSOR(136.962963), SENSOR(136.834053), SENSOR(136.705302), SENSOR(136.576710),
+    SENSOR(136.448276), SENSOR(136.320000), SENSOR(136.191882), SENSOR(136.063921),
+    SENSOR(135.936118), SENSOR(135.808471), SENSOR(135.680982), SENSOR(135.553648),
+    SENSOR(135.426471), SENSOR(135.299449), SENSOR(135.172583), SENSOR(135.045872),
+    SENSOR(134.919315), SENSOR(134.792914), SENSOR(134.666667), SENSOR(134.540574),
+    SENSOR(134.414634), SENSOR(134.288848), SENSOR(134.163216), SENSOR(134.037736),
+    SENSOR(133.912409), SENSOR(133.787234), SENSOR(133.662211), SENSOR(133.537341),
+    SENSOR(133.412621), SENSOR(133.288053), SENSOR(133.163636), SENSOR(133.039370),
+    SENSOR(132.915254), SENSOR(132.791289), SENSOR(132.667473), SENSOR(132.543807),
+    SENSOR(132.420290), SENSOR(132.296922), SENSOR(132.173703), SENSOR(132.050633),
+    SENSOR(131.927711), SENSOR(131.804937), SENSOR(131.682310), SENSOR(131.559832),
+    SENSOR(131.437500), SENSOR(131.315315), SENSOR(131.193277), SENSOR(131.071386),
+    SENSOR(130.949640), SENSOR(130.828041), SENSOR(130.706587), SENSOR(130.585278),
+    SENSOR(130.464115), SENSOR(130.343096), SENSOR(130.222222), SENSOR(130.101493),
+    SENSOR(129.980907), SENSOR(129.860465), SENSOR(129.740167), SENSOR(129.620012),
+    SENSOR(129.500000), SENSOR(129.380131), SENSOR(129.260404), SENSOR(129.140820),
+    SENSOR(129.021378), SENSOR(128.902077), SENSOR(128.782918), SENSOR(128.663900),
+    SENSOR(128.545024), SENSOR(128.426288), SENSOR(128.307692), SENSOR(128.189237),
+    SENSOR(128.070922), SENSOR(127.952747), SENSOR(127.834711), SENSOR(127.716814),
+    SENSOR(127.599057), SENSOR(127.481438), SENSOR(127.363958), SENSOR(127.246616),
+    SENSOR(127.129412), SENSOR(127.012346), SENSOR(126.895417), SENSOR(126.778626),
+    SENSOR(126.661972), SENSOR(126.545455), SENSOR(126.429074), SENSOR(126.312830),
+    SENSOR(126.196721), SENSOR(126.080749), SENSOR(125.964912), SENSOR(125.849211),
+    SENSOR(125.733645), SENSOR(125.618214), SENSOR(125.502917), SENSOR(125.387755),
+    SENSOR(125.272727), SENSOR(125.157833), SENSOR(125.043073), SENSOR(124.928447),
+    SENSOR(124.813953), SENSOR(124.699593), SENSOR(124.585366), SENSOR(124.471271),
+    SENSOR(124.357309), SENSOR(124.243478), SENSOR(124.129780), SENSOR(124.016213),
+    SENSOR(123.902778), SENSOR(123.789474), SENSOR(123.676301), SENSOR(123.563258),
+    SENSOR(123.450346), SENSOR(123.337565), SENSOR(123.224913), SENSOR(123.112392),
+    SENSOR(123.000000), SENSOR(122.887737), SENSOR(122.775604), SENSOR(122.663600),
+    SENSOR(122.551724), SENSOR(122.439977), SENSOR(122.328358), SENSOR(122.216867),
+    SENSOR(122.105505), SENSOR(121.994269), SENSOR(121.883162), SENSOR(121.772181),
+    SENSOR(121.661327), SENSOR(121.550600), SENSOR(121.440000), SENSOR(121.329526),
+    SENSOR(121.219178), SENSOR(121.108956), SENSOR(120.998860), SENSOR(120.888889),
+    SENSOR(120.779043), SENSOR(120.669323), SENSOR(120.559727), SENSOR(120.450256),
+    SENSOR(120.340909), SENSOR(120.231687), SENSOR(120.122588), SENSOR(120.013613),
+    SENSOR(119.904762), SENSOR(119.796034), SENSOR(119.687429), SENSOR(119.578947),
+    SENSOR(119.470588), SENSOR(119.362352), SENSOR(119.254237), SENSOR(119.146245),
+    SENSOR(119.038375), SENSOR(118.930626), SENSOR(118.822999), SENSOR(118.715493),
+    SENSOR(118.608108), SENSOR(118.500844), SENSOR(118.393701), SENSOR(118.286678),
+    SENSOR(118.179775), SENSOR(118.072993), SENSOR(117.966330), SENSOR(117.859787),
+    SENSOR(117.753363), SENSOR(117.647059), SENSOR(117.540873), SENSOR(117.434807),
+    SENSOR(117.328859), SENSOR(117.223030), SENSOR(117.117318), SENSOR(117.011725),
+    SENSOR(116.906250), SENSOR(116.800892), SENSOR(116.695652), SENSOR(116.590529),
+    SENSOR(116.485523), SENSOR(116.380634), SENSOR(116.275862), SENSOR(116.171206),
+    SENSOR(116.066667), SENSOR(115.962243), SENSOR(115.857936), SENSOR(115.753744),
+    SENSOR(115.649667), SENSOR(115.545706), SENSOR(115.441860), SENSOR(115.338129),
+    SENSOR(115.234513), SENSOR(115.131012), SENSOR(115.027624), SENSOR(114.924351),
+    SENSOR(114.821192), SENSOR(114.718147), SENSOR(114.615215), SENSOR(114.512397),
+    SENSOR(114.409692), SENSOR(114.307100), SENSOR(114.204620), SENSOR(114.102254),
+    SENSOR(114.000000), SENSOR(113.897858), SENSOR(113.795829), SENSOR(113.693911),
+    SENSOR(113.592105), SENSOR(113.490411), SENSOR(113.388828), SENSOR(113.287356),
+    SENSOR(113.185996), SENSOR(113.084746), SENSOR(112.983607), SENSOR(112.882578),
+    SENSOR(112.781659), SENSOR(112.680851), SENSOR(112.580153), SENSOR(112.479564),
+    SENSOR(112.379085), SENSOR(112.278715), SENSOR(112.178455), SENSOR(112.078303),
+    SENSOR(111.978261), SENSOR(111.878327), SENSOR(111.778502), SENSOR(111.678785),
+    SENSOR(111.579176), SENSOR(111.479675), SENSOR(111.380282), SENSOR(111.280996),
+    SENSOR(111.181818), SENSOR(111.082747), SENSOR(110.983784), SENSOR(110.884927),
+    SENSOR(110.786177), SENSOR(110.687534), SENSOR(110.588997), SENSOR(110.490566),
+    SENSOR(110.392241), SENSOR(110.294023), SENSOR(110.195910), SENSOR(110.097902),
+    SENSOR(110.000000), SENSOR(109.902203), SENSOR(109.804511), SENSOR(109.706924),
+    SENSOR(109.609442), SENSOR(109.512064), SENSOR(109.414791), SENSOR(109.317622),
+    SENSOR(109.220557), SENSOR(109.123596), SENSOR(109.026738), SENSOR(108.929984),
+    SENSOR(108.833333), SENSOR(108.736786), SENSOR(108.640342), SENSOR(108.544000),
+    SENSOR(108.447761), SENSOR(108.351625), SENSOR(108.255591), SENSOR(108.159659),
+    SENSOR(108.063830), SENSOR(107.968102), SENSOR(107.872476), SENSOR(107.776952),
+    SENSOR(107.681529), SENSOR(107.586207), SENSOR(107.490986), SENSOR(107.395866),
+    SENSOR(107.300847), SENSOR(107.205929), SENSOR(107.111111), SENSOR(107.016393),
+    SENSOR(106.921776), SENSOR(106.827258), SENSOR(106.732841), SENSOR(106.638522),
+    SENSOR(106.544304), SENSOR(106.450185), SENSOR(106.356164), SENSOR(106.262243),
+    SENSOR(106.168421), SENSOR(106.074698), SENSOR(105.981073), SENSOR(105.887546),
+    SENSOR(105.794118), SENSOR(105.700787), SENSOR(105.607555), SENSOR(105.514421),
+    SENSOR(105.421384), SENSOR(105.328444), SENSOR(105.235602), SENSOR(105.142857),
+    SENSOR(105.050209), SENSOR(104.957658), SENSOR(104.865204), SENSOR(104.772846),
+    SENSOR(104.680585), SENSOR(104.588419), SENSOR(104.496350), SENSOR(104.404377),
+    SENSOR(104.312500), SENSOR(104.220718), SENSOR(104.129032), SENSOR(104.037441),
+    SENSOR(103.945946), SENSOR(103.854545), SENSOR(103.763240), SENSOR(103.672029),
+    SENSOR(103.580913), SENSOR(103.489891), SENSOR(103.398964), SENSOR(103.308131),
+    SENSOR(103.217391), SENSOR(103.126746), SENSOR(103.036194), SENSOR(102.945736),
+    SENSOR(102.855372), SENSOR(102.765101), SENSOR(102.674923), SENSOR(102.584838),
+    SENSOR(102.494845), SENSOR(102.404946), SENSOR(102.315139), SENSOR(102.225425),
+    SENSOR(102.135802), SENSOR(102.046272), SENSOR(101.956835), SENSOR(101.867488),
+    SENSOR(101.778234), SENSOR(101.689071), SENSOR(101.600000), SENSOR(101.511020),
+    SENSOR(101.422131), SENSOR(101.333333), SENSOR(101.244626), SENSOR(101.156010),
+    SENSOR(101.067485), SENSOR(100.979050), SENSOR(100.890705), SENSOR(100.802450),
+    SENSOR(100.714286), SENSOR(100.626211), SENSOR(100.538226), SENSOR(100.450331),
+    SENSOR(100.362525), SENSOR(100.274809), SENSOR(100.187182), SENSOR(100.099644),
+    SENSOR(100.012195), SENSOR(99.924835), SENSOR(99.837563), SENSOR(99.750381),
+    SENSOR(99.663286), SENSOR(99.576280), SENSOR(99.489362), SENSOR(99.402532),
+    SENSOR(99.315789), SENSOR(99.229135), SENSOR(99.142568), SENSOR(99.056089),
+    SENSOR(98.969697), SENSOR(98.883392), SENSOR(98.797175), SENSOR(98.711044),
+    SENSOR(98.625000), SENSOR(98.539043), SENSOR(98.453172), SENSOR(98.367388),
+    SENSOR(98.281690), SENSOR(98.196078), SENSOR(98.110553), SENSOR(98.025113),
+    SENSOR(97.939759), SENSOR(97.854491), SENSOR(97.769308), SENSOR(97.684211),
+    SENSOR(97.599198), SENSOR(97.514271), SENSOR(97.429429), SENSOR(97.344672),
+    SENSOR(97.260000), SENSOR(97.175412), SENSOR(97.090909), SENSOR(97.006490),
+    SENSOR(96.922156), SENSOR(96.837905), SENSOR(96.753739), SENSOR(96.669656),
+    SENSOR(96.585657), SENSOR(96.501742), SENSOR(96.417910), SENSOR(96.334162),
+    SENSOR(96.250497), SENSOR(96.166915), SENSOR(96.083416), SENSOR(96.000000),
+    SENSOR(95.916667), SENSOR(95.833416), SENSOR(95.750248), SENSOR(95.667162),
+    SENSOR(95.584158), SENSOR(95.501237), SENSOR(95.418398), SENSOR(95.335640),
+    SENSOR(95.252964), SENSOR(95.170370), SENSOR(95.087858), SENSOR(95.005427),
+    SENSOR(94.923077), SENSOR(94.840808), SENSOR(94.758621), SENSOR(94.676514),
+    SENSOR(94.594488), SENSOR(94.512543), SENSOR(94.430678), SENSOR(94.348894),
+    SENSOR(94.267191), SENSOR(94.185567), SENSOR(94.104024), SENSOR(94.022560),
+    SENSOR(93.941176), SENSOR(93.859873), SENSOR(93.778648), SENSOR(93.697504),
+    SENSOR(93.616438), SENSOR(93.535452), SENSOR(93.454545), SENSOR(93.373718),
+    SENSOR(93.292969), SENSOR(93.212299), SENSOR(93.131707), SENSOR(93.051195),
+    SENSOR(92.970760), SENSOR(92.890404), SENSOR(92.810127), SENSOR(92.729927),
+    SENSOR(92.649805), SENSOR(92.569762), SENSOR(92.489796), SENSOR(92.409908),
+    SENSOR(92.330097), SENSOR(92.250364), SENSOR(92.170708), SENSOR(92.091129),
+    SENSOR(92.011628), SENSOR(91.932203), SENSOR(91.852856), SENSOR(91.773585),
+    SENSOR(91.694391), SENSOR(91.615273), SENSOR(91.536232), SENSOR(91.457267),
+    SENSOR(91.378378), SENSOR(91.299566), SENSOR(91.220829), SENSOR(91.142169),
+    SENSOR(91.063584), SENSOR(90.985075), SENSOR(90.906641), SENSOR(90.828283),
+    SENSOR(90.750000), SENSOR(90.671792), SENSOR(90.593660), SENSOR(90.515602),
+    SENSOR(90.437620), SENSOR(90.359712), SENSOR(90.281879), SENSOR(90.204121),
+    SENSOR(90.126437), SENSOR(90.048827), SENSOR(89.971292), SENSOR(89.893831),
+    SENSOR(89.816444), SENSOR(89.739130), SENSOR(89.661891), SENSOR(89.584726),
+    SENSOR(89.507634), SENSOR(89.430615), SENSOR(89.353670), SENSOR(89.276798),
+    SENSOR(89.200000), SENSOR(89.123275), SENSOR(89.046622), SENSOR(88.970043),
+    SENSOR(88.893536), SENSOR(88.817102), SENSOR(88.740741), SENSOR(88.664452),
+    SENSOR(88.588235), SENSOR(88.512091), SENSOR(88.436019), SENSOR(88.360019),
+    SENSOR(88.284091), SENSOR(88.208235), SENSOR(88.132450), SENSOR(88.056738),
+    SENSOR(87.981096), SENSOR(87.905527), SENSOR(87.830028), SENSOR(87.754601),
+    SENSOR(87.679245), SENSOR(87.603960), SENSOR(87.528746), SENSOR(87.453603),
+    SENSOR(87.378531), SENSOR(87.303529), SENSOR(87.228598), SENSOR(87.153738),
+    SENSOR(87.078947), SENSOR(87.004227), SENSOR(86.929577), SENSOR(86.854998),
+    SENSOR(86.780488), SENSOR(86.706048), SENSOR(86.631678), SENSOR(86.557377),
+    SENSOR(86.483146), SENSOR(86.408985), SENSOR(86.334892), SENSOR(86.260870),
+    SENSOR(86.186916), SENSOR(86.113031), SENSOR(86.039216), SENSOR(85.965469),
+    SENSOR(85.891791), SENSOR(85.818182), SENSOR(85.744641), SENSOR(85.671169),
+    SENSOR(85.597765), SENSOR(85.524430), SENSOR(85.451163), SENSOR(85.377964),
+    SENSOR(85.304833), SENSOR(85.231770), SENSOR(85.158774), SENSOR(85.085847),
+    SENSOR(85.012987), SENSOR(84.940195), SENSOR(84.867470), SENSOR(84.794812),
+    SENSOR(84.722222), SENSOR(84.649699), SENSOR(84.577243), SENSOR(84.504854),
+    SENSOR(84.432532), SENSOR(84.360277), SENSOR(84.288089), SENSOR(84.215967),
+    SENSOR(84.143911), SENSOR(84.071923), SENSOR(84.000000), SENSOR(83.928144),
+    SENSOR(83.856354), SENSOR(83.784630), SENSOR(83.712971), SENSOR(83.641379),
+    SENSOR(83.569853), SENSOR(83.498392), SENSOR(83.426997), SENSOR(83.355668),
+    SENSOR(83.284404), SENSOR(83.213205), SENSOR(83.142071), SENSOR(83.071003),
+    SENSOR(83.000000), SENSOR(82.929062), SENSOR(82.858188), SENSOR(82.787380),
+    SENSOR(82.716636), SENSOR(82.645957), SENSOR(82.575342), SENSOR(82.504792),
+    SENSOR(82.434307), SENSOR(82.363885), SENSOR(82.293528), SENSOR(82.223235),
+    SENSOR(82.153005), SENSOR(82.082840), SENSOR(82.012739), SENSOR(81.942701),
+    SENSOR(81.872727), SENSOR(81.802817), SENSOR(81.732970), SENSOR(81.663187),
+    SENSOR(81.593466), SENSOR(81.523810), SENSOR(81.454216), SENSOR(81.384685),
+    SENSOR(81.315217), SENSOR(81.245813), SENSOR(81.176471), SENSOR(81.107191),
+    SENSOR(81.037975), SENSOR(80.968821), SENSOR(80.899729), SENSOR(80.830700),
+    SENSOR(80.761733), SENSOR(80.692828), SENSOR(80.623986), SENSOR(80.555205),
+    SENSOR(80.486486), SENSOR(80.417830), SENSOR(80.349235), SENSOR(80.280702),
+    SENSOR(80.212230), SENSOR(80.143820), SENSOR(80.075472), SENSOR(80.007185),
+    SENSOR(79.938959), SENSOR(79.870794), SENSOR(79.802691), SENSOR(79.734648),
+    SENSOR(79.666667), SENSOR(79.598746), SENSOR(79.530886), SENSOR(79.463087),
+    SENSOR(79.395349), SENSOR(79.327671), SENSOR(79.260054), SENSOR(79.192497),
+    SENSOR(79.125000), SENSOR(79.057564), SENSOR(78.990187), SENSOR(78.922871),
+    SENSOR(78.855615), SENSOR(78.788419), SENSOR(78.721282), SENSOR(78.654206),
+    SENSOR(78.587189), SENSOR(78.520231), SENSOR(78.453333), SENSOR(78.386495),
+    SENSOR(78.319716), SENSOR(78.252996), SENSOR(78.186335), SENSOR(78.119734),
+    SENSOR(78.053191), SENSOR(77.986708), SENSOR(77.920283), SENSOR(77.853918),
+    SENSOR(77.787611), SENSOR(77.721362), SENSOR(77.655172), SENSOR(77.589041),
+    SENSOR(77.522968), SENSOR(77.456954), SENSOR(77.390997), SENSOR(77.325099),
+    SENSOR(77.259259), SENSOR(77.193477), SENSOR(77.127753), SENSOR(77.062087),
+    SENSOR(76.996479), SENSOR(76.930928), SENSOR(76.865435), SENSOR(76.800000),
+    SENSOR(76.734622), SENSOR(76.669302), SENSOR(76.604039), SENSOR(76.538833),
+    SENSOR(76.473684), SENSOR(76.408593), SENSOR(76.343558), SENSOR(76.278581),
+    SENSOR(76.213660), SENSOR(76.148796), SENSOR(76.083990), SENSOR(76.019239),
+    SENSOR(75.954545), SENSOR(75.889908), SENSOR(75.825328), SENSOR(75.760803),
+    SENSOR(75.696335), SENSOR(75.631923), SENSOR(75.567568), SENSOR(75.503268),
+    SENSOR(75.439024), SENSOR(75.374837), SENSOR(75.310705), SENSOR(75.246629),
+    SENSOR(75.182609), SENSOR(75.118644), SENSOR(75.054735), SENSOR(74.990881),
+    SENSOR(74.927083), SENSOR(74.863341), SENSOR(74.799653), SENSOR(74.736021),
+    SENSOR(74.672444), SENSOR(74.608922), SENSOR(74.545455), SENSOR(74.482042),
+    SENSOR(74.418685), SENSOR(74.355383), SENSOR(74.292135), SENSOR(74.228942),
+    SENSOR(74.165803), SENSOR(74.102719), SENSOR(74.039689), SENSOR(73.976714),
+    SENSOR(73.913793), SENSOR(73.850926), SENSOR(73.788114), SENSOR(73.725355),
+    SENSOR(73.662651), SENSOR(73.600000), SENSOR(73.537403), SENSOR(73.474860),
+    SENSOR(73.412371), SENSOR(73.349936), SENSOR(73.287554), SENSOR(73.225225),
+    SENSOR(73.162950), SENSOR(73.100729), SENSOR(73.038560), SENSOR(72.976445),
+    SENSOR(72.914384), SENSOR(72.852375), SENSOR(72.790419), SENSOR(72.728516),
+    SENSOR(72.666667), SENSOR(72.604870), SENSOR(72.543126), SENSOR(72.481434),
+    SENSOR(72.419795), SENSOR(72.358209), SENSOR(72.296675), SENSOR(72.235194),
+    SENSOR(72.173765), SENSOR(72.112388), SENSOR(72.051064), SENSOR(71.989792),
+    SENSOR(71.928571), SENSOR(71.867403), SENSOR(71.806287), SENSOR(71.745223),
+    SENSOR(71.684211), SENSOR(71.623250), SENSOR(71.562341), SENSOR(71.501484),
+    SENSOR(71.440678), SENSOR(71.379924), SENSOR(71.319221), SENSOR(71.258570),
+    SENSOR(71.197970), SENSOR(71.137421), SENSOR(71.076923), SENSOR(71.016477),
+    SENSOR(70.956081), SENSOR(70.895737), SENSOR(70.835443), SENSOR(70.775200),
+    SENSOR(70.715008), SENSOR(70.654867), SENSOR(70.594777), SENSOR(70.534737),
+    SENSOR(70.474747), SENSOR(70.414809), SENSOR(70.354920), SENSOR(70.295082),
+    SENSOR(70.235294), SENSOR(70.175556), SENSOR(70.115869), SENSOR(70.056232),
+    SENSOR(69.996644), SENSOR(69.937107), SENSOR(69.877619), SENSOR(69.818182),
+    SENSOR(69.758794), SENSOR(69.699456), SENSOR(69.640167), SENSOR(69.580928),
+    SENSOR(69.521739), SENSOR(69.462599), SENSOR(69.403509), SENSOR(69.344468),
+    SENSOR(69.285476), SENSOR(69.226533), SENSOR(69.167640), SENSOR(69.108795),
+    SENSOR(69.050000), SENSOR(68.991254), SENSOR(68.932556), SENSOR(68.873908),
+    SENSOR(68.815308), SENSOR(68.756757), SENSOR(68.698254), SENSOR(68.639801),
+    SENSOR(68.581395), SENSOR(68.523039), SENSOR(68.464730), SENSOR(68.406470),
+    SENSOR(68.348259), SENSOR(68.290095), SENSOR(68.231980), SENSOR(68.173913),
+    SENSOR(68.115894), SENSOR(68.057923), SENSOR(68.000000), SENSOR(67.942125),
+    SENSOR(67.884298), SENSOR(67.826518), SENSOR(67.768786), SENSOR(67.711102),
+    SENSOR(67.653465), SENSOR(67.595876), SENSOR(67.538335), SENSOR(67.480841),
+    SENSOR(67.423394), SENSOR(67.365994), SENSOR(67.308642), SENSOR(67.251337),
+    SENSOR(67.194079), SENSOR(67.136868), SENSOR(67.079704), SENSOR(67.022587),
+    SENSOR(66.965517), SENSOR(66.908494), SENSOR(66.851518), SENSOR(66.794588),
+    SENSOR(66.737705), SENSOR(66.680868), SENSOR(66.624079), SENSOR(66.567335),
+    SENSOR(66.510638), SENSOR(66.453988), SENSOR(66.397383), SENSOR(66.340826),
+    SENSOR(66.284314), SENSOR(66.227848), SENSOR(66.171429), SENSOR(66.115055),
+    SENSOR(66.058728), SENSOR(66.002446), SENSOR(65.946210), SENSOR(65.890020),
+    SENSOR(65.833876), SENSOR(65.777778), SENSOR(65.721725), SENSOR(65.665718),
+    SENSOR(65.609756), SENSOR(65.553840), SENSOR(65.497969), SENSOR(65.442144),
+    SENSOR(65.386364), SENSOR(65.330629), SENSOR(65.274939), SENSOR(65.219295),
+    SENSOR(65.163695), SENSOR(65.108141), SENSOR(65.052632), SENSOR(64.997167),
+    SENSOR(64.941748), SENSOR(64.886373), SENSOR(64.831043), SENSOR(64.775758),
+    SENSOR(64.720517), SENSOR(64.665321), SENSOR(64.610169), SENSOR(64.555063),
+    SENSOR(64.500000), SENSOR(64.444982), SENSOR(64.390008), SENSOR(64.335079),
+    SENSOR(64.280193), SENSOR(64.225352), SENSOR(64.170555), SENSOR(64.115802),
+    SENSOR(64.061093), SENSOR(64.006428), SENSOR(63.951807), SENSOR(63.897230),
+    SENSOR(63.842697), SENSOR(63.788207), SENSOR(63.733761), SENSOR(63.679359),
+    SENSOR(63.625000), SENSOR(63.570685), SENSOR(63.516413), SENSOR(63.462185),
+    SENSOR(63.408000), SENSOR(63.353858), SENSOR(63.299760), SENSOR(63.245705),
+    SENSOR(63.191693), SENSOR(63.137725), SENSOR(63.083799), SENSOR(63.029916),
+    SENSOR(62.976077), SENSOR(62.922280), SENSOR(62.868526), SENSOR(62.814815),
+    SENSOR(62.761146), SENSOR(62.707521), SENSOR(62.653938), SENSOR(62.600398),
+    SENSOR(62.546900), SENSOR(62.493445), SENSOR(62.440032), SENSOR(62.386661),
+    SENSOR(62.333333), SENSOR(62.280048), SENSOR(62.226804), SENSOR(62.173603),
+    SENSOR(62.120444), SENSOR(62.067327), SENSOR(62.014252), SENSOR(61.961219),
+    SENSOR(61.908228), SENSOR(61.855279), SENSOR(61.802372), SENSOR(61.749506),
+    SENSOR(61.696682), SENSOR(61.643901), SENSOR(61.591160), SENSOR(61.538462),
+    SENSOR(61.485804), SENSOR(61.433189), SENSOR(61.380615), SENSOR(61.328082),
+    SENSOR(61.275591), SENSOR(61.223140), SENSOR(61.170732), SENSOR(61.118364),
+    SENSOR(61.066038), SENSOR(61.013752), SENSOR(60.961508), SENSOR(60.909305),
+    SENSOR(60.857143), SENSOR(60.805022), SENSOR(60.752941), SENSOR(60.700902),
+    SENSOR(60.648903), SENSOR(60.596945), SENSOR(60.545027), SENSOR(60.493151),
+    SENSOR(60.441315), SENSOR(60.389519), SENSOR(60.337764), SENSOR(60.286049),
+    SENSOR(60.234375), SENSOR(60.182741), SENSOR(60.131148), SENSOR(60.079594),
+    SENSOR(60.028081), SENSOR(59.976608), SENSOR(59.925175), SENSOR(59.873783),
+    SENSOR(59.822430), SENSOR(59.771117), SENSOR(59.719844), SENSOR(59.668611),
+    SENSOR(59.617418), SENSOR(59.566265), SENSOR(59.515152), SENSOR(59.464078),
+    SENSOR(59.413043), SENSOR(59.362049), SENSOR(59.311094), SENSOR(59.260178),
+    SENSOR(59.209302), SENSOR(59.158466), SENSOR(59.107668), SENSOR(59.056911),
+    SENSOR(59.006192), SENSOR(58.955513), SENSOR(58.904872), SENSOR(58.854271),
+    SENSOR(58.803709), SENSOR(58.753187), SENSOR(58.702703), SENSOR(58.652258),
+    SENSOR(58.601852), SENSOR(58.551485), SENSOR(58.501157), SENSOR(58.450867),
+    SENSOR(58.400616), SENSOR(58.350404), SENSOR(58.300231), SENSOR(58.250096),
+    SENSOR(58.200000), SENSOR(58.149942), SENSOR(58.099923), SENSOR(58.049942),
+    SENSOR(58.000000), SENSOR(57.950096), SENSOR(57.900230), SENSOR(57.850403),
+    SENSOR(57.800613), SENSOR(57.750862), SENSOR(57.701149), SENSOR(57.651475),
+    SENSOR(57.601838), SENSOR(57.552239), SENSOR(57.502678), SENSOR(57.453155),
+    SENSOR(57.403670), SENSOR(57.354222), SENSOR(57.304813), SENSOR(57.255441),
+    SENSOR(57.206107), SENSOR(57.156810), SENSOR(57.107551), SENSOR(57.058330),
+    SENSOR(57.009146), SENSOR(56.960000), SENSOR(56.910891), SENSOR(56.861820),
+    SENSOR(56.812785), SENSOR(56.763789), SENSOR(56.714829), SENSOR(56.665906),
+    SENSOR(56.617021), SENSOR(56.568173), SENSOR(56.519362), SENSOR(56.470588),
+    SENSOR(56.421851), SENSOR(56.373151), SENSOR(56.324488), SENSOR(56.275862),
+    SENSOR(56.227273), SENSOR(56.178720), SENSOR(56.130204), SENSOR(56.081725),
+    SENSOR(56.033283), SENSOR(55.984877), SENSOR(55.936508), SENSOR(55.888175),
+    SENSOR(55.839879), SENSOR(55.791619), SENSOR(55.743396), SENSOR(55.695209),
+    SENSOR(55.647059), SENSOR(55.598945), SENSOR(55.550867), SENSOR(55.502825),
+    SENSOR(55.454819), SENSOR(55.406850), SENSOR(55.358916), SENSOR(55.311019),
+    SENSOR(55.263158), SENSOR(55.215333), SENSOR(55.167543), SENSOR(55.119790),
+    SENSOR(55.072072), SENSOR(55.024390), SENSOR(54.976744), SENSOR(54.929134),
+    SENSOR(54.881559), SENSOR(54.834020), SENSOR(54.786517), SENSOR(54.739049),
+    SENSOR(54.691617), SENSOR(54.644220), SENSOR(54.596859), SENSOR(54.549533),
+    SENSOR(54.502242), SENSOR(54.454987), SENSOR(54.407767), SENSOR(54.360582),
+    SENSOR(54.313433), SENSOR(54.266319), SENSOR(54.219239), SENSOR(54.172195),
+    SENSOR(54.125186), SENSOR(54.078212), SENSOR(54.031273), SENSOR(53.984369),
+    SENSOR(53.937500), SENSOR(53.890666), SENSOR(53.843866), SENSOR(53.797101),
+    SENSOR(53.750371), SENSOR(53.703676), SENSOR(53.657016), SENSOR(53.610390),
+    SENSOR(53.563798), SENSOR(53.517241), SENSOR(53.470719), SENSOR(53.424231),
+    SENSOR(53.377778), SENSOR(53.331359), SENSOR(53.284974), SENSOR(53.238624),
+    SENSOR(53.192308), SENSOR(53.146026), SENSOR(53.099778), SENSOR(53.053565),
+    SENSOR(53.007386), SENSOR(52.961240), SENSOR(52.915129), SENSOR(52.869052),
+    SENSOR(52.823009), SENSOR(52.777000), SENSOR(52.731024), SENSOR(52.685083),
+    SENSOR(52.639175), SENSOR(52.593301), SENSOR(52.547461), SENSOR(52.501655),
+    SENSOR(52.455882), SENSOR(52.410143), SENSOR(52.364438), SENSOR(52.318766),
+    SENSOR(52.273128), SENSOR(52.227523), SENSOR(52.181952), SENSOR(52.136414),
+    SENSOR(52.090909), SENSOR(52.045438), SENSOR(52.000000), SENSOR(51.954595),
+    SENSOR(51.909224), SENSOR(51.863886), SENSOR(51.818581), SENSOR(51.773309),
+    SENSOR(51.728070), SENSOR(51.682864), SENSOR(51.637692), SENSOR(51.592552),
+    SENSOR(51.547445), SENSOR(51.502371), SENSOR(51.457330), SENSOR(51.412322),
+    SENSOR(51.367347), SENSOR(51.322404), SENSOR(51.277495), SENSOR(51.232617),
+    SENSOR(51.187773), SENSOR(51.142961), SENSOR(51.098182), SENSOR(51.053435),
+    SENSOR(51.008721), SENSOR(50.964039), SENSOR(50.919390), SENSOR(50.874773),
+    SENSOR(50.830189), SENSOR(50.785637), SENSOR(50.741117), SENSOR(50.696629),
+    SENSOR(50.652174), SENSOR(50.607751), SENSOR(50.563360), SENSOR(50.519001),
+    SENSOR(50.474674), SENSOR(50.430380), SENSOR(50.386117), SENSOR(50.341887),
+    SENSOR(50.297688), SENSOR(50.253521), SENSOR(50.209386), SENSOR(50.165283),
+    SENSOR(50.121212), SENSOR(50.077173), SENSOR(50.033165), SENSOR(49.989189),
+    SENSOR(49.945245), SENSOR(49.901332), SENSOR(49.857451), SENSOR(49.813602),
+    SENSOR(49.769784), SENSOR(49.725998), SENSOR(49.682243), SENSOR(49.638520),
+    SENSOR(49.594828), SENSOR(49.551167), SENSOR(49.507538), SENSOR(49.463940),
+    SENSOR(49.420373), SENSOR(49.376838), SENSOR(49.333333), SENSOR(49.289860),
+    SENSOR(49.246418), SENSOR(49.203008), SENSOR(49.159628), SENSOR(49.116279),
+    SENSOR(49.072961), SENSOR(49.029675), SENSOR(48.986419), SENSOR(48.943194),
+    SENSOR(48.900000), SENSOR(48.856837), SENSOR(48.813704), SENSOR(48.770603),
+    SENSOR(48.727532), SENSOR(48.684492), SENSOR(48.641483), SENSOR(48.598504),
+    SENSOR(48.555556), SENSOR(48.512638), SENSOR(48.469751), SENSOR(48.426894),
+    SENSOR(48.384068), SENSOR(48.341273), SENSOR(48.298507), SENSOR(48.255773),
+    SENSOR(48.213068), SENSOR(48.170394), SENSOR(48.127750), SENSOR(48.085137),
+    SENSOR(48.042553), SENSOR(48.000000), SENSOR(47.957477), SENSOR(47.914984),
+    SENSOR(47.872521), SENSOR(47.830088), SENSOR(47.787686), SENSOR(47.745313),
+    SENSOR(47.702970), SENSOR(47.660657), SENSOR(47.618375), SENSOR(47.576122),
+    SENSOR(47.533898), SENSOR(47.491705), SENSOR(47.449541), SENSOR(47.407407),
+    SENSOR(47.365303), SENSOR(47.323229), SENSOR(47.281184), SENSOR(47.239169),
+    SENSOR(47.197183), SENSOR(47.155227), SENSOR(47.113300), SENSOR(47.071403),
+    SENSOR(47.029536), SENSOR(46.987698), SENSOR(46.945889), SENSOR(46.904110),
+    SENSOR(46.862360), SENSOR(46.820639), SENSOR(46.778947), SENSOR(46.737285),
+    SENSOR(46.695652), SENSOR(46.654048), SENSOR(46.612474), SENSOR(46.570928),
+    SENSOR(46.529412), SENSOR(46.487924), SENSOR(46.446466), SENSOR(46.405037),
+    SENSOR(46.363636), SENSOR(46.322265), SENSOR(46.280922), SENSOR(46.239609),
+    SENSOR(46.198324), SENSOR(46.157068), SENSOR(46.115841), SENSOR(46.074642),
+    SENSOR(46.033473), SENSOR(45.992332), SENSOR(45.951220), SENSOR(45.910136),
+    SENSOR(45.869081), SENSOR(45.828054), SENSOR(45.787056), SENSOR(45.746087),
+    SENSOR(45.705146), SENSOR(45.664234), SENSOR(45.623350), SENSOR(45.582494),
+    SENSOR(45.541667), SENSOR(45.500868), SENSOR(45.460097), SENSOR(45.419355),
+    SENSOR(45.378641), SENSOR(45.337955), SENSOR(45.297297), SENSOR(45.256668),
+    SENSOR(45.216066), SENSOR(45.175493), SENSOR(45.134948), SENSOR(45.094431),
+    SENSOR(45.053942), SENSOR(45.013481), SENSOR(44.973048), SENSOR(44.932642),
+    SENSOR(44.892265), SENSOR(44.851916), SENSOR(44.811594), SENSOR(44.771300),
+    SENSOR(44.731034), SENSOR(44.690796), SENSOR(44.650586), SENSOR(44.610403),
+    SENSOR(44.570248), SENSOR(44.530120), SENSOR(44.490021), SENSOR(44.449948),
+    SENSOR(44.409904), SENSOR(44.369887), SENSOR(44.329897), SENSOR(44.289935),
+    SENSOR(44.250000), SENSOR(44.210093), SENSOR(44.170213), SENSOR(44.130360),
+    SENSOR(44.090535), SENSOR(44.050737), SENSOR(44.010966), SENSOR(43.971223),
+    SENSOR(43.931507), SENSOR(43.891818), SENSOR(43.852156), SENSOR(43.812521),
+    SENSOR(43.772914), SENSOR(43.733333), SENSOR(43.693780), SENSOR(43.654254),
+    SENSOR(43.614754), SENSOR(43.575282), SENSOR(43.535836), SENSOR(43.496418),
+    SENSOR(43.457026), SENSOR(43.417661), SENSOR(43.378323), SENSOR(43.339012),
+    SENSOR(43.299728), SENSOR(43.260470), SENSOR(43.221239), SENSOR(43.182035),
+    SENSOR(43.142857), SENSOR(43.103706), SENSOR(43.064582), SENSOR(43.025484),
+    SENSOR(42.986413), SENSOR(42.947368), SENSOR(42.908350), SENSOR(42.869359),
+    SENSOR(42.830393), SENSOR(42.791455), SENSOR(42.752542), SENSOR(42.713656),
+    SENSOR(42.674797), SENSOR(42.635963), SENSOR(42.597156), SENSOR(42.558376),
+    SENSOR(42.519621), SENSOR(42.480893), SENSOR(42.442191), SENSOR(42.403515),
+    SENSOR(42.364865), SENSOR(42.326241), SENSOR(42.287643), SENSOR(42.249072),
+    SENSOR(42.210526), SENSOR(42.172007), SENSOR(42.133513), SENSOR(42.095046),
+    SENSOR(42.056604), SENSOR(42.018188), SENSOR(41.979798), SENSOR(41.941434),
+    SENSOR(41.903096), SENSOR(41.864783), SENSOR(41.826496), SENSOR(41.788235),
+    SENSOR(41.750000), SENSOR(41.711790), SENSOR(41.673606), SENSOR(41.635448),
+    SENSOR(41.597315), SENSOR(41.559208), SENSOR(41.521127), SENSOR(41.483071),
+    SENSOR(41.445040), SENSOR(41.407035), SENSOR(41.369056), SENSOR(41.331101),
+    SENSOR(41.293173), SENSOR(41.255269), SENSOR(41.217391), SENSOR(41.179539),
+    SENSOR(41.141711), SENSOR(41.103909), SENSOR(41.066132), SENSOR(41.028381),
+    SENSOR(40.990654), SENSOR(40.952953), SENSOR(40.915277), SENSOR(40.877626),
+    SENSOR(40.840000), SENSOR(40.802399), SENSOR(40.764823), SENSOR(40.727273),
+    SENSOR(40.689747), SENSOR(40.652246), SENSOR(40.614770), SENSOR(40.577320),
+    SENSOR(40.539894), SENSOR(40.502493), SENSOR(40.465116), SENSOR(40.427765),
+    SENSOR(40.390438), SENSOR(40.353136), SENSOR(40.315859), SENSOR(40.278607),
+    SENSOR(40.241379), SENSOR(40.204176), SENSOR(40.166998), SENSOR(40.129844),
+    SENSOR(40.092715), SENSOR(40.055611), SENSOR(40.018531), SENSOR(39.981475),
+    SENSOR(39.944444), SENSOR(39.907438), SENSOR(39.870456), SENSOR(39.833499),
+    SENSOR(39.796565), SENSOR(39.759657), SENSOR(39.722772), SENSOR(39.685912),
+    SENSOR(39.649077), SENSOR(39.612265), SENSOR(39.575478), SENSOR(39.538715),
+    SENSOR(39.501976), SENSOR(39.465262), SENSOR(39.428571), SENSOR(39.391905),
+    SENSOR(39.355263), SENSOR(39.318645), SENSOR(39.282051), SENSOR(39.245481),
+    SENSOR(39.208936), SENSOR(39.172414), SENSOR(39.135916), SENSOR(39.099442),
+    SENSOR(39.062992), SENSOR(39.026566), SENSOR(38.990164), SENSOR(38.953786),
+    SENSOR(38.917431), SENSOR(38.881101), SENSOR(38.844794), SENSOR(38.808511),
+    SENSOR(38.772251), SENSOR(38.736016), SENSOR(38.699804), SENSOR(38.663616),
+    SENSOR(38.627451), SENSOR(38.591310), SENSOR(38.555193), SENSOR(38.519099),
+    SENSOR(38.483029), SENSOR(38.446982), SENSOR(38.410959), SENSOR(38.374959),
+    SENSOR(38.338983), SENSOR(38.303030), SENSOR(38.267101), SENSOR(38.231195),
+    SENSOR(38.195313), SENSOR(38.159453), SENSOR(38.123617), SENSOR(38.087805),
+    SENSOR(38.052016), SENSOR(38.016250), SENSOR(37.980507), SENSOR(37.944787),
+    SENSOR(37.909091), SENSOR(37.873418), SENSOR(37.837768), SENSOR(37.802141),
+    SENSOR(37.766537), SENSOR(37.730956), SENSOR(37.695399), SENSOR(37.659864),
+    SENSOR(37.624352), SENSOR(37.588864), SENSOR(37.553398), SENSOR(37.517955),
+    SENSOR(37.482536), SENSOR(37.447139), SENSOR(37.411765), SENSOR(37.376414),
+    SENSOR(37.341085), SENSOR(37.305780), SENSOR(37.270497), SENSOR(37.235237),
+    SENSOR(37.200000), SENSOR(37.164786), SENSOR(37.129594), SENSOR(37.094425),
+    SENSOR(37.059278), SENSOR(37.024155), SENSOR(36.989053), SENSOR(36.953975),
+    SENSOR(36.918919), SENSOR(36.883885), SENSOR(36.848875), SENSOR(36.813886),
+    SENSOR(36.778920), SENSOR(36.743977), SENSOR(36.709056), SENSOR(36.674157),
+    SENSOR(36.639281), SENSOR(36.604427), SENSOR(36.569596), SENSOR(36.534787),
+    SENSOR(36.500000), SENSOR(36.465236), SENSOR(36.430493), SENSOR(36.395773),
+    SENSOR(36.361076), SENSOR(36.326400), SENSOR(36.291747), SENSOR(36.257115),
+    SENSOR(36.222506), SENSOR(36.187919), SENSOR(36.153355), SENSOR(36.118812),
+    SENSOR(36.084291), SENSOR(36.049793), SENSOR(36.015316), SENSOR(35.980861),
+    SENSOR(35.946429), SENSOR(35.912018), SENSOR(35.877629), SENSOR(35.843262),
+    SENSOR(35.808917), SENSOR(35.774594), SENSOR(35.740293), SENSOR(35.706013),
+    SENSOR(35.671756), SENSOR(35.637520), SENSOR(35.603306), SENSOR(35.569113),
+    SENSOR(35.534943), SENSOR(35.500794), SENSOR(35.466667), SENSOR(35.432561),
+    SENSOR(35.398477), SENSOR(35.364415), SENSOR(35.330374), SENSOR(35.296355),
+    SENSOR(35.262357), SENSOR(35.228381), SENSOR(35.194427), SENSOR(35.160494),
+    SENSOR(35.126582), SENSOR(35.092692), SENSOR(35.058824), SENSOR(35.024976),
+    SENSOR(34.991150), SENSOR(34.957346), SENSOR(34.923563), SENSOR(34.889801),
+    SENSOR(34.856061), SENSOR(34.822341), SENSOR(34.788644), SENSOR(34.754967),
+    SENSOR(34.721311), SENSOR(34.687677), SENSOR(34.654064), SENSOR(34.620472),
+    SENSOR(34.586902), SENSOR(34.553352), SENSOR(34.519824), SENSOR(34.486316),
+    SENSOR(34.452830), SENSOR(34.419365), SENSOR(34.385921), SENSOR(34.352498),
+    SENSOR(34.319095), SENSOR(34.285714), SENSOR(34.252354), SENSOR(34.219015),
+    SENSOR(34.185696), SENSOR(34.152399), SENSOR(34.119122), SENSOR(34.085866),
+    SENSOR(34.052632), SENSOR(34.019417), SENSOR(33.986224), SENSOR(33.953052),
+    SENSOR(33.919900), SENSOR(33.886769), SENSOR(33.853659), SENSOR(33.820569),
+    SENSOR(33.787500), SENSOR(33.754452), SENSOR(33.721424), SENSOR(33.688417),
+    SENSOR(33.655431), SENSOR(33.622465), SENSOR(33.589520), SENSOR(33.556595),
+    SENSOR(33.523691), SENSOR(33.490807), SENSOR(33.457944), SENSOR(33.425101),
+    SENSOR(33.392279), SENSOR(33.359477), SENSOR(33.326696), SENSOR(33.293935),
+    SENSOR(33.261194), SENSOR(33.228474), SENSOR(33.195774), SENSOR(33.163094),
+    SENSOR(33.130435), SENSOR(33.097796), SENSOR(33.065177), SENSOR(33.032578),
+    SENSOR(33.000000), SENSOR(32.967442), SENSOR(32.934904), SENSOR(32.902386),
+    SENSOR(32.869888), SENSOR(32.837411), SENSOR(32.804954), SENSOR(32.772516),
+    SENSOR(32.740099), SENSOR(32.707702), SENSOR(32.675325), SENSOR(32.642968),
+    SENSOR(32.610630), SENSOR(32.578313), SENSOR(32.546016), SENSOR(32.513739),
+    SENSOR(32.481481), SENSOR(32.449244), SENSOR(32.417027), SENSOR(32.384829),
+    SENSOR(32.352651), SENSOR(32.320493), SENSOR(32.288355), SENSOR(32.256237),
+    SENSOR(32.224138), SENSOR(32.192059), SENSOR(32.160000), SENSOR(32.127961),
+    SENSOR(32.095941), SENSOR(32.063941), SENSOR(32.031961), SENSOR(32.000000),
+    SENSOR(31.968059), SENSOR(31.936138), SENSOR(31.904236), SENSOR(31.872353),
+    SENSOR(31.840491), SENSOR(31.808648), SENSOR(31.776824), SENSOR(31.745020),
+    SENSOR(31.713235), SENSOR(31.681470), SENSOR(31.649724), SENSOR(31.617998),
+    SENSOR(31.586291), SENSOR(31.554604), SENSOR(31.522936), SENSOR(31.491287),
+    SENSOR(31.459658), SENSOR(31.428048), SENSOR(31.396457), SENSOR(31.364885),
+    SENSOR(31.333333), SENSOR(31.301800), SENSOR(31.270287), SENSOR(31.238792),
+    SENSOR(31.207317), SENSOR(31.175861), SENSOR(31.144424), SENSOR(31.113006),
+    SENSOR(31.081608), SENSOR(31.050228), SENSOR(31.018868), SENSOR(30.987527),
+    SENSOR(30.956204), SENSOR(30.924901), SENSOR(30.893617), SENSOR(30.862352),
+    SENSOR(30.831106), SENSOR(30.799879), SENSOR(30.768670), SENSOR(30.737481),
+    SENSOR(30.706311), SENSOR(30.675159), SENSOR(30.644027), SENSOR(30.612913),
+    SENSOR(30.581818), SENSOR(30.550742), SENSOR(30.519685), SENSOR(30.488647),
+    SENSOR(30.457627), SENSOR(30.426626), SENSOR(30.395644), SENSOR(30.364681),
+    SENSOR(30.333736), SENSOR(30.302811), SENSOR(30.271903), SENSOR(30.241015),
+    SENSOR(30.210145), SENSOR(30.179294), SENSOR(30.148461), SENSOR(30.117647),
+    SENSOR(30.086852), SENSOR(30.056075), SENSOR(30.025316), SENSOR(29.994577),
+    SENSOR(29.963855), SENSOR(29.933153), SENSOR(29.902468), SENSOR(29.871803),
+    SENSOR(29.841155), SENSOR(29.810526), SENSOR(29.779916), SENSOR(29.749324),
+    SENSOR(29.718750), SENSOR(29.688195), SENSOR(29.657658), SENSOR(29.627139),
+    SENSOR(29.596639), SENSOR(29.566157), SENSOR(29.535693), SENSOR(29.505247),
+    SENSOR(29.474820), SENSOR(29.444411), SENSOR(29.414020), SENSOR(29.383648),
+    SENSOR(29.353293), SENSOR(29.322957), SENSOR(29.292639), SENSOR(29.262339),
+    SENSOR(29.232057), SENSOR(29.201794), SENSOR(29.171548), SENSOR(29.141321),
+    SENSOR(29.111111), SENSOR(29.080920), SENSOR(29.050746), SENSOR(29.020591),
+    SENSOR(28.990453), SENSOR(28.960334), SENSOR(28.930233), SENSOR(28.900149),
+    SENSOR(28.870083), SENSOR(28.840036), SENSOR(28.810006), SENSOR(28.779994),
+    SENSOR(28.750000), SENSOR(28.720024), SENSOR(28.690065), SENSOR(28.660125),
+    SENSOR(28.630202), SENSOR(28.600297), SENSOR(28.570410), SENSOR(28.540541),
+    SENSOR(28.510689), SENSOR(28.480855), SENSOR(28.451039), SENSOR(28.421240),
+    SENSOR(28.391459), SENSOR(28.361696), SENSOR(28.331950), SENSOR(28.302222),
+    SENSOR(28.272512), SENSOR(28.242819), SENSOR(28.213144), SENSOR(28.183486),
+    SENSOR(28.153846), SENSOR(28.124224), SENSOR(28.094619), SENSOR(28.065031),
+    SENSOR(28.035461), SENSOR(28.005908), SENSOR(27.976373), SENSOR(27.946856),
+    SENSOR(27.917355), SENSOR(27.887873), SENSOR(27.858407), SENSOR(27.828959),
+    SENSOR(27.799528), SENSOR(27.770115), SENSOR(27.740719), SENSOR(27.711340),
+    SENSOR(27.681979), SENSOR(27.652635), SENSOR(27.623308), SENSOR(27.593998),
+    SENSOR(27.564706), SENSOR(27.535431), SENSOR(27.506173), SENSOR(27.476932),
+    SENSOR(27.447709), SENSOR(27.418502), SENSOR(27.389313), SENSOR(27.360141),
+    SENSOR(27.330986), SENSOR(27.301848), SENSOR(27.272727), SENSOR(27.243624),
+    SENSOR(27.214537), SENSOR(27.185467), SENSOR(27.156415), SENSOR(27.127379),
+    SENSOR(27.098361), SENSOR(27.069359), SENSOR(27.040374), SENSOR(27.011407),
+    SENSOR(26.982456), SENSOR(26.953522), SENSOR(26.924605), SENSOR(26.895706),
+    SENSOR(26.866822), SENSOR(26.837956), SENSOR(26.809107), SENSOR(26.780274),
+    SENSOR(26.751459), SENSOR(26.722660), SENSOR(26.693878), SENSOR(26.665112),
+    SENSOR(26.636364), SENSOR(26.607632), SENSOR(26.578917), SENSOR(26.550218),
+    SENSOR(26.521537), SENSOR(26.492872), SENSOR(26.464223), SENSOR(26.435592),
+    SENSOR(26.406977), SENSOR(26.378378), SENSOR(26.349797), SENSOR(26.321231),
+    SENSOR(26.292683), SENSOR(26.264151), SENSOR(26.235636), SENSOR(26.207137),
+    SENSOR(26.178654), SENSOR(26.150188), SENSOR(26.121739), SENSOR(26.093306),
+    SENSOR(26.064890), SENSOR(26.036490), SENSOR(26.008107), SENSOR(25.979740),
+    SENSOR(25.951389), SENSOR(25.923055), SENSOR(25.894737), SENSOR(25.866435),
+    SENSOR(25.838150), SENSOR(25.809882), SENSOR(25.781629), SENSOR(25.753393),
+    SENSOR(25.725173), SENSOR(25.696970), SENSOR(25.668782), SENSOR(25.640611),
+    SENSOR(25.612457), SENSOR(25.584318), SENSOR(25.556196), SENSOR(25.528090),
+    SENSOR(25.500000), SENSOR(25.471926), SENSOR(25.443869), SENSOR(25.415827),
+    SENSOR(25.387802), SENSOR(25.359793), SENSOR(25.331800), SENSOR(25.303823),
+    SENSOR(25.275862), SENSOR(25.247917), SENSOR(25.219989), SENSOR(25.192076),
+    SENSOR(25.164179), SENSOR(25.136298), SENSOR(25.108434), SENSOR(25.080585),
+    SENSOR(25.052752), SENSOR(25.024936), SENSOR(24.997135), SENSOR(24.969350),
+    SENSOR(24.941581), SENSOR(24.913828), SENSOR(24.886090), SENSOR(24.858369),
+    SENSOR(24.830664), SENSOR(24.802974), SENSOR(24.775300), SENSOR(24.747642),
+    SENSOR(24.720000), SENSOR(24.692374), SENSOR(24.664763), SENSOR(24.637168),
+    SENSOR(24.609589), SENSOR(24.582026), SENSOR(24.554478), SENSOR(24.526946),
+    SENSOR(24.499430), SENSOR(24.471929), SENSOR(24.444444), SENSOR(24.416975),
+    SENSOR(24.389522), SENSOR(24.362084), SENSOR(24.334661), SENSOR(24.307255),
+    SENSOR(24.279863), SENSOR(24.252488), SENSOR(24.225128), SENSOR(24.197783),
+    SENSOR(24.170455), SENSOR(24.143141), SENSOR(24.115843), SENSOR(24.088561),
+    SENSOR(24.061294), SENSOR(24.034043), SENSOR(24.006807), SENSOR(23.979586),
+    SENSOR(23.952381), SENSOR(23.925191), SENSOR(23.898017), SENSOR(23.870858),
+    SENSOR(23.843715), SENSOR(23.816586), SENSOR(23.789474), SENSOR(23.762376),
+    SENSOR(23.735294), SENSOR(23.708227), SENSOR(23.681176), SENSOR(23.654140),
+    SENSOR(23.627119), SENSOR(23.600113), SENSOR(23.573123), SENSOR(23.546147),
+    SENSOR(23.519187), SENSOR(23.492243), SENSOR(23.465313), SENSOR(23.438399),
+    SENSOR(23.411499), SENSOR(23.384615), SENSOR(23.357746), SENSOR(23.330893),
+    SENSOR(23.304054), SENSOR(23.277231), SENSOR(23.250422), SENSOR(23.223629),
+    SENSOR(23.196850), SENSOR(23.170087), SENSOR(23.143339), SENSOR(23.116606),
+    SENSOR(23.089888), SENSOR(23.063184), SENSOR(23.036496), SENSOR(23.009823),
+    SENSOR(22.983165), SENSOR(22.956522), SENSOR(22.929893), SENSOR(22.903280),
+    SENSOR(22.876682), SENSOR(22.850098), SENSOR(22.823529), SENSOR(22.796976),
+    SENSOR(22.770437), SENSOR(22.743913), SENSOR(22.717403), SENSOR(22.690909),
+    SENSOR(22.664430), SENSOR(22.637965), SENSOR(22.611515), SENSOR(22.585080),
+    SENSOR(22.558659), SENSOR(22.532254), SENSOR(22.505863), SENSOR(22.479486),
+    SENSOR(22.453125), SENSOR(22.426778), SENSOR(22.400446), SENSOR(22.374129),
+    SENSOR(22.347826), SENSOR(22.321538), SENSOR(22.295265), SENSOR(22.269006),
+    SENSOR(22.242762), SENSOR(22.216532), SENSOR(22.190317), SENSOR(22.164117),
+    SENSOR(22.137931), SENSOR(22.111760), SENSOR(22.085603), SENSOR(22.059461),
+    SENSOR(22.033333), SENSOR(22.007220), SENSOR(21.981122), SENSOR(21.955037),
+    SENSOR(21.928968), SENSOR(21.902913), SENSOR(21.876872), SENSOR(21.850846),
+    SENSOR(21.824834), SENSOR(21.798836), SENSOR(21.772853), SENSOR(21.746885),
+    SENSOR(21.720930), SENSOR(21.694990), SENSOR(21.669065), SENSOR(21.643154),
+    SENSOR(21.617257), SENSOR(21.591374), SENSOR(21.565506), SENSOR(21.539652),
+    SENSOR(21.513812), SENSOR(21.487987), SENSOR(21.462176), SENSOR(21.436379),
+    SENSOR(21.410596), SENSOR(21.384828), SENSOR(21.359073), SENSOR(21.333333),
+    SENSOR(21.307607), SENSOR(21.281896), SENSOR(21.256198), SENSOR(21.230515),
+    SENSOR(21.204846), SENSOR(21.179191), SENSOR(21.153550), SENSOR(21.127923),
+    SENSOR(21.102310), SENSOR(21.076712), SENSOR(21.051127), SENSOR(21.025556),
+    SENSOR(21.000000), SENSOR(20.974458), SENSOR(20.948929), SENSOR(20.923415),
+    SENSOR(20.897914), SENSOR(20.872428), SENSOR(20.846956), SENSOR(20.821497),
+    SENSOR(20.796053), SENSOR(20.770622), SENSOR(20.745205), SENSOR(20.719803),
+    SENSOR(20.694414), SENSOR(20.669039), SENSOR(20.643678), SENSOR(20.618331),
+    SENSOR(20.592998), SENSOR(20.567678), SENSOR(20.542373), SENSOR(20.517081),
+    SENSOR(20.491803), SENSOR(20.466539), SENSOR(20.441289), SENSOR(20.416052),
+    SENSOR(20.390830), SENSOR(20.365621), SENSOR(20.340426), SENSOR(20.315244),
+    SENSOR(20.290076), SENSOR(20.264922), SENSOR(20.239782), SENSOR(20.214655),
+    SENSOR(20.189542), SENSOR(20.164443), SENSOR(20.139358), SENSOR(20.114286),
+    SENSOR(20.089227), SENSOR(20.064183), SENSOR(20.039152), SENSOR(20.014134),
+    SENSOR(19.989130), SENSOR(19.964140), SENSOR(19.939163), SENSOR(19.914200),
+    SENSOR(19.889251), SENSOR(19.864315), SENSOR(19.839392), SENSOR(19.814483),
+    SENSOR(19.789588), SENSOR(19.764706), SENSOR(19.739837), SENSOR(19.714982),
+    SENSOR(19.690141), SENSOR(19.665313), SENSOR(19.640498), SENSOR(19.615697),
+    SENSOR(19.590909), SENSOR(19.566135), SENSOR(19.541374), SENSOR(19.516626),
+    SENSOR(19.491892), SENSOR(19.467171), SENSOR(19.442464), SENSOR(19.417769),
+    SENSOR(19.393089), SENSOR(19.368421), SENSOR(19.343767), SENSOR(19.319126),
+    SENSOR(19.294498), SENSOR(19.269884), SENSOR(19.245283), SENSOR(19.220695),
+    SENSOR(19.196121), SENSOR(19.171559), SENSOR(19.147011), SENSOR(19.122476),
+    SENSOR(19.097955), SENSOR(19.073446), SENSOR(19.048951), SENSOR(19.024469),
+    SENSOR(19.000000), SENSOR(18.975544), SENSOR(18.951102), SENSOR(18.926672),
+    SENSOR(18.902256), SENSOR(18.877852), SENSOR(18.853462), SENSOR(18.829085),
+    SENSOR(18.804721), SENSOR(18.780370), SENSOR(18.756032), SENSOR(18.731707),
+    SENSOR(18.707395), SENSOR(18.683097), SENSOR(18.658811), SENSOR(18.634538),
+    SENSOR(18.610278), SENSOR(18.586032), SENSOR(18.561798), SENSOR(18.537577),
+    SENSOR(18.513369), SENSOR(18.489174), SENSOR(18.464992), SENSOR(18.440823),
+    SENSOR(18.416667), SENSOR(18.392523), SENSOR(18.368393), SENSOR(18.344275),
+    SENSOR(18.320171), SENSOR(18.296079), SENSOR(18.272000), SENSOR(18.247934),
+    SENSOR(18.223881), SENSOR(18.199840), SENSOR(18.175812), SENSOR(18.151798),
+    SENSOR(18.127796), SENSOR(18.103806), SENSOR(18.079830), SENSOR(18.055866),
+    SENSOR(18.031915), SENSOR(18.007977), SENSOR(17.984051), SENSOR(17.960138),
+    SENSOR(17.936238), SENSOR(17.912351), SENSOR(17.888476), SENSOR(17.864614),
+    SENSOR(17.840764), SENSOR(17.816928), SENSOR(17.793103), SENSOR(17.769292),
+    SENSOR(17.745493), SENSOR(17.721707), SENSOR(17.697933), SENSOR(17.674172),
+    SENSOR(17.650424), SENSOR(17.626688), SENSOR(17.602965), SENSOR(17.579254),
+    SENSOR(17.555556), SENSOR(17.531870), SENSOR(17.508197), SENSOR(17.484536),
+    SENSOR(17.460888), SENSOR(17.437252), SENSOR(17.413629), SENSOR(17.390018),
+    SENSOR(17.366420), SENSOR(17.342835), SENSOR(17.319261), SENSOR(17.295700),
+    SENSOR(17.272152), SENSOR(17.248616), SENSOR(17.225092), SENSOR(17.201581),
+    SENSOR(17.178082), SENSOR(17.154596), SENSOR(17.131122), SENSOR(17.107660),
+    SENSOR(17.084211), SENSOR(17.060773), SENSOR(17.037349), SENSOR(17.013936),
+    SENSOR(16.990536), SENSOR(16.967148), SENSOR(16.943773), SENSOR(16.920410),
+    SENSOR(16.897059), SENSOR(16.873720), SENSOR(16.850394), SENSOR(16.827080),
+    SENSOR(16.803778), SENSOR(16.780488), SENSOR(16.757210), SENSOR(16.733945),
+    SENSOR(16.710692), SENSOR(16.687451), SENSOR(16.664222), SENSOR(16.641005),
+    SENSOR(16.617801), SENSOR(16.594609), SENSOR(16.571429), SENSOR(16.548261),
+    SENSOR(16.525105), SENSOR(16.501961), SENSOR(16.478829), SENSOR(16.455709),
+    SENSOR(16.432602), SENSOR(16.409506), SENSOR(16.386423), SENSOR(16.363352),
+    SENSOR(16.340292), SENSOR(16.317245), SENSOR(16.294210), SENSOR(16.271186),
+    SENSOR(16.248175), SENSOR(16.225176), SENSOR(16.202189), SENSOR(16.179213),
+    SENSOR(16.156250), SENSOR(16.133299), SENSOR(16.110359), SENSOR(16.087432),
+    SENSOR(16.064516), SENSOR(16.041612), SENSOR(16.018721), SENSOR(15.995841),
+    SENSOR(15.972973), SENSOR(15.950117), SENSOR(15.927273), SENSOR(15.904440),
+    SENSOR(15.881620), SENSOR(15.858811), SENSOR(15.836015), SENSOR(15.813230),
+    SENSOR(15.790456), SENSOR(15.767695), SENSOR(15.744946), SENSOR(15.722208),
+    SENSOR(15.699482), SENSOR(15.676768), SENSOR(15.654065), SENSOR(15.631375),
+    SENSOR(15.608696), SENSOR(15.586028), SENSOR(15.563373), SENSOR(15.540729),
+    SENSOR(15.518097), SENSOR(15.495477), SENSOR(15.472868), SENSOR(15.450271),
+    SENSOR(15.427686), SENSOR(15.405112), SENSOR(15.382550), SENSOR(15.360000),
+    SENSOR(15.337461), SENSOR(15.314934), SENSOR(15.292419), SENSOR(15.269915),
+    SENSOR(15.247423), SENSOR(15.224942), SENSOR(15.202473), SENSOR(15.180015),
+    SENSOR(15.157570), SENSOR(15.135135), SENSOR(15.112712), SENSOR(15.090301),
+    SENSOR(15.067901), SENSOR(15.045513), SENSOR(15.023136), SENSOR(15.000771),
+    SENSOR(14.978417), SENSOR(14.956075), SENSOR(14.933744), SENSOR(14.911425),
+    SENSOR(14.889117), SENSOR(14.866821), SENSOR(14.844536), SENSOR(14.822262),
+    SENSOR(14.800000), SENSOR(14.777749), SENSOR(14.755510), SENSOR(14.733282),
+    SENSOR(14.711066), SENSOR(14.688860), SENSOR(14.666667), SENSOR(14.644484),
+    SENSOR(14.622313), SENSOR(14.600153), SENSOR(14.578005), SENSOR(14.555868),
+    SENSOR(14.533742), SENSOR(14.511628), SENSOR(14.489525), SENSOR(14.467433),
+    SENSOR(14.445352), SENSOR(14.423283), SENSOR(14.401225), SENSOR(14.379178),
+    SENSOR(14.357143), SENSOR(14.335119), SENSOR(14.313106), SENSOR(14.291104),
+    SENSOR(14.269113), SENSOR(14.247134), SENSOR(14.225166), SENSOR(14.203209),
+    SENSOR(14.181263), SENSOR(14.159328), SENSOR(14.137405), SENSOR(14.115492),
+    SENSOR(14.093591), SENSOR(14.071701), SENSOR(14.049822), SENSOR(14.027954),
+    SENSOR(14.006098), SENSOR(13.984252), SENSOR(13.962417), SENSOR(13.940594),
+    SENSOR(13.918782), SENSOR(13.896980), SENSOR(13.875190), SENSOR(13.853411),
+    SENSOR(13.831643), SENSOR(13.809886), SENSOR(13.788140), SENSOR(13.766405),
+    SENSOR(13.744681), SENSOR(13.722968), SENSOR(13.701266), SENSOR(13.679575),
+    SENSOR(13.657895), SENSOR(13.636226), SENSOR(13.614568), SENSOR(13.592920),
+    SENSOR(13.571284), SENSOR(13.549659), SENSOR(13.528044), SENSOR(13.506441),
+    SENSOR(13.484848), SENSOR(13.463267), SENSOR(13.441696), SENSOR(13.420136),
+    SENSOR(13.398587), SENSOR(13.377049), SENSOR(13.355522), SENSOR(13.334006),
+    SENSOR(13.312500), SENSOR(13.291005), SENSOR(13.269521), SENSOR(13.248048),
+    SENSOR(13.226586), SENSOR(13.205135), SENSOR(13.183694), SENSOR(13.162264),
+    SENSOR(13.140845), SENSOR(13.119437), SENSOR(13.098039), SENSOR(13.076652),
+    SENSOR(13.055276), SENSOR(13.033911), SENSOR(13.012557), SENSOR(12.991213),
+    SENSOR(12.969880), SENSOR(12.948557), SENSOR(12.927245), SENSOR(12.905944),
+    SENSOR(12.884654), SENSOR(12.863374), SENSOR(12.842105), SENSOR(12.820847),
+    SENSOR(12.799599), SENSOR(12.778362), SENSOR(12.757136), SENSOR(12.735920),
+    SENSOR(12.714715), SENSOR(12.693520), SENSOR(12.672336), SENSOR(12.651163),
+    SENSOR(12.630000), SENSOR(12.608848), SENSOR(12.587706), SENSOR(12.566575),
+    SENSOR(12.545455), SENSOR(12.524345), SENSOR(12.503245), SENSOR(12.482156),
+    SENSOR(12.461078), SENSOR(12.440010), SENSOR(12.418953), SENSOR(12.397906),
+    SENSOR(12.376869), SENSOR(12.355844), SENSOR(12.334828), SENSOR(12.313823),
+    SENSOR(12.292829), SENSOR(12.271845), SENSOR(12.250871), SENSOR(12.229908),
+    SENSOR(12.208955), SENSOR(12.188013), SENSOR(12.167081), SENSOR(12.146160),
+    SENSOR(12.125249), SENSOR(12.104348), SENSOR(12.083458), SENSOR(12.062578),
+    SENSOR(12.041708), SENSOR(12.020849), SENSOR(12.000000), SENSOR(11.979161),
+    SENSOR(11.958333), SENSOR(11.937515), SENSOR(11.916708), SENSOR(11.895911),
+    SENSOR(11.875124), SENSOR(11.854347), SENSOR(11.833581), SENSOR(11.812825),
+    SENSOR(11.792079), SENSOR(11.771344), SENSOR(11.750619), SENSOR(11.729904),
+    SENSOR(11.709199), SENSOR(11.688504), SENSOR(11.667820), SENSOR(11.647146),
+    SENSOR(11.626482), SENSOR(11.605829), SENSOR(11.585185), SENSOR(11.564552),
+    SENSOR(11.543929), SENSOR(11.523316), SENSOR(11.502713), SENSOR(11.482121),
+    SENSOR(11.461538), SENSOR(11.440966), SENSOR(11.420404), SENSOR(11.399852),
+    SENSOR(11.379310), SENSOR(11.358779), SENSOR(11.338257), SENSOR(11.317746),
+    SENSOR(11.297244), SENSOR(11.276753), SENSOR(11.256272), SENSOR(11.235800),
+    SENSOR(11.215339), SENSOR(11.194888), SENSOR(11.174447), SENSOR(11.154016),
+    SENSOR(11.133595), SENSOR(11.113184), SENSOR(11.092784), SENSOR(11.072393),
+    SENSOR(11.052012), SENSOR(11.031641), SENSOR(11.011280), SENSOR(10.990929),
+    SENSOR(10.970588), SENSOR(10.950257), SENSOR(10.929936), SENSOR(10.909625),
+    SENSOR(10.889324), SENSOR(10.869033), SENSOR(10.848752), SENSOR(10.828481),
+    SENSOR(10.808219), SENSOR(10.787968), SENSOR(10.767726), SENSOR(10.747495),
+    SENSOR(10.727273), SENSOR(10.707061), SENSOR(10.686859), SENSOR(10.666667)
+};
+
+#endif
@@ -0,0 +1,110 @@
+// Thie file contains the execution-time probes and the encoder for their UART dump frames (profile.h)
+// The frame CRC is the telemetry one, so the ESP32 and the host tools check both frame types the same way.
+
+#include "profile.h"
+#include "telemetry.h"
+
+profile_probe_t profile_probes[PROFILE_PROBES];
+const char *const profile_probe_names[PROFILE_PROBES] = { "idle", "hwi", "swi", "tsk0", "tsk1", "tsk2", "ecap" };
+
+void profile_probe_init(profile_probe_t *p)
+{
+    uint16_t b;
+
+    p->count = 0;
+    p->min = 0xFFFFFFFFUL;
+    p->max = 0;
+    p->sum = 0;
+    for (b = 0; b < PROFILE_BUCKETS; b++)
+    {
+        p->hist[b] = 0;
+    }
+}
+
+void profile_init(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < PROFILE_PROBES; i++)
+    {
+        profile_probe_init(&profile_probes[i]);
+    }
+}
+
+//non-empty bucket range, first > last when the probe is empty
+static void profile_range(const profile_probe_t *p, uint16_t *first, uint16_t *last)
+{
+    uint16_t lo = 0;
+    uint16_t hi = PROFILE_BUCKETS - 1;
+
+    while ((lo < PROFILE_BUCKETS) && (p->hist[lo] == 0))
+    {
+        lo++;
+    }
+    while ((hi > lo) && (p->hist[hi] == 0))
+    {
+        hi--;
+    }
+    *first = lo;
+    *last = hi;
+}
+
+uint16_t profile_frames(const profile_probe_t *p)
+{
+    uint16_t first;
+    uint16_t last;
+    uint16_t chunks = 0;
+
+    profile_range(p, &first, &last);
+    if (first < PROFILE_BUCKETS)
+    {
+        uint16_t n = last - first + 1;
+        while (n > 0)
+        {
+            chunks++;
+            n = (n > PROFILE_HIST_CHUNK) ? (n - PROFILE_HIST_CHUNK) : 0;
+        }
+    }
+    return 1 + chunks;
+}
+
+uint16_t profile_encode(unsigned char *frame, uint16_t probe, const profile_probe_t *p, uint16_t part)
+{
+    unsigned char *q = frame + PROFILE_HEADER_SIZE;
+    uint16_t payload;
+
+    *q++ = probe & 0xFF;
+    if (part == 0)
+    {
+        *q++ = PROFILE_KIND_STATS;
+        q = telemetry_put_u32(q, p->count);
+        q = telemetry_put_u32(q, p->min);
+        q = telemetry_put_u32(q, p->max);
+        q = telemetry_put_u32(q, (uint32_t)p->sum);
+        q = telemetry_put_u32(q, (uint32_t)(p->sum >> 32));
+    }
+    else
+    {
+        uint16_t first;
+        uint16_t last;
+        uint16_t n;
+        uint16_t b;
+
+        profile_range(p, &first, &last);
+        first += (part - 1) * PROFILE_HIST_CHUNK;
+        n = (last >= first) ? (last - first + 1) : 0;
+        if (n > PROFILE_HIST_CHUNK)
+        {
+            n = PROFILE_HIST_CHUNK;
+        }
+        *q++ = PROFILE_KIND_HIST;
+        *q++ = first & 0xFF;
+        *q++ = n & 0xFF;
+        for (b = 0; b < n; b++)
+        {
+            q = telemetry_put_u32(q, p->hist[first + b]);
+        }
+    }
+    payload = (uint16_t)(q - frame) - PROFILE_HEADER_SIZE;
+    return telemetry_frame_finish(frame, PROFILE_SYNC0, PROFILE_SYNC1, PROFILE_VERSION, payload);
+}
@@ -0,0 +1,114 @@
+/*
+ * profile.h
+ *
+ * Execution-time profiler. Each probe keeps count, min, max, sum and a log2 histogram of
+ * the CPU timestamp counts between a start and a stop point. A probe measures wall time, so
+ * preemption by higher priority threads shows up as the long tail of its histogram.
+ * profile_record() is a handful of adds and compares; each probe must be recorded from one
+ * context only, and readers in other contexts copy it with Hwi disabled.
+ *
+ * Frames for the UART dump (little endian, one octet per char on the C28x), both fit in
+ * UART_FRAME_SIZE:
+ *   [0..1]  sync 0xA5 0xC3
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload, starting with probe u8 and kind u8
+ *           PROFILE_KIND_STATS: count u32, min u32, max u32, sum u64
+ *           PROFILE_KIND_HIST:  first bucket u8, buckets n u8, n x u32 (n <= PROFILE_HIST_CHUNK)
+ *   [last2] CRC-16/CCITT-FALSE over version..payload (telemetry_crc16)
+ * Plain C so the host tools build it as well.
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+
+//probes, one per thread
+#define PROFILE_IDLE 0
+#define PROFILE_HWI 1   //myHwi, ADC_DMA_ISR or MOISTURE_CLA_ISR, whichever the build uses
+#define PROFILE_SWI 2
+#define PROFILE_TSK0 3  //DHT20
+#define PROFILE_TSK1 4  //ultrasonic
+#define PROFILE_TSK2 5  //telemetry
+#define PROFILE_ECAP 6  //ECAP_ISR
+#define PROFILE_PROBES 7
+
+//bucket b counts durations of 2^b to 2^(b+1) - 1 counts, bucket 0 also counts 0
+#define PROFILE_BUCKETS 32
+
+#define PROFILE_DUMP_COMMAND 0x50 //'P' received on SCIB asks for a dump
+#define PROFILE_SYNC0 0xA5
+#define PROFILE_SYNC1 0xC3
+#define PROFILE_VERSION 1
+#define PROFILE_HEADER_SIZE 4
+#define PROFILE_CRC_SIZE 2
+#define PROFILE_KIND_STATS 0
+#define PROFILE_KIND_HIST 1
+#define PROFILE_STATS_PAYLOAD 22
+#define PROFILE_HIST_CHUNK 12 //buckets per histogram frame
+#define PROFILE_FRAME_MAX (PROFILE_HEADER_SIZE + 4 + 4 * PROFILE_HIST_CHUNK + PROFILE_CRC_SIZE)
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[PROFILE_BUCKETS];
+} profile_probe_t;
+
+extern profile_probe_t profile_probes[PROFILE_PROBES];
+extern const char *const profile_probe_names[PROFILE_PROBES];
+
+void profile_init(void);
+//Empties one probe, for probes outside profile_probes (bench.h)
+void profile_probe_init(profile_probe_t *p);
+
+static inline uint16_t profile_bucket(uint32_t counts)
+{
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__) && !defined(PROFILE_NO_CLZ)
+    return (counts > 1U) ? (uint16_t)(31 - __builtin_clz(counts)) : 0;
+#else
+    uint16_t b = 0;
+    uint16_t shift;
+    for (shift = 16; shift != 0; shift >>= 1) //five compares, no divide
+    {
+        if (counts >= (1UL << shift))
+        {
+            counts >>= shift;
+            b += shift;
+        }
+    }
+    return b;
+#endif
+}
+
+static inline void profile_record_probe(profile_probe_t *p, uint32_t counts)
+{
+    p->count++;
+    p->sum += counts;
+    if (counts < p->min)
+    {
+        p->min = counts;
+    }
+    if (counts > p->max)
+    {
+        p->max = counts;
+    }
+    p->hist[profile_bucket(counts)]++;
+}
+
+static inline void profile_record(uint16_t probe, uint32_t counts)
+{
+    profile_record_probe(&profile_probes[probe], counts);
+}
+
+//Number of frames profile_encode() produces for a probe: the stats frame and the histogram
+//chunks from the lowest to the highest non-empty bucket
+uint16_t profile_frames(const profile_probe_t *p);
+//Writes frame number part (0 = stats) of a probe into frame (at least PROFILE_FRAME_MAX
+//elements), returns its length
+uint16_t profile_encode(unsigned char *frame, uint16_t probe, const profile_probe_t *p, uint16_t part);
+
+#endif /* PROFILE_H_ */
@@ -0,0 +1,83 @@
+// Thie file contains the timestamped sample ring (sample_ring.h)
+// Sequence numbers are 32-bit and compared by difference, so they may wrap.
+
+#include "sample_ring.h"
+
+void sample_ring_init(sample_ring_t *ring)
+{
+    uint16_t i;
+
+    for (i = 0; i < SAMPLE_RING_DEPTH; i++)
+    {
+        ring->slot[i].seq = i + 1U; //not a sequence number of this slot, so empty
+    }
+    ring->write_count = 0;
+}
+
+void sample_ring_append(sample_ring_t *ring, const sample_record_t *record)
+{
+    uint32_t seq = ring->write_count;
+    sample_slot_t *slot = &ring->slot[seq & SAMPLE_RING_MASK];
+
+    slot->seq = seq + 1U; //maps to the next slot, no reader of this one matches it while it is written
+    SAMPLE_RING_BARRIER();
+    slot->time = record->time;
+    slot->value = record->value;
+    slot->channel = record->channel;
+    slot->quality = record->quality;
+    SAMPLE_RING_BARRIER();
+    slot->seq = seq;
+    SAMPLE_RING_BARRIER();
+    ring->write_count = seq + 1;
+}
+
+void sample_cursor_init(const sample_ring_t *ring, sample_cursor_t *cursor, int from_oldest)
+{
+    uint32_t written = ring->write_count;
+
+    cursor->next = written;
+    if (from_oldest)
+    {
+        cursor->next = (written > SAMPLE_RING_DEPTH) ? (written - SAMPLE_RING_DEPTH) : 0;
+    }
+    cursor->lost = 0;
+}
+
+int sample_ring_read(const sample_ring_t *ring, sample_cursor_t *cursor, sample_record_t *record)
+{
+    while (1)
+    {
+        uint32_t written = ring->write_count;
+        const sample_slot_t *slot;
+
+        SAMPLE_RING_BARRIER();
+        if (written == cursor->next)
+        {
+            return 0;
+        }
+        if ((uint32_t)(written - cursor->next) > SAMPLE_RING_DEPTH)
+        {
+            //fell behind, the oldest slots are already reused
+            cursor->lost += (written - cursor->next) - SAMPLE_RING_DEPTH;
+            cursor->next = written - SAMPLE_RING_DEPTH;
+        }
+        slot = &ring->slot[cursor->next & SAMPLE_RING_MASK];
+        if (slot->seq == cursor->next)
+        {
+            SAMPLE_RING_BARRIER();
+            record->time = slot->time;
+            record->value = slot->value;
+            record->channel = slot->channel;
+            record->quality = slot->quality;
+            SAMPLE_RING_BARRIER();
+            if (slot->seq == cursor->next) //still the same record after the copy
+            {
+                cursor->next++;
+                return 1;
+            }
+        }
+        //overwritten under us: count it and try the next one
+        cursor->lost++;
+        cursor->next++;
+    }
+}
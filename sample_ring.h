@@ -0,0 +1,88 @@
+/*
+ * sample_ring.h
+ *
+ * Fixed-capacity ring of timestamped sample records. Every producer appends records
+ * (capture time, channel, value, quality) and every consumer keeps its own cursor, so
+ * consumers read at their own pace without taking records from each other. When a
+ * consumer falls more than SAMPLE_RING_DEPTH records behind, the oldest records are
+ * overwritten and the cursor skips ahead, counting what it lost.
+ *
+ * Producers must be serialised by the caller (the firmware appends with Hwi disabled).
+ * Readers need no lock: each slot carries the sequence number of its record and a read
+ * that raced with an overwrite is detected and counted as lost.
+ * Plain C so the host tools build it as well.
+ */
+
+#ifndef SAMPLE_RING_H_
+#define SAMPLE_RING_H_
+
+#include <stdint.h>
+
+#ifndef SAMPLE_RING_DEPTH
+#define SAMPLE_RING_DEPTH 64 //records, power of two
+#endif
+#if (SAMPLE_RING_DEPTH < 2) || (SAMPLE_RING_DEPTH & (SAMPLE_RING_DEPTH - 1))
+#error "SAMPLE_RING_DEPTH must be a power of two"
+#endif
+#define SAMPLE_RING_MASK ((uint32_t)SAMPLE_RING_DEPTH - 1U)
+
+//The C28x completes stores in order, volatile is enough there. Weakly ordered hosts need a fence.
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+#define SAMPLE_RING_BARRIER() __sync_synchronize()
+#else
+#define SAMPLE_RING_BARRIER()
+#endif
+
+//channels, values are integers in the units given
+#define SAMPLE_CH_TEMPERATURE 0 //0.01 C
+#define SAMPLE_CH_HUMIDITY 1    //0.01 %RH
+#define SAMPLE_CH_MOISTURE 2    //0.01 % water content
+#define SAMPLE_CH_DISTANCE 3    //mm from the ultrasonic sensor to the water
+#define SAMPLE_CH_TANK 4        //mL left in the tank
+#define SAMPLE_CHANNELS 5
+
+//quality flags
+#define SAMPLE_Q_OK 0x00
+#define SAMPLE_Q_SENSOR_FAULT 0x01 //sensor reported an error or did not answer in time
+#define SAMPLE_Q_FILTERED 0x02     //value comes out of a filter, not a single reading
+#define SAMPLE_Q_REJECTED 0x04     //newest raw reading was rejected, value is the previous estimate
+#define SAMPLE_Q_CLAMPED 0x08      //value saturated to the range of its units
+
+typedef struct
+{
+    uint64_t time;      //capture time in timestamp counts
+    int32_t value;
+    uint16_t channel;
+    uint16_t quality;
+} sample_record_t;
+
+typedef struct
+{
+    volatile uint32_t seq;    //sequence number of the record in the slot, one that never maps here while written
+    volatile uint64_t time;
+    volatile int32_t value;
+    volatile uint16_t channel;
+    volatile uint16_t quality;
+} sample_slot_t;
+
+typedef struct
+{
+    sample_slot_t slot[SAMPLE_RING_DEPTH];
+    volatile uint32_t write_count; //records appended, the next one gets this sequence number
+} sample_ring_t;
+
+typedef struct
+{
+    uint32_t next;  //sequence number of the next record to read
+    uint32_t lost;  //records overwritten before this consumer got to them
+} sample_cursor_t;
+
+void sample_ring_init(sample_ring_t *ring);
+void sample_ring_append(sample_ring_t *ring, const sample_record_t *record);
+
+//A new cursor starts at the oldest record still held (or at the next one to be written)
+void sample_cursor_init(const sample_ring_t *ring, sample_cursor_t *cursor, int from_oldest);
+//Copies the next record into record and returns 1, or returns 0 when the cursor is up to date
+int sample_ring_read(const sample_ring_t *ring, sample_cursor_t *cursor, sample_record_t *record);
+
+#endif /* SAMPLE_RING_H_ */
@@ -0,0 +1,148 @@
+// Thie file contains the conversions from raw sensor readings to engineering units
+// Each conversion has a float path and a Q16.16 path selected by SENSOR_MATH_FIXED.
+
+#include "sensor_math.h"
+
+#if MOISTURE_LUT
+extern const sensor_t moisture_lut[MOISTURE_LUT_SIZE]; //moisture_lut.c, generated by host/gen_moisture_lut
+
+sensor_t sensor_water_content(uint16_t code)
+{
+    return moisture_lut[code & (MOISTURE_LUT_SIZE - 1)]; //12-bit code indexes the table directly
+}
+#endif
+
+#if SENSOR_MATH_FIXED
+
+//volts per ADC code in Q28, code * K fits in 32 bits for a 12-bit code
+#define VOLTS_PER_CODE_Q28 ((uint32_t)(VREFHI / ADC_FULL_SCALE * 268435456.0 + 0.5))
+//water content = MOISTURE_NUM / code - 72, MOISTURE_NUM = 2.48 * 100 * 4095 / 3.0
+#define MOISTURE_NUM ((uint32_t)(MOISTURE_SLOPE * 100.0 * ADC_FULL_SCALE / VREFHI + 0.5))
+#define MOISTURE_OFFSET_Q16 Q16(MOISTURE_OFFSET * 100.0)
+//codes below this would overflow Q16.16, the result saturates instead
+#define MOISTURE_MIN_CODE (MOISTURE_NUM / 32767U + 1U)
+//cm per eCAP count in Q32
+#define CM_PER_COUNT_Q32 ((uint32_t)(4294967296.0 / ECHO_COUNTS_PER_CM + 0.5))
+
+sensor_t sensor_adc_to_volts(uint16_t code)
+{
+    return (q16_t)(((uint32_t)code * VOLTS_PER_CODE_Q28) >> 12);
+}
+
+#if !MOISTURE_LUT
+sensor_t sensor_water_content(uint16_t code)
+{
+    uint32_t whole;
+    uint32_t frac;
+
+    if (code < MOISTURE_MIN_CODE)
+    {
+        return Q16_MAX;
+    }
+    //one 32/16 divide for the integer part and one for the fraction, no reciprocal of a float
+    whole = MOISTURE_NUM / code;
+    frac = ((MOISTURE_NUM % code) << Q16_SHIFT) / code;
+    return (q16_t)((whole << Q16_SHIFT) + frac) - MOISTURE_OFFSET_Q16;
+}
+#endif
+
+sensor_t sensor_echo_to_cm(uint32_t counts)
+{
+    return (q16_t)(((uint64_t)counts * CM_PER_COUNT_Q32) >> 16);
+}
+
+sensor_t sensor_dht20_humidity(const unsigned char *data)
+{
+    uint32_t srh = ((uint32_t)(data[1] & 0xFF) << 12) | ((uint32_t)(data[2] & 0xFF) << 4) | ((data[3] & 0xFF) >> 4);
+    return (q16_t)((srh * 100U) >> 4); //srh / 2^20 * 100 in Q16
+}
+
+sensor_t sensor_dht20_temperature(const unsigned char *data)
+{
+    uint32_t st = ((uint32_t)(data[3] & 0x0F) << 16) | ((uint32_t)(data[4] & 0xFF) << 8) | (data[5] & 0xFF);
+    return (q16_t)((st * 200U) >> 4) - Q16(50.0); //st / 2^20 * 200 - 50 in Q16
+}
+
+int32_t sensor_to_units(sensor_t value, int32_t scale, int32_t min, int32_t max)
+{
+    int64_t scaled = ((int64_t)value * scale) / Q16_ONE;
+
+    if (scaled < min)
+    {
+        return min;
+    }
+    if (scaled > max)
+    {
+        return max;
+    }
+    return (int32_t)scaled;
+}
+
+sensor_t sensor_from_units(int32_t value, int32_t scale)
+{
+    int64_t q = ((int64_t)value * Q16_ONE) / scale;
+
+    if (q > Q16_MAX)
+    {
+        return Q16_MAX;
+    }
+    if (q < -Q16_MAX)
+    {
+        return -Q16_MAX;
+    }
+    return (q16_t)q;
+}
+
+#else
+
+sensor_t sensor_adc_to_volts(uint16_t code)
+{
+    return (float)((VREFHI / ADC_FULL_SCALE) * code); //get reading and scale reference voltage
+}
+
+#if !MOISTURE_LUT
+sensor_t sensor_water_content(uint16_t code)
+{
+    float volts = sensor_adc_to_volts(code);
+    return (float)((((1 / volts) * MOISTURE_SLOPE) - MOISTURE_OFFSET) * 100); //converting voltage reading of adc to water content in soil
+}
+#endif
+
+sensor_t sensor_echo_to_cm(uint32_t counts)
+{
+    return (float)((((float)counts) / (ECHO_COUNTS_PER_CM / 2)) / 2); // formula for converting time to cm as per datasheet
+}
+
+sensor_t sensor_dht20_humidity(const unsigned char *data)
+{
+    uint32_t srh = ((uint32_t)(data[1] & 0xFF) << 12) | ((uint32_t)(data[2] & 0xFF) << 4) | ((data[3] & 0xFF) >> 4);
+    return ((float)srh / DHT20_FULL_SCALE) * 100.0;
+}
+
+sensor_t sensor_dht20_temperature(const unsigned char *data)
+{
+    uint32_t st = ((uint32_t)(data[3] & 0x0F) << 16) | ((uint32_t)(data[4] & 0xFF) << 8) | (data[5] & 0xFF);
+    return ((float)st / DHT20_FULL_SCALE) * 200.0 - 50.0;
+}
+
+int32_t sensor_to_units(sensor_t value, int32_t scale, int32_t min, int32_t max)
+{
+    float scaled = value * (float)scale;
+
+    if (!(scaled >= (float)min)) //also catches NaN
+    {
+        return min;
+    }
+    if (scaled > (float)max)
+    {
+        return max;
+    }
+    return (int32_t)scaled;
+}
+
+sensor_t sensor_from_units(int32_t value, int32_t scale)
+{
+    return (float)value / (float)scale;
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * sensor_math.h
+ *
+ * Conversions from raw sensor readings (ADC code, eCAP counts, DHT20 bytes) to
+ * engineering units. Build with SENSOR_MATH_FIXED=1 to use the Q16.16 integer path
+ * (multiply-by-reciprocal, no float division); the default is the original float path.
+ * Plain C so the same code runs on the host.
+ */
+
+#ifndef SENSOR_MATH_H_
+#define SENSOR_MATH_H_
+
+#include <stdint.h>
+
+#ifndef SENSOR_MATH_FIXED
+#define SENSOR_MATH_FIXED 0
+#endif
+//1 = water content comes from the generated moisture_lut.c table indexed by the ADC code
+#ifndef MOISTURE_LUT
+#define MOISTURE_LUT 1
+#endif
+#define MOISTURE_LUT_SIZE 4096
+
+#define VREFHI 3.0 //reference voltage for capacitive soil moisture sensor
+#define ADC_FULL_SCALE 4095.0 //12-bit ADC
+#define MOISTURE_SLOPE 2.48 //water content = (MOISTURE_SLOPE / volts - MOISTURE_OFFSET) * 100
+#define MOISTURE_OFFSET 0.72
+#define ECHO_COUNTS_PER_CM 11600.0 //eCAP counts per cm of distance (5800 per cm, halved for the round trip)
+#define DHT20_FULL_SCALE 1048576.0 //2^20
+
+//Q16.16 and Q15 helpers
+typedef int32_t q16_t;
+typedef int16_t q15_t;
+#define Q16_SHIFT 16
+#define Q16_ONE ((q16_t)1 << Q16_SHIFT)
+#define Q16_MAX ((q16_t)0x7FFFFFFF)
+#define Q16(x) ((q16_t)((x) * 65536.0 + (((x) >= 0) ? 0.5 : -0.5)))
+#define Q16_TO_FLOAT(x) ((float)(x) * (1.0f / 65536.0f))
+#define Q15(x) ((q15_t)((x) * 32768.0 + (((x) >= 0) ? 0.5 : -0.5)))
+
+static inline q16_t q16_mul(q16_t a, q16_t b)
+{
+    return (q16_t)(((int64_t)a * b) >> Q16_SHIFT);
+}
+
+//sensor_t is the type of every converted reading, SENSOR(x) a constant in that type
+#if SENSOR_MATH_FIXED
+typedef q16_t sensor_t;
+#define SENSOR(x) Q16(x)
+#define SENSOR_TO_FLOAT(x) Q16_TO_FLOAT(x)
+#else
+typedef float sensor_t;
+#define SENSOR(x) ((float)(x))
+#define SENSOR_TO_FLOAT(x) ((float)(x))
+#endif
+
+//ADC-A result code -> volts at the moisture probe
+sensor_t sensor_adc_to_volts(uint16_t code);
+//ADC-A result code -> soil water content in %. Codes too small for Q16.16 saturate (fixed, and
+//always with MOISTURE_LUT), a zero code gives inf on the float path.
+sensor_t sensor_water_content(uint16_t code);
+//eCAP pulse width in counts -> distance in cm
+sensor_t sensor_echo_to_cm(uint32_t counts);
+//DHT20 measurement bytes (data[1..5] of the 6-byte read) -> %RH and degrees C
+sensor_t sensor_dht20_humidity(const unsigned char *data);
+sensor_t sensor_dht20_temperature(const unsigned char *data);
+//value * scale rounded toward zero and clamped to [min, max], e.g. scale 100 for centi-units
+int32_t sensor_to_units(sensor_t value, int32_t scale, int32_t min, int32_t max);
+//value / scale, the inverse of sensor_to_units (saturates on the fixed path)
+sensor_t sensor_from_units(int32_t value, int32_t scale);
+
+#endif /* SENSOR_MATH_H_ */
@@ -0,0 +1,49 @@
+// Thie file contains the two-copy snapshot publication (snapshot.h)
+// The record is moved through volatile pointers so the compiler keeps it between the count accesses.
+
+#include "snapshot.h"
+
+static void snapshot_copy(volatile unsigned char *dst, const volatile unsigned char *src, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+void snapshot_init(snapshot_t *snap, void *copy0, void *copy1, size_t size, const void *initial)
+{
+    snap->copy[0] = copy0;
+    snap->copy[1] = copy1;
+    snap->size = size;
+    snapshot_copy((volatile unsigned char *)copy0, (const volatile unsigned char *)initial, size);
+    snapshot_copy((volatile unsigned char *)copy1, (const volatile unsigned char *)initial, size);
+    snap->seq = 0;
+}
+
+void snapshot_publish(snapshot_t *snap, const void *record)
+{
+    snap->seq++; //odd: readers use copy 1
+    SNAPSHOT_BARRIER();
+    snapshot_copy((volatile unsigned char *)snap->copy[0], (const volatile unsigned char *)record, snap->size);
+    SNAPSHOT_BARRIER();
+    snap->seq++; //even: readers use copy 0
+    SNAPSHOT_BARRIER();
+    snapshot_copy((volatile unsigned char *)snap->copy[1], (const volatile unsigned char *)record, snap->size);
+}
+
+uint32_t snapshot_read(const snapshot_t *snap, void *record)
+{
+    uint32_t seq;
+
+    do
+    {
+        seq = snap->seq;
+        SNAPSHOT_BARRIER();
+        snapshot_copy((volatile unsigned char *)record, (const volatile unsigned char *)snap->copy[seq & 1], snap->size);
+        SNAPSHOT_BARRIER();
+    } while (snap->seq != seq); //a publish started meanwhile, the copy may be torn
+    return seq >> 1; //an odd count means copy 1, which still holds the previous publish
+}
@@ -0,0 +1,41 @@
+/*
+ * snapshot.h
+ *
+ * Publishes one record from a single writer (task, SWI or Hwi) to any number of readers
+ * without locks and without disabling interrupts. Two copies and a sequence count:
+ * the writer bumps the count (readers move to copy 1), fills copy 0, bumps it again
+ * (readers move back to copy 0) and fills copy 1. A reader copies the record the count
+ * points at and retries if the count moved meanwhile, so it never waits for a writer it
+ * has preempted and never returns a half-written record.
+ * Each record needs its own writer; values written from different threads go in
+ * different snapshots. Plain C so the host stress test builds it as well.
+ */
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//The C28x completes stores in order and the copies are volatile, nothing more is needed there.
+//Weakly ordered hosts need a real fence around the count.
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+#define SNAPSHOT_BARRIER() __sync_synchronize()
+#else
+#define SNAPSHOT_BARRIER()
+#endif
+
+typedef struct
+{
+    volatile uint32_t seq;   //2 per publish, the low bit selects the copy readers use
+    void *copy[2];
+    size_t size;             //record size in sizeof units
+} snapshot_t;
+
+//copy0 and copy1 are two record-sized buffers, both start out as a copy of initial
+void snapshot_init(snapshot_t *snap, void *copy0, void *copy1, size_t size, const void *initial);
+void snapshot_publish(snapshot_t *snap, const void *record);
+//Copies the latest record into record and returns how many publishes it has seen (0 = initial)
+uint32_t snapshot_read(const snapshot_t *snap, void *record);
+
+#endif /* SNAPSHOT_H_ */
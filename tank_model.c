@@ -0,0 +1,88 @@
+// Thie file contains the tank volume table (tank_model.h). The float geometry is only evaluated
+// in tank_model_init(), tank_volume_ml() is integer only.
+
+#include <math.h>
+#include "tank_model.h"
+
+#define TANK_STEP_MM (1UL << TANK_STEP_LOG2)
+
+#if TANK_SHAPE == TANK_SHAPE_TABLE
+//measured profile: distance from the sensor (mm, rising) and the volume left at that level (mL),
+//filled in 1 L steps. Replace with the numbers of your own tank, the last point must be 0 mL.
+typedef struct
+{
+    uint32_t distance_mm;
+    uint32_t volume_ml;
+} tank_point_t;
+
+static const tank_point_t tank_profile[] =
+{
+    {  20, 6000 },
+    {  43, 5000 },
+    {  67, 4000 },
+    {  92, 3000 },
+    { 118, 2000 },
+    { 145, 1000 },
+    { TANK_DEPTH_MM, 0 },
+};
+#define TANK_PROFILE_POINTS (sizeof(tank_profile) / sizeof(tank_profile[0]))
+#endif
+
+static int32_t tank_table[TANK_TABLE_SIZE]; //mL at i * TANK_STEP_MM below the sensor
+
+//volume at distance_mm from the geometry, only used to fill the table. Past the floor the last
+//slope is carried on (negative volume) so the entry straddling the floor still interpolates exactly.
+static int32_t tank_geometry_ml(uint32_t distance_mm)
+{
+#if TANK_SHAPE == TANK_SHAPE_TABLE
+    const tank_point_t *a;
+    const tank_point_t *b;
+    uint16_t i;
+    float t;
+
+    if (distance_mm <= tank_profile[0].distance_mm)
+    {
+        return (int32_t)tank_profile[0].volume_ml; //above the highest point the tank is full
+    }
+    for (i = 1; i < TANK_PROFILE_POINTS - 1; i++)
+    {
+        if (distance_mm < tank_profile[i].distance_mm)
+        {
+            break;
+        }
+    }
+    a = &tank_profile[i - 1];
+    b = &tank_profile[i];
+    t = ((float)distance_mm - (float)a->distance_mm) / ((float)b->distance_mm - (float)a->distance_mm);
+    return (int32_t)floorf((float)a->volume_ml - t * ((float)a->volume_ml - (float)b->volume_ml) + 0.5f);
+#else
+#if TANK_SHAPE == TANK_SHAPE_CYLINDER
+    const float area_mm2 = 3.14159265f * (TANK_DIAMETER_MM / 2.0f) * (TANK_DIAMETER_MM / 2.0f);
+#else
+    const float area_mm2 = (float)TANK_LENGTH_MM * (float)TANK_WIDTH_MM;
+#endif
+
+    return (int32_t)floorf(area_mm2 * ((float)TANK_DEPTH_MM - (float)distance_mm) / 1000.0f + 0.5f); //mm^3 -> mL
+#endif
+}
+
+void tank_model_init(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < TANK_TABLE_SIZE; i++)
+    {
+        tank_table[i] = tank_geometry_ml((uint32_t)i << TANK_STEP_LOG2);
+    }
+}
+
+uint32_t tank_volume_ml(sensor_t distance)
+{
+    uint32_t mm = (uint32_t)sensor_to_units(distance, 10, 0, TANK_DEPTH_MM);
+    uint32_t i = mm >> TANK_STEP_LOG2;
+    int32_t frac = (int32_t)(mm & (TANK_STEP_MM - 1));
+    //the table falls with distance, interpolate down from entry i
+    int32_t ml = tank_table[i] - (((tank_table[i] - tank_table[i + 1]) * frac) >> TANK_STEP_LOG2);
+
+    return (ml > 0) ? (uint32_t)ml : 0;
+}
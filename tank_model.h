@@ -0,0 +1,76 @@
+/*
+ * tank_model.h
+ *
+ * Converts the ultrasonic distance (sensor face to water) into the volume left in the
+ * tank and the pump run time it still allows. The geometry is turned into a volume table
+ * with one entry every 2^TANK_STEP_LOG2 mm by tank_model_init(); a conversion is then a
+ * table lookup and an integer interpolation.
+ * Plain C (sensor_math.h only) so the host tools build it as well.
+ */
+
+#ifndef TANK_MODEL_H_
+#define TANK_MODEL_H_
+
+#include <stdint.h>
+#include "sensor_math.h"
+
+#define TANK_SHAPE_CYLINDER 0 //upright cylinder, TANK_DIAMETER_MM
+#define TANK_SHAPE_RECT 1     //box, TANK_LENGTH_MM x TANK_WIDTH_MM
+#define TANK_SHAPE_TABLE 2    //measured profile, tank_profile[] in tank_model.c
+
+#ifndef TANK_SHAPE
+#define TANK_SHAPE TANK_SHAPE_CYLINDER
+#endif
+#if (TANK_SHAPE < TANK_SHAPE_CYLINDER) || (TANK_SHAPE > TANK_SHAPE_TABLE)
+#error "TANK_SHAPE must be TANK_SHAPE_CYLINDER, TANK_SHAPE_RECT or TANK_SHAPE_TABLE"
+#endif
+
+#ifndef TANK_DEPTH_MM
+#define TANK_DEPTH_MM 170      //sensor face to tank floor
+#endif
+#ifndef TANK_DIAMETER_MM
+#define TANK_DIAMETER_MM 200
+#endif
+#ifndef TANK_LENGTH_MM
+#define TANK_LENGTH_MM 200
+#endif
+#ifndef TANK_WIDTH_MM
+#define TANK_WIDTH_MM 150
+#endif
+#ifndef TANK_RESERVE_ML
+#define TANK_RESERVE_ML 785    //pump locks out below this (25 mm in the default cylinder, the old 14.5 cm limit)
+#endif
+#ifndef PUMP_FLOW_ML_S
+#define PUMP_FLOW_ML_S 25      //pump delivery, mL per second
+#endif
+#ifndef TANK_STEP_LOG2
+#define TANK_STEP_LOG2 3       //table step = 2^N mm
+#endif
+#if (TANK_STEP_LOG2 < 0) || (TANK_STEP_LOG2 > 6)
+#error "TANK_STEP_LOG2 must be 0..6"
+#endif
+
+//entries from 0 mm to past TANK_DEPTH_MM, the last one is always 0 mL
+#define TANK_TABLE_SIZE ((TANK_DEPTH_MM >> TANK_STEP_LOG2) + 2)
+
+void tank_model_init(void); //builds the volume table, call once before the first conversion
+
+//Volume in mL with the water surface distance cm below the sensor
+uint32_t tank_volume_ml(sensor_t distance);
+
+//Whole seconds the pump can run before the volume reaches TANK_RESERVE_ML
+static inline uint32_t tank_pump_seconds(uint32_t volume_ml)
+{
+    return (volume_ml > TANK_RESERVE_ML) ? ((volume_ml - TANK_RESERVE_ML) / PUMP_FLOW_ML_S) : 0;
+}
+
+static inline sensor_t tank_litres(uint32_t volume_ml)
+{
+#if SENSOR_MATH_FIXED
+    return (sensor_t)(((uint64_t)volume_ml << Q16_SHIFT) / 1000);
+#else
+    return (sensor_t)volume_ml * 0.001f;
+#endif
+}
+
+#endif /* TANK_MODEL_H_ */
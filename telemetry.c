@@ -0,0 +1,65 @@
+// Thie file contains the encoder for the binary telemetry frame described in telemetry.h
+// Values are packed as fixed-point integers so no float formatting runs on the C28x.
+
+#include "telemetry.h"
+
+//nibble table for CRC-16/CCITT, 16 words instead of a 256 entry table
+static const uint16_t crc16_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t telemetry_crc16(const unsigned char *data, uint16_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint16_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        uint16_t byte = data[i] & 0xFF;
+        crc = (uint16_t)(crc << 4) ^ crc16_nibble[((crc >> 12) ^ (byte >> 4)) & 0x0F];
+        crc = (uint16_t)(crc << 4) ^ crc16_nibble[((crc >> 12) ^ byte) & 0x0F];
+    }
+    return crc;
+}
+
+unsigned char *telemetry_put_u16(unsigned char *p, uint16_t value)
+{
+    *p++ = value & 0xFF;
+    *p++ = (value >> 8) & 0xFF;
+    return p;
+}
+
+unsigned char *telemetry_put_u32(unsigned char *p, uint32_t value)
+{
+    p = telemetry_put_u16(p, (uint16_t)(value & 0xFFFF));
+    return telemetry_put_u16(p, (uint16_t)(value >> 16));
+}
+
+uint16_t telemetry_frame_finish(unsigned char *frame, uint16_t sync0, uint16_t sync1, uint16_t version,
+                                uint16_t payload)
+{
+    uint16_t crc;
+
+    frame[0] = sync0 & 0xFF;
+    frame[1] = sync1 & 0xFF;
+    frame[2] = version & 0xFF;
+    frame[3] = payload & 0xFF;
+    crc = telemetry_crc16(frame + 2, TELEMETRY_HEADER_SIZE - 2 + payload); //sync is not covered
+    telemetry_put_u16(frame + TELEMETRY_HEADER_SIZE + payload, crc);
+    return TELEMETRY_HEADER_SIZE + payload + TELEMETRY_CRC_SIZE;
+}
+
+uint16_t telemetry_encode(unsigned char *frame, const telemetry_sample_t *sample)
+{
+    unsigned char *p = frame + TELEMETRY_HEADER_SIZE;
+
+    p = telemetry_put_u16(p, sample->seq);
+    p = telemetry_put_u32(p, sample->time_ms);
+    p = telemetry_put_u16(p, (uint16_t)sample->temperature_centi);
+    p = telemetry_put_u16(p, sample->humidity_centi);
+    p = telemetry_put_u16(p, (uint16_t)sample->moisture_centi);
+    p = telemetry_put_u16(p, sample->water_level_mm);
+    *p++ = sample->flags & 0xFF;
+    return telemetry_frame_finish(frame, TELEMETRY_SYNC0, TELEMETRY_SYNC1, TELEMETRY_VERSION, TELEMETRY_PAYLOAD_SIZE);
+}
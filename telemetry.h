@@ -0,0 +1,62 @@
+/*
+ * telemetry.h
+ *
+ * Binary telemetry frame sent to the ESP32 in place of the sprintf text line.
+ * Plain C with no TI includes so the host decoder can share the CRC.
+ *
+ * Frame (little endian, one octet per char on the C28x):
+ *   [0..1]  sync 0xA5 0x5A
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload: seq u16, time_ms u32, temperature i16 (0.01 C),
+ *           humidity u16 (0.01 %RH), moisture i16 (0.01 %), water level u16 (mm),
+ *           flags u8 (TELEMETRY_FLAG_*)
+ *   [last2] CRC-16/CCITT-FALSE over version..payload
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+
+#define TELEMETRY_SYNC0 0xA5
+#define TELEMETRY_SYNC1 0x5A
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_HEADER_SIZE 4
+#define TELEMETRY_PAYLOAD_SIZE 15
+#define TELEMETRY_CRC_SIZE 2
+#define TELEMETRY_FRAME_SIZE (TELEMETRY_HEADER_SIZE + TELEMETRY_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE)
+
+#define TELEMETRY_FLAG_PUMP_ON  0x01 //GPIO22 driven high
+#define TELEMETRY_FLAG_TANK_LOW 0x02 //tank below TANK_RESERVE_ML, pump locked out
+#define TELEMETRY_FLAG_STALE    0x04 //a sensor channel has not produced a record for SAMPLE_STALE_MS
+
+//one sample in wire units
+typedef struct
+{
+    uint16_t seq;
+    uint32_t time_ms;
+    int16_t temperature_centi;
+    uint16_t humidity_centi;
+    int16_t moisture_centi;
+    uint16_t water_level_mm;
+    uint16_t flags;
+} telemetry_sample_t;
+
+//CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over the low octet of each element
+uint16_t telemetry_crc16(const unsigned char *data, uint16_t length);
+
+//Little endian writers for frame payloads, return the element after the value.
+unsigned char *telemetry_put_u16(unsigned char *p, uint16_t value);
+unsigned char *telemetry_put_u32(unsigned char *p, uint32_t value);
+
+//Writes the 4 element header (sync0, sync1, version, payload length) in front of the payload at
+//frame + TELEMETRY_HEADER_SIZE and the CRC over version..payload after it. Shared by every dump
+//frame (profile, trace, bench, window statistics, pipeline). Returns the frame length.
+uint16_t telemetry_frame_finish(unsigned char *frame, uint16_t sync0, uint16_t sync1, uint16_t version,
+                                uint16_t payload);
+
+//Writes one frame into frame (at least TELEMETRY_FRAME_SIZE elements), returns its length.
+uint16_t telemetry_encode(unsigned char *frame, const telemetry_sample_t *sample);
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,47 @@
+// Thie file contains the 64-bit timebase extension and the count conversions (timebase.h)
+// Conversions split the count into whole seconds and a remainder so nothing overflows.
+
+#include "timebase.h"
+
+void timebase_init(timebase_t *tb, uint32_t freq_hz, uint32_t now)
+{
+    tb->freq_hz = freq_hz;
+    tb->high = 0;
+    tb->last = now;
+}
+
+uint64_t timebase_extend(timebase_t *tb, uint32_t now)
+{
+    uint32_t high = tb->high;
+
+    if (now < tb->last)
+    {
+        high++; //counter wrapped since the previous reading
+        tb->high = high;
+    }
+    tb->last = now;
+    return ((uint64_t)high << 32) | now;
+}
+
+static uint64_t timebase_scale(const timebase_t *tb, uint64_t counts, uint32_t per_second)
+{
+    uint64_t seconds = counts / tb->freq_hz;
+    uint64_t rest = counts - seconds * tb->freq_hz; //below freq_hz, times per_second fits in 64 bits
+
+    return seconds * per_second + (rest * per_second) / tb->freq_hz;
+}
+
+uint64_t timebase_to_us(const timebase_t *tb, uint64_t counts)
+{
+    return timebase_scale(tb, counts, 1000000UL);
+}
+
+uint64_t timebase_to_ms(const timebase_t *tb, uint64_t counts)
+{
+    return timebase_scale(tb, counts, 1000UL);
+}
+
+uint64_t timebase_from_ms(const timebase_t *tb, uint32_t ms)
+{
+    return ((uint64_t)ms * tb->freq_hz) / 1000U;
+}
@@ -0,0 +1,42 @@
+/*
+ * timebase.h
+ *
+ * Monotonic 64-bit timebase built on the 32-bit CPU timestamp counter (Timestamp_get32,
+ * 200 MHz, wraps every ~21 s). timebase_extend() compares each counter reading with the
+ * previous one and carries into the upper word when it went backwards, so the extended
+ * count is exact as long as it is read at least once per wrap. The firmware reads it
+ * from myTickFxn every 10000 Timer0 ticks (100 ms) as well as from every user.
+ *
+ * The caller serialises timebase_extend() and must read the counter inside the same
+ * critical section: a reading taken before the lock can be older than the one stored by
+ * whoever held the lock meanwhile, and would be taken for a wrap. The firmware does both
+ * with Hwi disabled in timebase_now(), callable from Hwi, Swi and Task context.
+ * Plain C so the host tools build it as well.
+ */
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+    volatile uint32_t last;  //counter at the previous reading
+    volatile uint32_t high;  //wraps seen so far, upper word of the extended count
+    uint32_t freq_hz;        //counter rate
+} timebase_t;
+
+void timebase_init(timebase_t *tb, uint32_t freq_hz, uint32_t now);
+//Extends one counter reading to 64 bits, see above for the locking
+uint64_t timebase_extend(timebase_t *tb, uint32_t now);
+
+//Counts to time, exact for the whole 64-bit range (64-bit divides, keep out of ISRs)
+uint64_t timebase_to_us(const timebase_t *tb, uint64_t counts);
+uint64_t timebase_to_ms(const timebase_t *tb, uint64_t counts);
+uint64_t timebase_from_ms(const timebase_t *tb, uint32_t ms);
+
+//Firmware timebase (SoilMonitor_main.c): extended Timestamp_get32() at 1 / timebase.freq_hz s per count
+extern timebase_t timebase;
+uint64_t timebase_now(void);
+
+#endif /* TIMEBASE_H_ */
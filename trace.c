@@ -0,0 +1,76 @@
+// Thie file contains the event trace ring and the encoder for its dump frames (trace.h)
+// The frame CRC is the telemetry one, like the profile frames.
+
+#include "trace.h"
+#include "telemetry.h"
+
+const char *const trace_object_names[TRACE_OBJECTS] = {
+    "idle", "Tsk0", "Tsk1", "Tsk2", "task",
+    "Swi0", "swi",
+    "hwi0", "hwi1", "hwi2", "hwi3", "hwi4", "hwi5", "hwi6", "hwi",
+    "mySem", "mySem1", "mySem2", "i2cSem", "sem"
+};
+
+void trace_init(trace_buffer_t *trace)
+{
+    trace->count = 0;
+    trace->untraced = 0;
+    trace->running = 1;
+}
+
+//events held by the ring
+static uint16_t trace_held(const trace_buffer_t *trace)
+{
+    return (trace->count > TRACE_DEPTH) ? TRACE_DEPTH : (uint16_t)trace->count;
+}
+
+uint16_t trace_freeze(trace_buffer_t *trace)
+{
+    trace->running = 0;
+    return 1 + (trace_held(trace) + TRACE_FRAME_EVENTS - 1) / TRACE_FRAME_EVENTS;
+}
+
+void trace_resume(trace_buffer_t *trace)
+{
+    trace->count = 0;
+    trace->untraced = 0;
+    trace->running = 1;
+}
+
+uint16_t trace_encode(unsigned char *frame, const trace_buffer_t *trace, uint32_t freq_hz, uint16_t part)
+{
+    unsigned char *q = frame + TRACE_HEADER_SIZE;
+    uint16_t held = trace_held(trace);
+    uint16_t payload;
+
+    if (part == 0)
+    {
+        *q++ = TRACE_KIND_START;
+        q = telemetry_put_u16(q, held);
+        q = telemetry_put_u32(q, trace->count - held);
+        q = telemetry_put_u32(q, freq_hz);
+        q = telemetry_put_u32(q, trace->untraced);
+    }
+    else
+    {
+        uint16_t first = (part - 1) * TRACE_FRAME_EVENTS;
+        uint16_t n = (held > first) ? (held - first) : 0;
+        uint32_t oldest = trace->count - held;
+        uint16_t i;
+
+        if (n > TRACE_FRAME_EVENTS)
+        {
+            n = TRACE_FRAME_EVENTS;
+        }
+        *q++ = TRACE_KIND_EVENTS;
+        for (i = 0; i < n; i++)
+        {
+            const trace_event_t *e = &trace->ev[(oldest + first + i) & TRACE_MASK];
+            q = telemetry_put_u32(q, e->time);
+            q = telemetry_put_u16(q, e->event);
+            q = telemetry_put_u16(q, e->arg);
+        }
+    }
+    payload = (uint16_t)(q - frame) - TRACE_HEADER_SIZE;
+    return telemetry_frame_finish(frame, TRACE_SYNC0, TRACE_SYNC1, TRACE_VERSION, payload);
+}
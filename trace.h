@@ -0,0 +1,133 @@
+/*
+ * trace.h
+ *
+ * Event trace recorder. Task switches, Swi and Hwi begin/end and semaphore post/pend are
+ * written into a RAM ring of TRACE_DEPTH events by the SYS/BIOS hook functions in
+ * trace_bios.c, each with the low 32 bits of the CPU timestamp counter. The ring runs as a
+ * flight recorder: a dump freezes it, streams the events oldest first and restarts it.
+ * The host tool host/trace2json turns the dump into a Chrome trace / Perfetto timeline.
+ *
+ * trace_put() must be serialised by the caller (the hooks run it with Hwi disabled); the
+ * ring is only read while frozen. Hwis other than hwi0..hwi6 (TRACE_OBJ_HWI: the Timer0 tick and
+ * the Clock's Timer2 Hwi) are not recorded, only counted together: the 100 kHz tick alone would
+ * fill the ring every 2.5 ms.
+ *
+ * Frames (little endian, one octet per char on the C28x), each fits in UART_FRAME_SIZE:
+ *   [0..1]  sync 0xA5 0x3C
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload: kind u8, then
+ *           TRACE_KIND_START:  events in the dump u16, events lost to the ring u32, counter rate u32 (Hz),
+ *                              TRACE_OBJ_HWI runs counted instead of recorded u32
+ *           TRACE_KIND_EVENTS: n x (time u32, event u16, arg u16), n <= TRACE_FRAME_EVENTS
+ *   [last2] CRC-16/CCITT-FALSE over version..payload (telemetry_crc16)
+ * Plain C so the host tools build it as well.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+
+#ifndef TRACE_DEPTH
+#define TRACE_DEPTH 512 //events, power of two
+#endif
+#if (TRACE_DEPTH < 16) || (TRACE_DEPTH > 4096) || (TRACE_DEPTH & (TRACE_DEPTH - 1))
+#error "TRACE_DEPTH must be a power of two from 16 to 4096"
+#endif
+#define TRACE_MASK ((uint32_t)TRACE_DEPTH - 1U)
+
+//event types, in the top 4 bits of the event word
+#define TRACE_TASK_SWITCH 0 //object = task switched in, arg = task switched out
+#define TRACE_SWI_BEGIN 1
+#define TRACE_SWI_END 2
+#define TRACE_HWI_BEGIN 3
+#define TRACE_HWI_END 4
+#define TRACE_SEM_POST 5
+#define TRACE_SEM_PEND 6    //the calling task is about to pend
+#define TRACE_SEM_PENDED 7  //pend returned, arg = 1 taken, 0 timed out
+#define TRACE_MARK 8        //free use, arg is a value to show
+#define TRACE_TYPES 9
+
+//objects, in the low 12 bits of the event word
+#define TRACE_OBJ_IDLE 0
+#define TRACE_OBJ_TSK0 1
+#define TRACE_OBJ_TSK1 2
+#define TRACE_OBJ_TSK2 3
+#define TRACE_OBJ_TASK 4    //any other task
+#define TRACE_OBJ_SWI0 5
+#define TRACE_OBJ_SWI 6     //any other Swi (the Clock Swi)
+#define TRACE_OBJ_HWI0 7    //hwi0..hwi6 from app.cfg follow in order
+#define TRACE_OBJ_HWI 14    //any other Hwi (the Timer0 tick, the Clock Hwi), counted only
+#define TRACE_OBJ_MYSEM 15
+#define TRACE_OBJ_MYSEM1 16
+#define TRACE_OBJ_MYSEM2 17
+#define TRACE_OBJ_I2CSEM 18
+#define TRACE_OBJ_SEM 19    //any other semaphore
+#define TRACE_OBJECTS 20
+
+#define TRACE_EVENT(type, object) ((uint16_t)(((type) << 12) | (object)))
+#define TRACE_TYPE(event) ((uint16_t)((event) >> 12))
+#define TRACE_OBJECT(event) ((uint16_t)((event) & 0x0FFF))
+
+#define TRACE_DUMP_COMMAND 0x54 //'T' received on SCIB asks for a dump
+#define TRACE_SYNC0 0xA5
+#define TRACE_SYNC1 0x3C
+#define TRACE_VERSION 2
+#define TRACE_HEADER_SIZE 4
+#define TRACE_CRC_SIZE 2
+#define TRACE_KIND_START 0
+#define TRACE_KIND_EVENTS 1
+#define TRACE_START_PAYLOAD 15
+#define TRACE_FRAME_EVENTS 6
+#define TRACE_FRAME_MAX (TRACE_HEADER_SIZE + 1 + 8 * TRACE_FRAME_EVENTS + TRACE_CRC_SIZE)
+
+typedef struct
+{
+    uint32_t time;   //timestamp counts, low 32 bits
+    uint16_t event;  //TRACE_EVENT(type, object)
+    uint16_t arg;
+} trace_event_t;
+
+typedef struct
+{
+    trace_event_t ev[TRACE_DEPTH];
+    volatile uint32_t count;    //events written since init
+    volatile uint32_t untraced; //TRACE_OBJ_HWI runs since init, not in the ring
+    volatile uint16_t running;  //0 while frozen for a dump
+} trace_buffer_t;
+
+extern const char *const trace_object_names[TRACE_OBJECTS];
+
+void trace_init(trace_buffer_t *trace);
+
+static inline void trace_put(trace_buffer_t *trace, uint32_t time, uint16_t event, uint16_t arg)
+{
+    if (trace->running)
+    {
+        trace_event_t *e = &trace->ev[trace->count & TRACE_MASK];
+        e->time = time;
+        e->event = event;
+        e->arg = arg;
+        trace->count++;
+    }
+}
+
+//Counts a run that is not recorded, same serialisation as trace_put()
+static inline void trace_skip(trace_buffer_t *trace)
+{
+    if (trace->running)
+    {
+        trace->untraced++;
+    }
+}
+
+//Stops recording and returns the number of frames the dump takes
+uint16_t trace_freeze(trace_buffer_t *trace);
+//Writes frame number part (0 = start frame) of the frozen ring into frame (at least
+//TRACE_FRAME_MAX elements), returns its length
+uint16_t trace_encode(unsigned char *frame, const trace_buffer_t *trace, uint32_t freq_hz, uint16_t part);
+//Starts recording again after a dump, the ring starts empty
+void trace_resume(trace_buffer_t *trace);
+
+#endif /* TRACE_H_ */
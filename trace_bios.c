@@ -0,0 +1,170 @@
+// Thie file contains the SYS/BIOS hook functions and semaphore wrappers of the event trace recorder (trace_bios.h)
+// Every event is stamped and stored with Hwi disabled, about as long as one Hwi_disable/restore pair.
+
+#include "trace_bios.h"
+#include <xdc/runtime/Timestamp.h>
+#include <ti/sysbios/knl/Task.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <ti/sysbios/family/c28/Hwi.h>
+
+//objects created in app.cfg
+extern const Task_Handle Tsk0;
+extern const Task_Handle Tsk1;
+extern const Task_Handle Tsk2;
+extern const Swi_Handle Swi0;
+extern const Hwi_Handle hwi0;
+extern const Hwi_Handle hwi1;
+extern const Hwi_Handle hwi2;
+extern const Hwi_Handle hwi3;
+extern const Hwi_Handle hwi4;
+extern const Hwi_Handle hwi5;
+extern const Hwi_Handle hwi6;
+extern const Semaphore_Handle mySem;
+extern const Semaphore_Handle mySem1;
+extern const Semaphore_Handle mySem2;
+extern const Semaphore_Handle i2cSem;
+
+trace_buffer_t trace_buffer;
+
+//hwi0..hwi6 in TRACE_OBJ_HWI0 order, the handles are constants of the generated configuration
+static const Hwi_Handle *const trace_hwis[TRACE_OBJ_HWI - TRACE_OBJ_HWI0] = {
+    &hwi0, &hwi1, &hwi2, &hwi3, &hwi4, &hwi5, &hwi6
+};
+//last Hwi found in none of them, nearly always the Timer0 tick
+static Hwi_Handle trace_unlisted_hwi;
+
+static void trace_record(uint16_t event, uint16_t arg)
+{
+    UInt key = Hwi_disable(); // hooks run in every context and nest
+    trace_put(&trace_buffer, Timestamp_get32(), event, arg);
+    Hwi_restore(key);
+}
+
+static uint16_t trace_task_id(Task_Handle task)
+{
+    if (task == Tsk0)
+    {
+        return TRACE_OBJ_TSK0;
+    }
+    if (task == Tsk1)
+    {
+        return TRACE_OBJ_TSK1;
+    }
+    if (task == Tsk2)
+    {
+        return TRACE_OBJ_TSK2;
+    }
+    if (task == Task_getIdleTask())
+    {
+        return TRACE_OBJ_IDLE;
+    }
+    return TRACE_OBJ_TASK;
+}
+
+//The 100 kHz tick returns on the first compare; only an unlisted Hwi other than the last one
+//(the Clock's, once per ms) scans the table
+static uint16_t trace_hwi_id(Hwi_Handle hwi)
+{
+    uint16_t i;
+
+    if (hwi == trace_unlisted_hwi)
+    {
+        return TRACE_OBJ_HWI;
+    }
+    for (i = 0; i < TRACE_OBJ_HWI - TRACE_OBJ_HWI0; i++)
+    {
+        if (hwi == *trace_hwis[i])
+        {
+            return TRACE_OBJ_HWI0 + i;
+        }
+    }
+    trace_unlisted_hwi = hwi; //a pointer store, a nested hook at worst scans once more
+    return TRACE_OBJ_HWI;
+}
+
+static uint16_t trace_sem_id(Semaphore_Handle sem)
+{
+    if (sem == mySem)
+    {
+        return TRACE_OBJ_MYSEM;
+    }
+    if (sem == mySem1)
+    {
+        return TRACE_OBJ_MYSEM1;
+    }
+    if (sem == mySem2)
+    {
+        return TRACE_OBJ_MYSEM2;
+    }
+    if (sem == i2cSem)
+    {
+        return TRACE_OBJ_I2CSEM;
+    }
+    return TRACE_OBJ_SEM;
+}
+
+/* ======== Task switch hook ======== */
+Void trace_task_switch(Task_Handle prev, Task_Handle next)
+{
+    trace_record(TRACE_EVENT(TRACE_TASK_SWITCH, trace_task_id(next)), trace_task_id(prev));
+}
+
+/* ======== Swi hooks ======== */
+Void trace_swi_begin(Swi_Handle swi)
+{
+    trace_record(TRACE_EVENT(TRACE_SWI_BEGIN, (swi == Swi0) ? TRACE_OBJ_SWI0 : TRACE_OBJ_SWI), 0);
+}
+
+Void trace_swi_end(Swi_Handle swi)
+{
+    trace_record(TRACE_EVENT(TRACE_SWI_END, (swi == Swi0) ? TRACE_OBJ_SWI0 : TRACE_OBJ_SWI), 0);
+}
+
+/* ======== Hwi hooks ======== */
+//Hwis outside hwi0..hwi6 (TRACE_OBJ_HWI: the 100 kHz Timer0 tick and the 1 kHz Clock Timer2 Hwi)
+//are counted instead of recorded
+Void trace_hwi_begin(Hwi_Handle hwi)
+{
+    uint16_t id = trace_hwi_id(hwi);
+
+    if (id == TRACE_OBJ_HWI)
+    {
+        UInt key = Hwi_disable();
+        trace_skip(&trace_buffer);
+        Hwi_restore(key);
+        return;
+    }
+    trace_record(TRACE_EVENT(TRACE_HWI_BEGIN, id), 0);
+}
+
+Void trace_hwi_end(Hwi_Handle hwi)
+{
+    uint16_t id = trace_hwi_id(hwi);
+
+    if (id != TRACE_OBJ_HWI)
+    {
+        trace_record(TRACE_EVENT(TRACE_HWI_END, id), 0);
+    }
+}
+
+void trace_sem_post(Semaphore_Handle sem)
+{
+    trace_record(TRACE_EVENT(TRACE_SEM_POST, trace_sem_id(sem)), 0);
+    Semaphore_post(sem);
+}
+
+Bool trace_sem_pend(Semaphore_Handle sem, UInt32 timeout)
+{
+    uint16_t id = trace_sem_id(sem);
+    Bool taken;
+
+    trace_record(TRACE_EVENT(TRACE_SEM_PEND, id), 0);
+    taken = Semaphore_pend(sem, timeout);
+    trace_record(TRACE_EVENT(TRACE_SEM_PENDED, id), taken ? 1 : 0);
+    return taken;
+}
+
+void trace_mark(uint16_t value)
+{
+    trace_record(TRACE_EVENT(TRACE_MARK, TRACE_OBJ_IDLE), value); //the host puts it on the running thread
+}
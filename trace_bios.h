@@ -0,0 +1,24 @@
+/*
+ * trace_bios.h
+ *
+ * SYS/BIOS side of the event trace recorder (trace.h). The Task switch, Swi begin/end and
+ * Hwi begin/end hooks are installed in app.cfg; semaphores have no hooks, so the firmware
+ * posts and pends through the wrappers below to get them into the trace.
+ */
+
+#ifndef TRACE_BIOS_H_
+#define TRACE_BIOS_H_
+
+#include <xdc/std.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include "trace.h"
+
+extern trace_buffer_t trace_buffer;
+
+//Semaphore_post / Semaphore_pend with a trace event, callable where those are
+void trace_sem_post(Semaphore_Handle sem);
+Bool trace_sem_pend(Semaphore_Handle sem, UInt32 timeout);
+//Marks a point of interest on the timeline of the running thread
+void trace_mark(uint16_t value);
+
+#endif /* TRACE_BIOS_H_ */
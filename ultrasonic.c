@@ -5,13 +5,26 @@
 #include "ultrasonic.h"
 
 
-float calculateDistance(UInt32 echoTime) {
-    float distance = ((((float)echoTime)/(5800))/2);// formula for converting time to cm as per datasheet//DB 
+sensor_t calculateDistance(UInt32 echoTime) {
+    sensor_t distance = sensor_echo_to_cm(echoTime);// formula for converting time to cm as per datasheet (sensor_math.c)//DB 
     return distance;
 }
 
-
-
-
-
-
+//ePWM2A produces the trigger pulse at ULTRASONIC_RATE_HZ, no task has to time it
+void ultrasonic_init(void)
+{
+    EALLOW;
+    CpuSysRegs.PCLKCR2.bit.EPWM2 = 1;
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0; // hold the time base while configuring
+    EPwm2Regs.TBCTL.bit.CTRMODE = 3; // stopped
+    EPwm2Regs.TBCTL.bit.HSPCLKDIV = 1; // /2
+    EPwm2Regs.TBCTL.bit.CLKDIV = 7; // /128 -> ULTRASONIC_TBCLK_HZ
+    EPwm2Regs.TBPRD = ULTRASONIC_PERIOD_COUNTS - 1;
+    EPwm2Regs.TBCTR = 0;
+    EPwm2Regs.CMPA.bit.CMPA = ULTRASONIC_TRIG_COUNTS;
+    EPwm2Regs.AQCTLA.bit.ZRO = 2; // trigger high at the start of every ranging period
+    EPwm2Regs.AQCTLA.bit.CAU = 1; // and low ULTRASONIC_TRIG_COUNTS later
+    EPwm2Regs.TBCTL.bit.CTRMODE = 0; // count up
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+    EDIS;
+}
@@ -19,11 +19,35 @@
 #include <ti/sysbios/knl/Task.h>
 #include <xdc/std.h>
 #include <Headers/F2837xD_device.h>
+#include "sensor_math.h"
 
 extern void DeviceInit(void);
 
-
-float calculateDistance(UInt32 echoTime);
+//Ranging: ePWM2A (GPIO2) drives the trigger pulse in hardware at ULTRASONIC_RATE_HZ, eCAP1 times
+//the echoes (rising -> falling edge) in 4-event mode and ECAP_ISR posts mySem1 every two echoes
+//with the widths in ultrasonic_echo[]. water_level.c turns them into a level.
+#ifndef ULTRASONIC_RATE_HZ
+#define ULTRASONIC_RATE_HZ 10 //ranges per second
+#endif
+#define ULTRASONIC_TBCLK_HZ 390625UL //EPWMCLK 100 MHz / (HSPCLKDIV 2 * CLKDIV 128)
+#define ULTRASONIC_PERIOD_COUNTS (ULTRASONIC_TBCLK_HZ / ULTRASONIC_RATE_HZ)
+#define ULTRASONIC_PERIOD_MS (1000 / ULTRASONIC_RATE_HZ)
+#define ULTRASONIC_TRIG_COUNTS 5 //12.8 us high, the sensor needs at least 10 us
+
+#if (ULTRASONIC_RATE_HZ < 6) || (ULTRASONIC_RATE_HZ > 16)
+#error "ULTRASONIC_RATE_HZ must be 6..16 (16-bit ePWM period, 60 ms echo cycle)"
+#endif
+
+//Tsk1 gives up on an echo pair after this many Clock ticks (1 ms) and counts a miss
+#ifndef ULTRASONIC_TIMEOUT_TICKS
+#define ULTRASONIC_TIMEOUT_TICKS (3 * ULTRASONIC_PERIOD_MS)
+#endif
+//consecutive misses before the pump is locked out as if the tank were low
+#define ULTRASONIC_MISS_LIMIT 3
+
+
+sensor_t calculateDistance(UInt32 echoTime);
+void ultrasonic_init(void); //start the ePWM2 trigger, call after DeviceInit()
 
 
 #endif /* ULTRASONIC_H_ */
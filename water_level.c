@@ -0,0 +1,107 @@
+// Thie file contains the median filtered, temperature compensated water level estimator (water_level.h)
+// Widths stay in eCAP counts until the final conversion so the filter is exact on both math paths.
+
+#include "water_level.h"
+
+//speed of sound the ECHO_COUNTS_PER_CM constant in sensor_math.h assumes, m/s
+#define SOUND_SPEED_REF (2.0 * 200e6 / ECHO_COUNTS_PER_CM / 100.0)
+//eCAP counts of round trip per cm at the reference speed
+#define COUNTS_PER_CM ECHO_COUNTS_PER_CM
+//rate limit per ms of elapsed time and the constant allowance, both in counts
+#define MAX_COUNTS_PER_MS ((uint32_t)(WATER_LEVEL_MAX_RATE * COUNTS_PER_CM / 1000.0 + 0.5))
+#define NOISE_COUNTS ((uint32_t)(WATER_LEVEL_NOISE * COUNTS_PER_CM + 0.5))
+#define MAX_ECHO_COUNTS ((uint32_t)(WATER_LEVEL_MAX_CM * COUNTS_PER_CM))
+
+void water_level_init(water_level_t *wl)
+{
+    uint16_t i;
+
+    for (i = 0; i < WATER_LEVEL_WINDOW; i++)
+    {
+        wl->width[i] = 0;
+    }
+    wl->head = 0;
+    wl->count = 0;
+    wl->median = 0;
+    wl->rejected_run = 0;
+    wl->elapsed_ms = 0;
+    wl->accepted = 0;
+    wl->rejected = 0;
+    wl->no_echo = 0;
+}
+
+static uint32_t window_median(const water_level_t *wl)
+{
+    uint32_t sorted[WATER_LEVEL_WINDOW];
+    uint16_t i;
+    uint16_t j;
+
+    //insertion sort of at most 15 values
+    for (i = 0; i < wl->count; i++)
+    {
+        uint32_t v = wl->width[i];
+        for (j = i; (j > 0) && (sorted[j - 1] > v); j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    return sorted[wl->count / 2]; //upper median while the window fills with an even count
+}
+
+int water_level_push(water_level_t *wl, uint32_t width_counts, uint32_t dt_ms)
+{
+    wl->elapsed_ms += dt_ms; //the surface may have moved for as long as nothing was accepted
+    if (width_counts > MAX_ECHO_COUNTS)
+    {
+        wl->no_echo++; //not a level: must neither enter the window nor count towards a reseed
+        return 0;
+    }
+    if (wl->count != 0)
+    {
+        uint32_t limit = NOISE_COUNTS + MAX_COUNTS_PER_MS * wl->elapsed_ms;
+        uint32_t diff = (width_counts > wl->median) ? (width_counts - wl->median) : (wl->median - width_counts);
+
+        if (diff > limit)
+        {
+            wl->rejected++;
+            if (++wl->rejected_run < WATER_LEVEL_REJECT_LIMIT)
+            {
+                return 0;
+            }
+            //the level really moved (tank refilled, sensor re-aimed): start over from this echo
+            wl->count = 0;
+            wl->head = 0;
+        }
+    }
+    wl->rejected_run = 0;
+    wl->elapsed_ms = 0;
+    wl->accepted++;
+    wl->width[wl->head] = width_counts;
+    wl->head = (wl->head + 1) % WATER_LEVEL_WINDOW;
+    if (wl->count < WATER_LEVEL_WINDOW)
+    {
+        wl->count++;
+    }
+    wl->median = window_median(wl);
+    return 1;
+}
+
+#if SENSOR_MATH_FIXED
+
+sensor_t water_level_cm(const water_level_t *wl, sensor_t temperature)
+{
+    //c(T) / c_ref in Q16: 331.3 / c_ref + T * 0.606 / c_ref
+    q16_t scale = Q16(SOUND_SPEED_0C / SOUND_SPEED_REF) + q16_mul(temperature, Q16(SOUND_SPEED_PER_C / SOUND_SPEED_REF));
+    return q16_mul(sensor_echo_to_cm(wl->median), scale);
+}
+
+#else
+
+sensor_t water_level_cm(const water_level_t *wl, sensor_t temperature)
+{
+    float scale = (float)((SOUND_SPEED_0C + SOUND_SPEED_PER_C * temperature) / SOUND_SPEED_REF);
+    return sensor_echo_to_cm(wl->median) * scale;
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * water_level.h
+ *
+ * Tank level estimator fed with raw eCAP echo widths. Widths past the sensor's range (the
+ * HC-SR04's 38 ms no-echo pulse) are dropped, every other echo is checked against the
+ * current estimate with a physical rate-of-change limit, accepted widths go into a sliding
+ * window and the level is the median of that window converted with the speed of sound at
+ * the measured air temperature (331.3 + 0.606 * T m/s).
+ * Plain C (sensor_math.h only) so it runs on the host as well.
+ */
+
+#ifndef WATER_LEVEL_H_
+#define WATER_LEVEL_H_
+
+#include <stdint.h>
+#include "sensor_math.h"
+
+#ifndef WATER_LEVEL_WINDOW
+#define WATER_LEVEL_WINDOW 5 //echoes in the median window, odd
+#endif
+#if ((WATER_LEVEL_WINDOW % 2) == 0) || (WATER_LEVEL_WINDOW > 15)
+#error "WATER_LEVEL_WINDOW must be odd and at most 15"
+#endif
+
+#define WATER_LEVEL_MAX_RATE 2.0     //cm/s the surface can physically move (pump draw / refill)
+#define WATER_LEVEL_NOISE 1.0        //cm of jitter always accepted on top of the rate limit
+#define WATER_LEVEL_REJECT_LIMIT 8   //rejections in a row after which the window is reseeded (real step)
+#define WATER_LEVEL_MAX_CM 500.0     //longest distance taken as an echo: HC-SR04 range 400 cm, -20 C
+                                     //included; its no-echo pulse reads about 655 cm
+#define SOUND_SPEED_0C 331.3         //m/s at 0 C
+#define SOUND_SPEED_PER_C 0.606      //m/s per C
+
+typedef struct
+{
+    uint32_t width[WATER_LEVEL_WINDOW]; //accepted echo widths, eCAP counts
+    uint16_t head;                      //next slot to overwrite
+    uint16_t count;                     //valid entries
+    uint32_t median;                    //median of the window, 0 until the first echo
+    uint16_t rejected_run;              //consecutive rejected echoes
+    uint32_t elapsed_ms;                //time since the last accepted echo
+    uint32_t accepted;                  //statistics
+    uint32_t rejected;
+    uint32_t no_echo;                   //widths past WATER_LEVEL_MAX_CM
+} water_level_t;
+
+void water_level_init(water_level_t *wl);
+
+//Adds one echo width measured dt_ms after the previous push. Returns 1 if it was accepted
+//into the window, 0 if it was rejected as an outlier or was no echo at all.
+int water_level_push(water_level_t *wl, uint32_t width_counts, uint32_t dt_ms);
+
+//Distance from the sensor to the water in cm, median echo corrected for the air temperature in C.
+sensor_t water_level_cm(const water_level_t *wl, sensor_t temperature);
+
+#endif /* WATER_LEVEL_H_ */
@@ -0,0 +1,168 @@
+// Thie file contains the sliding window statistics engine (window_stats.h)
+// Queue and ring indices wrap with a compare instead of %.
+
+#include "window_stats.h"
+#include "telemetry.h"
+
+static uint16_t wrap(uint16_t index, uint16_t size)
+{
+    return (index >= size) ? (uint16_t)(index - size) : index;
+}
+
+void window_stats_init(window_stats_t *ws, int32_t *storage, uint16_t window)
+{
+    ws->ring = storage;
+    ws->sorted = storage + window;
+    ws->min_queue = storage + 2 * window;
+    ws->max_queue = storage + 3 * window;
+    ws->size = window;
+    ws->head = 0;
+    ws->count = 0;
+    ws->min_front = 0;
+    ws->min_count = 0;
+    ws->max_front = 0;
+    ws->max_count = 0;
+    ws->sum = 0;
+    ws->sum_squares = 0;
+    ws->pushed = 0;
+}
+
+//first index in sorted[0..count) whose value is >= sample
+static uint16_t sorted_lower_bound(const window_stats_t *ws, int32_t sample)
+{
+    uint16_t lo = 0;
+    uint16_t hi = ws->count;
+
+    while (lo < hi)
+    {
+        uint16_t mid = (uint16_t)((lo + hi) >> 1);
+        if (ws->sorted[mid] < sample)
+        {
+            lo = (uint16_t)(mid + 1);
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void window_stats_push(window_stats_t *ws, int32_t sample)
+{
+    uint16_t slot = ws->head;
+    uint16_t i;
+
+    if (ws->count == ws->size)
+    {
+        //the window is full, the sample in this slot leaves first
+        int32_t old = ws->ring[slot];
+        uint16_t from = sorted_lower_bound(ws, old);
+        uint16_t to = sorted_lower_bound(ws, sample);
+
+        ws->sum -= old;
+        ws->sum_squares -= (int64_t)old * old;
+        if (ws->min_queue[ws->min_front] == slot)
+        {
+            ws->min_front = wrap((uint16_t)(ws->min_front + 1), ws->size);
+            ws->min_count--;
+        }
+        if (ws->max_queue[ws->max_front] == slot)
+        {
+            ws->max_front = wrap((uint16_t)(ws->max_front + 1), ws->size);
+            ws->max_count--;
+        }
+        //replace old by sample in sorted[], only the entries between the two positions move
+        if (to > from)
+        {
+            to--;
+            for (i = from; i < to; i++)
+            {
+                ws->sorted[i] = ws->sorted[i + 1];
+            }
+        }
+        else
+        {
+            for (i = from; i > to; i--)
+            {
+                ws->sorted[i] = ws->sorted[i - 1];
+            }
+        }
+        ws->sorted[to] = sample;
+    }
+    else
+    {
+        uint16_t to = sorted_lower_bound(ws, sample);
+
+        for (i = ws->count; i > to; i--)
+        {
+            ws->sorted[i] = ws->sorted[i - 1];
+        }
+        ws->sorted[to] = sample;
+        ws->count++;
+    }
+
+    ws->ring[slot] = sample;
+    ws->sum += sample;
+    ws->sum_squares += (int64_t)sample * sample;
+
+    //drop queued samples the new one makes irrelevant, then queue it
+    while ((ws->min_count > 0) &&
+           (ws->ring[ws->min_queue[wrap((uint16_t)(ws->min_front + ws->min_count - 1), ws->size)]] >= sample))
+    {
+        ws->min_count--;
+    }
+    ws->min_queue[wrap((uint16_t)(ws->min_front + ws->min_count), ws->size)] = slot;
+    ws->min_count++;
+    while ((ws->max_count > 0) &&
+           (ws->ring[ws->max_queue[wrap((uint16_t)(ws->max_front + ws->max_count - 1), ws->size)]] <= sample))
+    {
+        ws->max_count--;
+    }
+    ws->max_queue[wrap((uint16_t)(ws->max_front + ws->max_count), ws->size)] = slot;
+    ws->max_count++;
+
+    ws->head = wrap((uint16_t)(slot + 1), ws->size);
+    ws->pushed++;
+}
+
+int32_t window_stats_mean(const window_stats_t *ws)
+{
+    int64_t half = ws->count / 2;
+
+    //round half away from zero, / truncates toward zero
+    return (int32_t)((ws->sum >= 0) ? ((ws->sum + half) / ws->count) : ((ws->sum - half) / ws->count));
+}
+
+int32_t window_stats_median(const window_stats_t *ws)
+{
+    return ws->sorted[ws->count / 2];
+}
+
+uint64_t window_stats_variance(const window_stats_t *ws)
+{
+    int64_t n = ws->count;
+
+    //n * sum(x^2) - sum(x)^2 is exact and never negative in integers
+    return (uint64_t)(n * ws->sum_squares - ws->sum * ws->sum) / (uint64_t)(n * n);
+}
+
+uint16_t window_stats_encode(unsigned char *frame, uint16_t channel, const window_stats_t *ws)
+{
+    unsigned char *q = frame + WINDOW_STATS_HEADER_SIZE;
+    int empty = (ws->count == 0);
+    uint64_t variance = empty ? 0 : window_stats_variance(ws);
+
+    *q++ = channel & 0xFF;
+    q = telemetry_put_u16(q, ws->count);
+    q = telemetry_put_u16(q, ws->size);
+    q = telemetry_put_u32(q, ws->pushed);
+    q = telemetry_put_u32(q, empty ? 0 : (uint32_t)window_stats_mean(ws));
+    q = telemetry_put_u32(q, empty ? 0 : (uint32_t)window_stats_min(ws));
+    q = telemetry_put_u32(q, empty ? 0 : (uint32_t)window_stats_max(ws));
+    q = telemetry_put_u32(q, empty ? 0 : (uint32_t)window_stats_median(ws));
+    q = telemetry_put_u32(q, (uint32_t)variance);
+    q = telemetry_put_u32(q, (uint32_t)(variance >> 32));
+    return telemetry_frame_finish(frame, WINDOW_STATS_SYNC0, WINDOW_STATS_SYNC1, WINDOW_STATS_VERSION,
+                                  WINDOW_STATS_PAYLOAD);
+}
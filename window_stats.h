@@ -0,0 +1,86 @@
+/*
+ * window_stats.h
+ *
+ * Sliding window statistics over the last N integer samples of one channel: mean, min,
+ * max, variance and median. Samples are integers in the channel's own units (e.g. 0.01 C,
+ * mm), the sums are kept exactly in 64-bit integers so nothing drifts however long it runs.
+ *   min/max  monotonic queues of ring positions, O(1) amortised
+ *   median   the window kept sorted, binary search plus one shift, O(N)
+ *   variance exact from sum and sum of squares
+ * The caller provides the storage (WINDOW_STATS_WORDS(N) int32_t), nothing is allocated.
+ * One writer per channel; a reader in another thread may see a value from mid-update.
+ *
+ * Frame for the UART dump (little endian, one octet per char on the C28x), one per channel:
+ *   [0..1]  sync 0xA5 0x5C
+ *   [2]     version
+ *   [3]     payload length
+ *   [4..]   payload: channel u8, count u16, window u16, pushed u32, mean i32, min i32, max i32,
+ *           median i32, variance u64 (count 0: the statistics are 0)
+ *   [last2] CRC-16/CCITT-FALSE over version..payload (telemetry_crc16)
+ * Plain C so it runs on the host as well.
+ */
+
+#ifndef WINDOW_STATS_H_
+#define WINDOW_STATS_H_
+
+#include <stdint.h>
+
+#define WINDOW_STATS_MAX 1024 //largest window, samples of up to +-2^20 keep the sums exact
+#define WINDOW_STATS_WORDS(window) (4 * (window)) //int32_t storage for a window of that size
+
+#define WINDOW_STATS_DUMP_COMMAND 0x53 //'S' received on SCIB asks for a dump
+#define WINDOW_STATS_SYNC0 0xA5
+#define WINDOW_STATS_SYNC1 0x5C
+#define WINDOW_STATS_VERSION 1
+#define WINDOW_STATS_HEADER_SIZE 4
+#define WINDOW_STATS_CRC_SIZE 2
+#define WINDOW_STATS_PAYLOAD 33
+#define WINDOW_STATS_FRAME_SIZE (WINDOW_STATS_HEADER_SIZE + WINDOW_STATS_PAYLOAD + WINDOW_STATS_CRC_SIZE)
+
+typedef struct
+{
+    int32_t *ring;        //samples in arrival order
+    int32_t *sorted;      //the same samples ascending
+    int32_t *min_queue;   //ring positions with rising values, front is the minimum
+    int32_t *max_queue;   //ring positions with falling values, front is the maximum
+    uint16_t size;        //window length
+    uint16_t head;        //next ring slot to write
+    uint16_t count;       //valid samples
+    uint16_t min_front;
+    uint16_t min_count;
+    uint16_t max_front;
+    uint16_t max_count;
+    int64_t sum;
+    int64_t sum_squares;
+    uint32_t pushed;      //samples since init
+} window_stats_t;
+
+//storage must hold WINDOW_STATS_WORDS(window) values, window is 1..WINDOW_STATS_MAX
+void window_stats_init(window_stats_t *ws, int32_t *storage, uint16_t window);
+void window_stats_push(window_stats_t *ws, int32_t sample);
+
+//All of these need at least one sample (count > 0)
+int32_t window_stats_mean(const window_stats_t *ws);     //rounded to nearest
+int32_t window_stats_median(const window_stats_t *ws);   //upper median for an even count
+uint64_t window_stats_variance(const window_stats_t *ws); //population variance, units^2, rounded down
+
+//Writes the dump frame of one channel into frame (at least WINDOW_STATS_FRAME_SIZE elements),
+//returns its length. channel is the caller's number for it (SAMPLE_CH_* in the firmware).
+uint16_t window_stats_encode(unsigned char *frame, uint16_t channel, const window_stats_t *ws);
+
+static inline uint16_t window_stats_count(const window_stats_t *ws)
+{
+    return ws->count;
+}
+
+static inline int32_t window_stats_min(const window_stats_t *ws)
+{
+    return ws->ring[ws->min_queue[ws->min_front]];
+}
+
+static inline int32_t window_stats_max(const window_stats_t *ws)
+{
+    return ws->ring[ws->max_queue[ws->max_front]];
+}
+
+#endif /* WINDOW_STATS_H_ */